@@ -25,13 +25,19 @@ namespace FieaGameEngine
 		return _name;
 	}
 
-	const Vector<Signature> Action::Signatures()
+	StaticSignatureList Action::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(Action, _name)}
+			REFLECT_FIELD("Name", Action, _name)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of Action share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> Action::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 }
\ No newline at end of file
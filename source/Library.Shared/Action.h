@@ -23,6 +23,7 @@ namespace FieaGameEngine
 		const std::string& GetName() const;
 
 		static const Vector<Signature> Signatures();
+		static StaticSignatureList StaticSignatures();
 
 		virtual void Update(GameState& gameState) = 0;
 		virtual gsl::owner<Action*> Clone() const = 0;
@@ -5,16 +5,22 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(ActionEvent)
 
-	const Vector<Signature> ActionEvent::Signatures()
+	StaticSignatureList ActionEvent::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(ActionEvent, _name)},
-			{"Subtype", Datum::DatumType::String, 1, offsetof(ActionEvent, _subtype)},
-			{"Delay", Datum::DatumType::Integer, 1, offsetof(ActionEvent, _delay)}
+			REFLECT_FIELD("Name", ActionEvent, _name),
+			REFLECT_FIELD("Subtype", ActionEvent, _subtype),
+			REFLECT_FIELD("Delay", ActionEvent, _delay)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of ActionEvent share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> ActionEvent::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	ActionEvent::ActionEvent() :
@@ -28,22 +34,16 @@ namespace FieaGameEngine
 		eventMessage.SetGameObject(*gameState.GetCurrentGameObject());
 		eventMessage.SetSubType(_subtype);
 
-		for (auto attribute : AuxiliaryAttributes())
-		{
-			Datum& d = eventMessage.Append(attribute.name);
-			d.SetType(attribute.type);
-		}
-
-		for (size_t i = 0; i < Size(); ++i)
+		//	The auxiliary attributes of this action are the event's arguments. Index 0 is this action's "this".
+		for (const auto& entry : AuxiliaryEntries())
 		{
-			auto& [key, datum] = *(_orderList[i]);
-			if (!eventMessage.IsPrescribedAttribute(key))
+			if (entry.index != 0 && !eventMessage.IsPrescribedAttribute(entry.key))
 			{
-				eventMessage[key] = datum;
+				eventMessage[entry.key] = entry.datum;
 			}
 		}
 
-		shared_ptr<Event<EventMessageAttributed>> newEvent = make_shared<Event<EventMessageAttributed>>(eventMessage);
+		shared_ptr<Event<EventMessageAttributed>> newEvent = make_shared<Event<EventMessageAttributed>>(std::move(eventMessage));
 
 		EventQueue* queue = gameState.GetEventQueue();
 		queue->Enqueue(newEvent, std::chrono::milliseconds(_delay));
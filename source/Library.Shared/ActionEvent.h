@@ -55,8 +55,15 @@ namespace FieaGameEngine
 		static const Vector<Signature> Signatures();
 
 		/// <summary>
-		/// Update - Creates an attributed event, assigns its GameObject pointer (from the gamestate) and subtype, copies all auxilliary attributes to it,
-		/// and enqueues it into the EventQueue of the gameState with the specified _delay (in milliseconds).
+		/// StaticSignatures - Returns the compile time signatures of the prescribed attributes, declared with REFLECT_FIELD. Register with TypeManager::AddType&lt;ActionEvent&gt;().
+		/// </summary>
+		/// <returns>View of the static signature array.</returns>
+		static StaticSignatureList StaticSignatures();
+
+		/// <summary>
+		/// Update - Creates an attributed event, assigns its GameObject pointer (from the gamestate) and subtype, copies all auxilliary attributes to it
+		/// as its arguments, and enqueues it into the EventQueue of the gameState with the specified _delay (in milliseconds). The message keeps its
+		/// own "this", and arguments named like one of its prescribed attributes aren't copied.
 		/// </summary>
 		/// <param name="gameState">Gamestate pointer that is pointing to the GameObject referenced by the event that stores a 
 		/// pointer to the event queue</param>
@@ -8,8 +8,8 @@ namespace FieaGameEngine
 	ActionList::ActionList() :
 		Action(ActionList::TypeIdClass())
 	{
-		assert(_orderList.At(_actionIndex)->first == "Actions");
-		assert(_orderList.At(_actionIndex)->second.Type() == Datum::DatumType::Table);
+		assert(_table.At(_actionIndex).first == "Actions");
+		assert(_table.At(_actionIndex).second.Type() == Datum::DatumType::Table);
 	}
 
 	ActionList::ActionList(RTTI::IdType id) :
@@ -22,22 +22,28 @@ namespace FieaGameEngine
 		return new ActionList(*this);
 	}
 
-	const Vector<Signature> ActionList::Signatures()
+	StaticSignatureList ActionList::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(ActionList, _name)},
-			{"Actions", Datum::DatumType::Table, 0, 0}
+			REFLECT_FIELD("Name", ActionList, _name),
+			REFLECT_TABLE("Actions", 0)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of ActionList share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> ActionList::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	void ActionList::Update(GameState& gameState)
 	{
 		gameState.SetCurrentAction(*this);
 
-		Datum& actionsDatum = _orderList[_actionIndex]->second;
+		Datum& actionsDatum = _table.At(_actionIndex).second;
 		for (size_t i = 0; i < actionsDatum.Size(); ++i)
 		{
 			Scope& currentAction = actionsDatum[i];
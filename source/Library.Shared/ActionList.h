@@ -22,6 +22,7 @@ namespace FieaGameEngine
 		virtual gsl::owner<ActionList*> Clone() const override;
 
 		static const Vector<Signature> Signatures();
+		static StaticSignatureList StaticSignatures();
 
 	protected:
 		ActionList(RTTI::IdType id);
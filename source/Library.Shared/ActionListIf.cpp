@@ -10,16 +10,22 @@ namespace FieaGameEngine
 	{
 	}
 
-	const Vector<Signature> ActionListIf::Signatures()
+	StaticSignatureList ActionListIf::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Condition", Datum::DatumType::Integer, 1, offsetof(ActionListIf, _condition)},
-			{"Then", Datum::DatumType::Table, 0, 0},
-			{"Else", Datum::DatumType::Table, 0, 0}
+			REFLECT_FIELD("Condition", ActionListIf, _condition),
+			REFLECT_TABLE("Then", 0),
+			REFLECT_TABLE("Else", 0)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of ActionListIf share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> ActionListIf::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	void ActionListIf::Update(GameState& gameState)
@@ -28,13 +34,13 @@ namespace FieaGameEngine
 
 		if (_condition == 1)
 		{
-			Scope* actionScope = &(_orderList[_thenIndex]->second[0]);
+			Scope* actionScope = &(_table.At(_thenIndex).second[0]);
 			assert(actionScope->Is(Action::TypeIdClass()));
 			static_cast<Action*>(actionScope)->Update(gameState);
 		}
 		else
 		{
-			Scope* actionScope = &(_orderList[_elseIndex]->second[0]);
+			Scope* actionScope = &(_table.At(_elseIndex).second[0]);
 			assert(actionScope->Is(Action::TypeIdClass()));
 			static_cast<Action*>(actionScope)->Update(gameState);
 		}
@@ -19,6 +19,7 @@ namespace FieaGameEngine
 		virtual gsl::owner<ActionListIf*> Clone() const override;
 
 		static const Vector<Signature> Signatures();
+		static StaticSignatureList StaticSignatures();
 
 	private:
 		int _condition;
@@ -0,0 +1,211 @@
+#pragma once
+#include "Datum.h"
+#include "OrderedMap.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// AttributeView Class - Lazy range over a contiguous run of a Scope's entries, in insertion order. Iterating it yields an Entry of
+	/// (key, datum, index, isPrescribed) per attribute, read straight out of the table - nothing is copied and nothing is allocated.
+	/// Views are returned by Scope::Entries() and Attributed::AttributeEntries(), AuxiliaryEntries() and PrescribedEntries(). They are only
+	/// valid while the Scope they were taken from is alive and is not cleared.
+	/// </summary>
+	/// <typeparam name="TDatum">Datum for views of mutable Scopes, const Datum for views of const Scopes.</typeparam>
+	template <typename TDatum>
+	class AttributeView final
+	{
+	public:
+		/// <summary>
+		/// TableType - The table the view reads from, const for const views.
+		/// </summary>
+		using TableType = std::conditional_t<std::is_const_v<TDatum>, const OrderedMap<std::string, Datum>, OrderedMap<std::string, Datum>>;
+
+		/// <summary>
+		/// Entry - One attribute, as yielded by the view's iterators. Binds with structured bindings: auto [key, datum, index, isPrescribed].
+		/// </summary>
+		struct Entry final
+		{
+			/// <summary>
+			/// Name of the attribute.
+			/// </summary>
+			const std::string& key;
+
+			/// <summary>
+			/// The attribute's Datum, inside the Scope.
+			/// </summary>
+			TDatum& datum;
+
+			/// <summary>
+			/// Insertion index of the attribute within the Scope.
+			/// </summary>
+			size_t index;
+
+			/// <summary>
+			/// True if the attribute is one of an Attributed type's prescribed attributes. Always false for plain Scopes.
+			/// </summary>
+			bool isPrescribed;
+		};
+
+		/// <summary>
+		/// Forward Iterator Class for AttributeView. Yields Entries by value.
+		/// </summary>
+		class Iterator final
+		{
+			friend AttributeView;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = Entry;
+			using reference = Entry;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Defaulted Iterator Constructor
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Compares two Iterators for ! equality.
+			/// </summary>
+			/// <param name="other">Other Iterator to be compared</param>
+			/// <returns>True if any members are different. Elsewise false.</returns>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// Compares two Iterators for equality.
+			/// </summary>
+			/// <param name="other">Other Iterator to be compared</param>
+			/// <returns>True if both point at the same entry of the same table. Elsewise false.</returns>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// Increments the iterator to the next entry of the view.
+			/// </summary>
+			/// <returns>Iterator pointing to the next entry, or end() if none are left.</returns>
+			/// <exception cref="std::runtime_error">Calling operator++ on an unassociated iterator will throw a runtime error.</exception>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator to the next entry of the view, returning the unincremented Iterator.
+			/// </summary>
+			/// <returns>Copy of the original Iterator.</returns>
+			/// <exception cref="std::runtime_error">Calling operator++ on an unassociated iterator will throw a runtime error.</exception>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator - returns the entry the iterator is pointing to.
+			/// </summary>
+			/// <returns>Entry referring into the table.</returns>
+			/// <exception cref="std::runtime_error">Dereferencing an unassociated or end() iterator will throw a runtime error.</exception>
+			Entry operator*() const;
+
+		private:
+			/// <summary>
+			/// Private Iterator constructor used by the view.
+			/// </summary>
+			/// <param name="view">View the iterator walks. Only its bounds are copied, so the iterator may outlive the view object.</param>
+			/// <param name="index">Insertion index of the entry.</param>
+			Iterator(const AttributeView& view, size_t index);
+
+			/// <summary>
+			/// Address of the table being walked.
+			/// </summary>
+			TableType* _table = nullptr;
+
+			/// <summary>
+			/// Insertion index of the entry.
+			/// </summary>
+			size_t _index = 0;
+
+			/// <summary>
+			/// One past the last index of the view.
+			/// </summary>
+			size_t _end = 0;
+
+			/// <summary>
+			/// First index of the prescribed run.
+			/// </summary>
+			size_t _prescribedBegin = 0;
+
+			/// <summary>
+			/// One past the last index of the prescribed run.
+			/// </summary>
+			size_t _prescribedEnd = 0;
+
+			/// <summary>
+			/// True if the prescribed run is stepped over instead of visited.
+			/// </summary>
+			bool _skipPrescribed = false;
+		};
+
+		/// <summary>
+		/// Constructor - Views the entries [begin, end) of a table. Entries in [prescribedBegin, prescribedEnd) are reported as prescribed,
+		/// or skipped entirely if skipPrescribed is set.
+		/// </summary>
+		/// <param name="table">Table to view.</param>
+		/// <param name="begin">First index of the view.</param>
+		/// <param name="end">One past the last index of the view.</param>
+		/// <param name="prescribedBegin">First index of the prescribed run.</param>
+		/// <param name="prescribedEnd">One past the last index of the prescribed run. Equal to prescribedBegin if there is none.</param>
+		/// <param name="skipPrescribed">True to leave the prescribed run out of the view.</param>
+		AttributeView(TableType& table, size_t begin, size_t end, size_t prescribedBegin = 0, size_t prescribedEnd = 0, bool skipPrescribed = false);
+
+		/// <summary>
+		/// begin - Returns an Iterator to the first entry of the view.
+		/// </summary>
+		/// <returns>Iterator to the first entry, end() if the view is empty.</returns>
+		Iterator begin() const;
+
+		/// <summary>
+		/// end - Returns an Iterator one past the last entry of the view.
+		/// </summary>
+		/// <returns>Iterator one past the last entry.</returns>
+		Iterator end() const;
+
+		/// <summary>
+		/// Size - Returns the number of entries the view visits.
+		/// </summary>
+		/// <returns>The number of entries in the view.</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// IsEmpty - Returns a boolean indicating if the view visits no entries.
+		/// </summary>
+		/// <returns>True if the view is empty.</returns>
+		bool IsEmpty() const;
+
+	private:
+		/// <summary>
+		/// Address of the viewed table.
+		/// </summary>
+		TableType* _table;
+
+		/// <summary>
+		/// First index of the view.
+		/// </summary>
+		size_t _begin;
+
+		/// <summary>
+		/// One past the last index of the view.
+		/// </summary>
+		size_t _end;
+
+		/// <summary>
+		/// First index of the prescribed run.
+		/// </summary>
+		size_t _prescribedBegin;
+
+		/// <summary>
+		/// One past the last index of the prescribed run.
+		/// </summary>
+		size_t _prescribedEnd;
+
+		/// <summary>
+		/// True if the prescribed run is stepped over instead of visited.
+		/// </summary>
+		bool _skipPrescribed;
+	};
+}
+
+#include "AttributeView.inl"
@@ -0,0 +1,118 @@
+#include "AttributeView.h"
+
+namespace FieaGameEngine
+{
+#pragma region Iterator
+
+	template <typename TDatum>
+	inline AttributeView<TDatum>::Iterator::Iterator(const AttributeView& view, size_t index) :
+		_table(view._table), _index(index), _end(view._end), _prescribedBegin(view._prescribedBegin), _prescribedEnd(view._prescribedEnd), _skipPrescribed(view._skipPrescribed)
+	{
+		if (_skipPrescribed && _index >= _prescribedBegin && _index < _prescribedEnd)
+		{
+			_index = std::min(_prescribedEnd, _end);
+		}
+	}
+
+	template <typename TDatum>
+	inline bool AttributeView<TDatum>::Iterator::operator!=(const Iterator& other) const
+	{
+		return !(operator==(other));
+	}
+
+	template <typename TDatum>
+	inline bool AttributeView<TDatum>::Iterator::operator==(const Iterator& other) const
+	{
+		return _table == other._table && _index == other._index;
+	}
+
+	template <typename TDatum>
+	inline typename AttributeView<TDatum>::Iterator& AttributeView<TDatum>::Iterator::operator++()
+	{
+		if (_table == nullptr)
+		{
+			throw std::runtime_error("Attempting to increment an unassociated iterator. AttributeView::Iterator::operator++()");
+		}
+
+		if (_index < _end)
+		{
+			++_index;
+			if (_skipPrescribed && _index == _prescribedBegin)
+			{
+				_index = std::min(_prescribedEnd, _end);
+			}
+		}
+
+		return *this;
+	}
+
+	template <typename TDatum>
+	inline typename AttributeView<TDatum>::Iterator AttributeView<TDatum>::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		operator++();
+		return temp;
+	}
+
+	template <typename TDatum>
+	inline typename AttributeView<TDatum>::Entry AttributeView<TDatum>::Iterator::operator*() const
+	{
+		if (_table == nullptr || _index >= _end)
+		{
+			throw std::runtime_error("Attempting to dereference an unassociated or end iterator. AttributeView::Iterator::operator*()");
+		}
+
+		auto& [key, datum] = _table->At(_index);
+		return Entry{ key, datum, _index, _index >= _prescribedBegin && _index < _prescribedEnd };
+	}
+
+#pragma endregion
+
+#pragma region AttributeView
+
+	template <typename TDatum>
+	inline AttributeView<TDatum>::AttributeView(TableType& table, size_t begin, size_t end, size_t prescribedBegin, size_t prescribedEnd, bool skipPrescribed) :
+		_table(&table), _begin(begin), _end(end), _prescribedBegin(prescribedBegin), _prescribedEnd(prescribedEnd), _skipPrescribed(skipPrescribed)
+	{
+		assert(_begin <= _end && _end <= table.Size());
+		assert(_prescribedBegin <= _prescribedEnd);
+	}
+
+	template <typename TDatum>
+	inline typename AttributeView<TDatum>::Iterator AttributeView<TDatum>::begin() const
+	{
+		return Iterator(*this, _begin);
+	}
+
+	template <typename TDatum>
+	inline typename AttributeView<TDatum>::Iterator AttributeView<TDatum>::end() const
+	{
+		return Iterator(*this, _end);
+	}
+
+	template <typename TDatum>
+	inline size_t AttributeView<TDatum>::Size() const
+	{
+		size_t size = _end - _begin;
+		if (_skipPrescribed)
+		{
+			//	Take out the part of the prescribed run that overlaps the view
+			size_t overlapBegin = std::max(_begin, _prescribedBegin);
+			size_t overlapEnd = std::min(_end, _prescribedEnd);
+			if (overlapBegin < overlapEnd)
+			{
+				size -= overlapEnd - overlapBegin;
+			}
+		}
+
+		return size;
+	}
+
+	template <typename TDatum>
+	inline bool AttributeView<TDatum>::IsEmpty() const
+	{
+		return Size() == 0;
+	}
+
+#pragma endregion
+}
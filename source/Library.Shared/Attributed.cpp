@@ -7,19 +7,19 @@ namespace FieaGameEngine
 
 	Attributed::Attributed(RTTI::IdType typeID)
 	{
-		(*this)["this"] = this;
 		Populate(typeID);
+		(*this)["this"] = this;
 	}
 
 	Attributed::Attributed(const Attributed& other) :
-		Scope(other)
+		Scope(other), _prescribedCount(other._prescribedCount)
 	{
 		(*this)["this"] = this;
 		UpdateExternalStorage(other.TypeIdInstance());
 	}
 
 	Attributed::Attributed(Attributed&& other) noexcept :
-		Scope(std::move(other))
+		Scope(std::move(other)), _prescribedCount(other._prescribedCount)
 	{
 		(*this)["this"] = this;
 		UpdateExternalStorage(other.TypeIdInstance());
@@ -30,6 +30,7 @@ namespace FieaGameEngine
 		if (this != &other)
 		{
 			Scope::operator=(other);
+			_prescribedCount = other._prescribedCount;
 			(*this)["this"] = this;
 			UpdateExternalStorage(other.TypeIdInstance());
 		}
@@ -42,6 +43,7 @@ namespace FieaGameEngine
 		if (this != &other)
 		{
 			Scope::operator=(std::move(other));
+			_prescribedCount = other._prescribedCount;
 			(*this)["this"] = this;
 			UpdateExternalStorage(other.TypeIdInstance());
 		}
@@ -51,12 +53,10 @@ namespace FieaGameEngine
 	Vector<Signature> Attributed::Attributes() const
 	{
 		Vector<Signature> newVector;
-		newVector.Reserve(_orderList.Size());
-		for (size_t i = 0; i < Size(); ++i)
+		newVector.Reserve(Size());
+		for (const auto& entry : AttributeEntries())
 		{
-			auto& [key, datum] = *(_orderList[i]);
-			Signature entry = { key, datum.Type(), datum.Size(), i };
-			newVector.PushBack(entry);
+			newVector.PushBack(Signature{ entry.key, entry.datum.Type(), entry.datum.Size(), entry.index });
 		}
 
 		return newVector;
@@ -64,20 +64,48 @@ namespace FieaGameEngine
 
 	Vector<Signature> Attributed::AuxiliaryAttributes() const
 	{
+		const AttributeView<const Datum> auxiliary = AuxiliaryEntries();
+
 		Vector<Signature> newVector;
-		for (size_t i = 0; i < Size(); ++i)
+		newVector.Reserve(auxiliary.Size());
+		for (const auto& entry : auxiliary)
 		{
-			auto& [key, datum] = *(_orderList[i]);
-			if (!IsPrescribedAttribute(key))
-			{
-				Signature entry = { key, datum.Type(), datum.Size(), i };
-				newVector.PushBack(entry);
-			}
+			newVector.PushBack(Signature{ entry.key, entry.datum.Type(), entry.datum.Size(), entry.index });
 		}
 
 		return newVector;
 	}
 
+	AttributeView<Datum> Attributed::AttributeEntries()
+	{
+		return AttributeView<Datum>(_table, 0, Size(), 1, _prescribedCount + 1);
+	}
+
+	AttributeView<const Datum> Attributed::AttributeEntries() const
+	{
+		return AttributeView<const Datum>(_table, 0, Size(), 1, _prescribedCount + 1);
+	}
+
+	AttributeView<Datum> Attributed::AuxiliaryEntries()
+	{
+		return AttributeView<Datum>(_table, 0, Size(), 1, _prescribedCount + 1, true);
+	}
+
+	AttributeView<const Datum> Attributed::AuxiliaryEntries() const
+	{
+		return AttributeView<const Datum>(_table, 0, Size(), 1, _prescribedCount + 1, true);
+	}
+
+	AttributeView<Datum> Attributed::PrescribedEntries()
+	{
+		return AttributeView<Datum>(_table, 1, _prescribedCount + 1, 1, _prescribedCount + 1);
+	}
+
+	AttributeView<const Datum> Attributed::PrescribedEntries() const
+	{
+		return AttributeView<const Datum>(_table, 1, _prescribedCount + 1, 1, _prescribedCount + 1);
+	}
+
 	const Vector<Signature>& Attributed::PrescribedAttributes() const
 	{
 		return TypeManager::GetSignaturesForType(TypeIdInstance());
@@ -90,42 +118,43 @@ namespace FieaGameEngine
 
 	bool Attributed::IsPrescribedAttribute(const string& name) const
 	{
-		Vector<Signature> signatures = TypeManager::GetSignaturesForType(TypeIdInstance());
-		for (const Signature& signature : signatures)
-		{
-			if (signature.name == name)
-			{
-				return true;
-			}
-		}
-		return false;
+		auto it = _table.Find(name);
+		return it != _table.end() && IsPrescribedIndex(it.Index());
+	}
+
+	bool Attributed::IsPrescribedIndex(size_t index) const
+	{
+		return index >= 1 && index <= _prescribedCount;
+	}
+
+	size_t Attributed::PrescribedAttributeCount() const
+	{
+		return _prescribedCount;
 	}
 
 	bool Attributed::IsAuxiliaryAttribute(const string& name) const
 	{
-		if (IsAttribute(name))
-		{
-			if (!IsPrescribedAttribute(name))
-			{
-				return true;
-			}
-		}
-		return false;
+		auto it = _table.Find(name);
+		return it != _table.end() && !IsPrescribedIndex(it.Index());
 	}
 
 	void Attributed::Populate(RTTI::IdType typeID)
 	{
-		const auto signatures = TypeManager::GetSignaturesForType(typeID);
-		for (const auto& signature : signatures)
+		//	The keys, types and index come prebuilt from the TypeManager - only the bindings to this instance are made here
+		AssignLayout(TypeManager::GetLayoutForType(typeID));
+
+		const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(typeID);
+		_prescribedCount = signatures.Size();
+		for (size_t i = 0; i < signatures.Size(); ++i)
 		{
-			Datum& datum = Append(signature.name);
+			const Signature& signature = signatures[i];
+			Datum& datum = _table.At(i + 1).second;
 			if (signature.type == Datum::DatumType::Table)
 			{
-				datum.SetType(Datum::DatumType::Table);
 				if (signature.size > 0)
 				{
 					datum.Reserve(signature.size);
-					for (size_t i = 0; i < signature.size; ++i)
+					for (size_t j = 0; j < signature.size; ++j)
 					{
 						AppendScope(signature.name);
 					}
@@ -141,18 +170,15 @@ namespace FieaGameEngine
 
 	void Attributed::UpdateExternalStorage(RTTI::IdType typeID)
 	{
-		const Vector<Signature> signatures = TypeManager::GetSignaturesForType(typeID);
-		size_t prescribedAttributeCount = signatures.Size() + 1; // +1 for "this"
+		const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(typeID);
+		assert(signatures.Size() == _prescribedCount);
 
-		for (size_t i = 1; i < prescribedAttributeCount; ++i)
+		for (const auto& entry : PrescribedEntries())
 		{
-			const Signature& signature = signatures[i - 1];
-			auto& [key, datum] = *(_orderList[i]);
+			const Signature& signature = signatures[entry.index - 1];
+			Datum& datum = entry.datum;
+			assert(entry.key == signature.name);
 
-#if defined(NDEBUG)
-			UNREFERENCED_LOCAL(key);
-#endif
-			
 			if (signature.type != Datum::DatumType::Table)
 			{
 				//	All scopes should be internal data
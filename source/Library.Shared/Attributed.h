@@ -86,6 +86,70 @@ namespace FieaGameEngine
 		/// <returns>True if an attribute exists with a matching name that is inside of the class's signature array, otherwise false.</returns>
 		bool IsPrescribedAttribute(const string& name) const;
 
+		/// <summary>
+		/// IsPrescribedIndex - returns a boolean value indicating if the attribute at the passed insertion index is prescribed. Prescribed attributes always occupy
+		/// indices 1 through PrescribedAttributeCount(), directly after "this", so this is a range check.
+		/// </summary>
+		/// <param name="index">Insertion index of the attribute within the scope.</param>
+		/// <returns>True if the attribute at index is a prescribed attribute, otherwise false.</returns>
+		bool IsPrescribedIndex(size_t index) const;
+
+		/// <summary>
+		/// PrescribedAttributeCount - Returns the number of prescribed attributes, not counting "this".
+		/// </summary>
+		/// <returns>The size of the class's signature array.</returns>
+		size_t PrescribedAttributeCount() const;
+
+		/// <summary>
+		/// ForEachAuxiliaryAttribute - Calls func(key, datum, index) for "this" and every auxiliary attribute, in insertion order, without allocating.
+		/// </summary>
+		/// <param name="func">Callable taking (const string&amp;, Datum&amp;, size_t).</param>
+		template <typename TFunctor>
+		void ForEachAuxiliaryAttribute(TFunctor func);
+
+		/// <summary>
+		/// ForEachAuxiliaryAttribute - Calls func(key, datum, index) for "this" and every auxiliary attribute, in insertion order, without allocating. Const version
+		/// </summary>
+		/// <param name="func">Callable taking (const string&amp;, const Datum&amp;, size_t).</param>
+		template <typename TFunctor>
+		void ForEachAuxiliaryAttribute(TFunctor func) const;
+
+		/// <summary>
+		/// AttributeEntries - Returns a view of every attribute as (key, Datum, index, isPrescribed), in insertion order, without allocating.
+		/// </summary>
+		/// <returns>View over all of the attributes.</returns>
+		AttributeView<Datum> AttributeEntries();
+
+		/// <summary>
+		/// AttributeEntries - Returns a view of every attribute as (key, Datum, index, isPrescribed), in insertion order, without allocating. Const version
+		/// </summary>
+		/// <returns>Read only view over all of the attributes.</returns>
+		AttributeView<const Datum> AttributeEntries() const;
+
+		/// <summary>
+		/// AuxiliaryEntries - Returns a view of "this" and every auxiliary attribute, in insertion order, without allocating.
+		/// </summary>
+		/// <returns>View over the auxiliary attributes.</returns>
+		AttributeView<Datum> AuxiliaryEntries();
+
+		/// <summary>
+		/// AuxiliaryEntries - Returns a view of "this" and every auxiliary attribute, in insertion order, without allocating. Const version
+		/// </summary>
+		/// <returns>Read only view over the auxiliary attributes.</returns>
+		AttributeView<const Datum> AuxiliaryEntries() const;
+
+		/// <summary>
+		/// PrescribedEntries - Returns a view of the prescribed attributes, in signature order, without allocating.
+		/// </summary>
+		/// <returns>View over the prescribed attributes.</returns>
+		AttributeView<Datum> PrescribedEntries();
+
+		/// <summary>
+		/// PrescribedEntries - Returns a view of the prescribed attributes, in signature order, without allocating. Const version
+		/// </summary>
+		/// <returns>Read only view over the prescribed attributes.</returns>
+		AttributeView<const Datum> PrescribedEntries() const;
+
 		/// <summary>
 		/// AppendAuxiliaryAttribute - Appends a datum to this attributed scope that did not exist as a prescribed attribute.
 		/// </summary>
@@ -123,8 +187,8 @@ namespace FieaGameEngine
 
 	private:
 		/// <summary>
-		/// Populate - Binds all prescribed attributed to datum/scopes and attaches them to the Attributed Scope. Utilized the typeID in order to retrieve the
-		/// signature vector from the TypeManager and iterates through it creating the datums and scopes.
+		/// Populate - Binds all prescribed attributed to datum/scopes and attaches them to the Attributed Scope. Copies the type's prebuilt layout from the
+		/// TypeManager, then iterates through its signature vector binding each datum to its member and creating any nested scopes.
 		/// </summary>
 		/// <param name="typeID">TypeID of the class that is being bound to the attributed scope.</param>
 		void Populate(RTTI::IdType typeID);
@@ -134,6 +198,13 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="typeID">TypeID of the class that owns the signature array for updating.</param>
 		void UpdateExternalStorage(RTTI::IdType typeID);
+
+		/// <summary>
+		/// Number of prescribed attributes, set by Populate() and carried over by copies and moves.
+		/// </summary>
+		size_t _prescribedCount = 0;
 	};
 }
 
+#include "Attributed.inl"
+
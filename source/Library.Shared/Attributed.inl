@@ -0,0 +1,22 @@
+#include "Attributed.h"
+
+namespace FieaGameEngine
+{
+	template <typename TFunctor>
+	inline void Attributed::ForEachAuxiliaryAttribute(TFunctor func)
+	{
+		for (const auto& entry : AuxiliaryEntries())
+		{
+			func(entry.key, entry.datum, entry.index);
+		}
+	}
+
+	template <typename TFunctor>
+	inline void Attributed::ForEachAuxiliaryAttribute(TFunctor func) const
+	{
+		for (const auto& entry : AuxiliaryEntries())
+		{
+			func(entry.key, entry.datum, entry.index);
+		}
+	}
+}
@@ -10,20 +10,26 @@ namespace FieaGameEngine
 	{
 	}
 
-	const Vector<Signature> Avatar::Signatures()
+	StaticSignatureList Avatar::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(Avatar, _name)},
-			{"Transform", Datum::DatumType::Matrix, 1, offsetof(Avatar, _transform)},
-			{"Actions", Datum::DatumType::Table, 0, 0},
-			{"Children", Datum::DatumType::Table, 0, 0},
-			{"Health", Datum::DatumType::Integer, 1, offsetof(Avatar, _health)},
-			{"Velocity", Datum::DatumType::Vector, 1, offsetof(Avatar, _velocity)},
-			{"Dps", Datum::DatumType::Float, 1, offsetof(Avatar, _dps)}
+			REFLECT_FIELD("Name", Avatar, _name),
+			REFLECT_FIELD("Transform", Avatar, _transform),
+			REFLECT_TABLE("Actions", 0),
+			REFLECT_TABLE("Children", 0),
+			REFLECT_FIELD("Health", Avatar, _health),
+			REFLECT_FIELD("Velocity", Avatar, _velocity),
+			REFLECT_FIELD("Dps", Avatar, _dps)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of Avatar share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> Avatar::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	void Avatar::Update(GameState& gameState)
@@ -68,6 +68,12 @@ namespace FieaGameEngine
 		/// <returns>Vector of Signatures for this class.</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// StaticSignatures - Returns the compile time signatures of the prescribed attributes, declared with REFLECT_FIELD. Register with TypeManager::AddType&lt;Avatar&gt;().
+		/// </summary>
+		/// <returns>View of the static signature array.</returns>
+		static StaticSignatureList StaticSignatures();
+
 		/// <summary>
 		/// Update - Called by the hierarchy in order to update the game object on tick. Currently just sets the health to a different value for testing.
 		/// </summary>
@@ -0,0 +1,138 @@
+#include "pch.h"
+#include "Base64.h"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		constexpr char Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+		/// <summary>
+		/// Invalid - Flag above the 24 bits of a decoded quad. Characters outside the alphabet decode to it, so or-ing every quad together
+		/// catches them all with one test at the end.
+		/// </summary>
+		constexpr std::uint32_t Invalid = 0x01000000;
+
+		/// <summary>
+		/// Each table holds a character's 6 bits already shifted to their place in the 24 bits of its quad, for the character at that position.
+		/// </summary>
+		constexpr std::array<std::uint32_t, 256> MakeTable(unsigned int shift)
+		{
+			std::array<std::uint32_t, 256> table{};
+			for (auto& entry : table)
+			{
+				entry = Invalid;
+			}
+
+			for (std::uint32_t i = 0; i < 64; ++i)
+			{
+				table[static_cast<unsigned char>(Alphabet[i])] = i << shift;
+			}
+			return table;
+		}
+
+		constexpr std::array<std::uint32_t, 256> Table0 = MakeTable(18);
+		constexpr std::array<std::uint32_t, 256> Table1 = MakeTable(12);
+		constexpr std::array<std::uint32_t, 256> Table2 = MakeTable(6);
+		constexpr std::array<std::uint32_t, 256> Table3 = MakeTable(0);
+
+		inline std::uint32_t DecodeQuad(const unsigned char* quad)
+		{
+			return Table0[quad[0]] | Table1[quad[1]] | Table2[quad[2]] | Table3[quad[3]];
+		}
+	}
+
+	std::string Base64::Encode(const void* data, std::size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		std::string text;
+		text.reserve((size + 2) / 3 * 4);
+
+		std::size_t i = 0;
+		for (; i + 3 <= size; i += 3)
+		{
+			const std::uint32_t triple = (std::uint32_t(bytes[i]) << 16) | (std::uint32_t(bytes[i + 1]) << 8) | bytes[i + 2];
+			text.push_back(Alphabet[(triple >> 18) & 63]);
+			text.push_back(Alphabet[(triple >> 12) & 63]);
+			text.push_back(Alphabet[(triple >> 6) & 63]);
+			text.push_back(Alphabet[triple & 63]);
+		}
+
+		if (i < size)
+		{
+			const bool hasSecond = i + 1 < size;
+			const std::uint32_t triple = (std::uint32_t(bytes[i]) << 16) | (hasSecond ? std::uint32_t(bytes[i + 1]) << 8 : 0);
+			text.push_back(Alphabet[(triple >> 18) & 63]);
+			text.push_back(Alphabet[(triple >> 12) & 63]);
+			text.push_back(hasSecond ? Alphabet[(triple >> 6) & 63] : '=');
+			text.push_back('=');
+		}
+
+		return text;
+	}
+
+	std::size_t Base64::DecodedSize(std::string_view text)
+	{
+		if (text.size() % 4 != 0)
+		{
+			throw std::runtime_error("Base64 text must be a multiple of four characters long.");
+		}
+
+		if (text.empty())
+		{
+			return 0;
+		}
+
+		const std::size_t padding = (text.back() == '=') + (text[text.size() - 2] == '=');
+		return text.size() / 4 * 3 - padding;
+	}
+
+	std::size_t Base64::Decode(std::string_view text, void* out)
+	{
+		const std::size_t size = DecodedSize(text);
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		const unsigned char* in = reinterpret_cast<const unsigned char*>(text.data());
+		unsigned char* bytes = static_cast<unsigned char*>(out);
+
+		//	Every quad but the last is whole, the last may be padded
+		const std::size_t wholeQuads = text.size() / 4 - 1;
+		std::uint32_t invalid = 0;
+		for (std::size_t quad = 0; quad < wholeQuads; ++quad, in += 4, bytes += 3)
+		{
+			const std::uint32_t triple = DecodeQuad(in);
+			invalid |= triple;
+			bytes[0] = static_cast<unsigned char>(triple >> 16);
+			bytes[1] = static_cast<unsigned char>(triple >> 8);
+			bytes[2] = static_cast<unsigned char>(triple);
+		}
+
+		const std::size_t tail = size - wholeQuads * 3;
+		const unsigned char padding = static_cast<unsigned char>('A');
+		const unsigned char last[4] = { in[0], in[1], tail > 1 ? in[2] : padding, tail > 2 ? in[3] : padding };
+		const std::uint32_t triple = DecodeQuad(last);
+		invalid |= triple;
+		bytes[0] = static_cast<unsigned char>(triple >> 16);
+		if (tail > 1)
+		{
+			bytes[1] = static_cast<unsigned char>(triple >> 8);
+		}
+		if (tail > 2)
+		{
+			bytes[2] = static_cast<unsigned char>(triple);
+		}
+
+		if ((invalid & Invalid) != 0)
+		{
+			throw std::runtime_error("Base64 text contains characters outside the base64 alphabet.");
+		}
+
+		return size;
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Base64 Class - Standard padded base64, used to embed binary arrays in Json text. The decoder turns four characters into three bytes with
+	/// four table lookups and no branches, checking the whole text for invalid characters once at the end.
+	/// </summary>
+	class Base64 final
+	{
+	public:
+		Base64() = delete;
+
+		/// <summary>
+		/// Encode - Encodes bytes as padded base64.
+		/// </summary>
+		/// <param name="data">Address of the first byte.</param>
+		/// <param name="size">Number of bytes.</param>
+		/// <returns>The base64 text.</returns>
+		static std::string Encode(const void* data, std::size_t size);
+
+		/// <summary>
+		/// DecodedSize - Number of bytes text decodes to.
+		/// </summary>
+		/// <param name="text">Padded base64 text.</param>
+		/// <returns>Size of the decoded bytes.</returns>
+		/// <exception cref="std::runtime_error">Throws if the length of text isn't a multiple of four.</exception>
+		static std::size_t DecodedSize(std::string_view text);
+
+		/// <summary>
+		/// Decode - Decodes text into DecodedSize(text) bytes at out.
+		/// </summary>
+		/// <param name="text">Padded base64 text.</param>
+		/// <param name="out">Address of the first byte to write. Can be anywhere, no alignment is needed.</param>
+		/// <returns>Number of bytes written.</returns>
+		/// <exception cref="std::runtime_error">Throws if text isn't valid base64. Bytes may have been written by then.</exception>
+		static std::size_t Decode(std::string_view text, void* out);
+	};
+}
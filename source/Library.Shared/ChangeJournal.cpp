@@ -0,0 +1,107 @@
+#include "pch.h"
+#include "ChangeJournal.h"
+
+namespace FieaGameEngine
+{
+	ChangeJournal::Suppression::Suppression()
+	{
+		++_suppressed;
+	}
+
+	ChangeJournal::Suppression::~Suppression()
+	{
+		assert(_suppressed > 0);
+		--_suppressed;
+	}
+
+	void ChangeJournal::Enable(size_t capacity)
+	{
+		if (capacity == 0)
+		{
+			throw std::runtime_error("ChangeJournal capacity must be greater than 0.");
+		}
+
+		//	Drop the old buffer first so a smaller capacity actually shrinks it.
+		_entries.Clear();
+		_entries.ShrinkToFit();
+		_entries.Reserve(capacity);
+
+		_capacity = capacity;
+		_head = 0;
+		_dropped = 0;
+		_enabled = true;
+		++_epoch;
+	}
+
+	void ChangeJournal::Disable()
+	{
+		_enabled = false;
+		_entries.Clear();
+		_entries.ShrinkToFit();
+		_capacity = 0;
+		_head = 0;
+		_dropped = 0;
+	}
+
+	size_t ChangeJournal::Epoch()
+	{
+		return _epoch;
+	}
+
+	void ChangeJournal::Record(const Scope* scope, const std::string& key, size_t index, ChangeType type)
+	{
+		if (IsEnabled() == false)
+		{
+			return;
+		}
+
+		if (_entries.Size() < _capacity)
+		{
+			_entries.PushBack(Entry{ scope, key, index, type });
+		}
+		else
+		{
+			//	Full - overwrite the oldest entry in place.
+			Entry& oldest = _entries[_head];
+			oldest._scope = scope;
+			oldest._key = key;
+			oldest._index = index;
+			oldest._type = type;
+
+			_head = (_head + 1) % _capacity;
+			++_dropped;
+		}
+	}
+
+	size_t ChangeJournal::Size()
+	{
+		return _entries.Size();
+	}
+
+	size_t ChangeJournal::Capacity()
+	{
+		return _capacity;
+	}
+
+	size_t ChangeJournal::DroppedCount()
+	{
+		return _dropped;
+	}
+
+	const ChangeJournal::Entry& ChangeJournal::At(size_t index)
+	{
+		if (index >= _entries.Size())
+		{
+			throw std::runtime_error("Attempting to access a ChangeJournal entry beyond Size().");
+		}
+
+		return _entries[(_head + index) % _entries.Size()];
+	}
+
+	void ChangeJournal::Checkpoint()
+	{
+		_entries.Clear();
+		_head = 0;
+		_dropped = 0;
+	}
+}
@@ -0,0 +1,227 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	class Scope;
+
+	/// <summary>
+	/// Singleton ChangeJournal class - Optional, bounded record of the mutations made to Scopes and Datums since the last checkpoint.
+	/// While enabled, Datum Set/PushBack/RemoveAt and Scope Append/Adopt/Orphan mark their owners dirty and append an entry here.
+	/// While disabled (the default) the only cost to those calls is a single branch on IsEnabled().
+	/// Recording isn't thread safe: other threads must only mutate Scopes while the journal is disabled, or suppressed on them (see Suppression).
+	/// </summary>
+	class ChangeJournal final
+	{
+	public:
+
+		/// <summary>
+		/// ChangeType - Describes which mutation produced a journal entry. Resize covers Datum Clear/Resize/assignment, with the new size as the index.
+		/// </summary>
+		enum class ChangeType
+		{
+			Set,
+			PushBack,
+			RemoveAt,
+			Resize,
+			Append,
+			Adopt,
+			Orphan
+		};
+
+		/// <summary>
+		/// Entry - A single (scope, key, index) mutation. The scope address is for identification only and may dangle once the scope is destroyed.
+		/// </summary>
+		struct Entry final
+		{
+			/// <summary>
+			/// Address of the scope that owns the mutated key.
+			/// </summary>
+			const Scope* _scope;
+
+			/// <summary>
+			/// Key of the Datum that was mutated within _scope.
+			/// </summary>
+			std::string _key;
+
+			/// <summary>
+			/// Index within the Datum that was mutated (or where the child was adopted/orphaned).
+			/// </summary>
+			size_t _index;
+
+			/// <summary>
+			/// The kind of mutation that was recorded.
+			/// </summary>
+			ChangeType _type;
+		};
+
+		/// <summary>
+		/// Suppression - While one is alive, IsEnabled() is false on the thread that made it: nothing that thread does is journaled or marked dirty.
+		/// For work that doesn't change what a tree holds, such as filling a lazy placeholder, and for threads building trees the journal
+		/// mustn't see until they are adopted. Suppressions nest.
+		/// </summary>
+		class Suppression final
+		{
+		public:
+			/// <summary>
+			/// Constructor - Suppresses tracking on this thread.
+			/// </summary>
+			Suppression();
+
+			Suppression(const Suppression&) = delete;
+			Suppression& operator=(const Suppression&) = delete;
+			Suppression(Suppression&&) = delete;
+			Suppression& operator=(Suppression&&) = delete;
+
+			/// <summary>
+			/// Destructor - Ends this suppression. Tracking resumes once every suppression on the thread has ended.
+			/// </summary>
+			~Suppression();
+		};
+
+		/// <summary>
+		/// Default number of entries kept in the journal before the oldest entries are overwritten.
+		/// </summary>
+		inline static const size_t DefaultCapacity = 1024;
+
+		/// <summary>
+		/// Constructor - deleted to prevent instantiation.
+		/// </summary>
+		ChangeJournal() = delete;
+
+		/// <summary>
+		/// Copy constructor - deleted to prevent instantiation.
+		/// </summary>
+		ChangeJournal(const ChangeJournal& other) = delete;
+
+		/// <summary>
+		/// Move constructor - deleted to prevent instantiation.
+		/// </summary>
+		ChangeJournal(ChangeJournal&& other) = delete;
+
+		/// <summary>
+		/// Copy Assignment operator - deleted to prevent instantiation.
+		/// </summary>
+		ChangeJournal& operator=(const ChangeJournal& other) = delete;
+
+		/// <summary>
+		/// Move Assignment operator - deleted to prevent instantiation.
+		/// </summary>
+		ChangeJournal& operator=(ChangeJournal&& other) = delete;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~ChangeJournal() = default;
+
+		/// <summary>
+		/// Enable - Turns on dirty tracking and journaling. Allocates the ring buffer once, so recording never allocates for the buffer itself.
+		/// Every call starts a new tracking epoch, which tells incremental savers that dirty bits recorded before now can't be trusted.
+		/// </summary>
+		/// <param name="capacity">Maximum number of entries kept before the oldest are dropped.</param>
+		/// <exception cref="std::runtime_error">Throws if capacity is 0.</exception>
+		static void Enable(size_t capacity = DefaultCapacity);
+
+		/// <summary>
+		/// Disable - Turns off dirty tracking and journaling and releases the ring buffer.
+		/// </summary>
+		static void Disable();
+
+		/// <summary>
+		/// IsEnabled - Returns whether mutations are currently being tracked on this thread. Checked inline by every tracked mutation.
+		/// </summary>
+		/// <returns>True if tracking is on and not suppressed on this thread.</returns>
+		static bool IsEnabled();
+
+		/// <summary>
+		/// Epoch - Returns the tracking epoch. Incremented on every Enable(). Zero means tracking has never been enabled.
+		/// </summary>
+		/// <returns>The current tracking epoch.</returns>
+		static size_t Epoch();
+
+		/// <summary>
+		/// Record - Appends an entry to the journal. Overwrites the oldest entry when full. Does nothing when disabled.
+		/// </summary>
+		/// <param name="scope">Scope that owns the mutated key.</param>
+		/// <param name="key">Key of the mutated Datum.</param>
+		/// <param name="index">Index within the Datum that was mutated.</param>
+		/// <param name="type">The kind of mutation.</param>
+		static void Record(const Scope* scope, const std::string& key, size_t index, ChangeType type);
+
+		/// <summary>
+		/// Size - Returns the number of entries currently held.
+		/// </summary>
+		/// <returns>Number of entries in the journal.</returns>
+		static size_t Size();
+
+		/// <summary>
+		/// Capacity - Returns the maximum number of entries the journal holds.
+		/// </summary>
+		/// <returns>The journal capacity, 0 if disabled.</returns>
+		static size_t Capacity();
+
+		/// <summary>
+		/// DroppedCount - Returns how many entries have been overwritten since the last Checkpoint(). Non-zero means the journal alone
+		/// can't reconstruct every change and the dirty bits should be relied upon instead.
+		/// </summary>
+		/// <returns>Number of entries lost to overflow.</returns>
+		static size_t DroppedCount();
+
+		/// <summary>
+		/// At - Returns the entry at the given position, 0 being the oldest.
+		/// </summary>
+		/// <param name="index">Position of the entry, oldest first.</param>
+		/// <returns>Reference to the entry.</returns>
+		/// <exception cref="std::runtime_error">Throws if index >= Size().</exception>
+		static const Entry& At(size_t index);
+
+		/// <summary>
+		/// Checkpoint - Discards all entries and resets the dropped count, keeping the buffer allocated. Call after a save.
+		/// </summary>
+		static void Checkpoint();
+
+	private:
+
+		/// <summary>
+		/// Whether tracking is on. Read by the inline mutation hooks, atomic as threads that suppress tracking still read it.
+		/// </summary>
+		inline static std::atomic<bool> _enabled{ false };
+
+		/// <summary>
+		/// Number of live Suppressions on this thread.
+		/// </summary>
+		inline static thread_local size_t _suppressed = 0;
+
+		/// <summary>
+		/// Tracking epoch, incremented on Enable().
+		/// </summary>
+		inline static size_t _epoch = 0;
+
+		/// <summary>
+		/// Ring buffer of entries. Reserved to capacity on Enable() and never grown past it.
+		/// </summary>
+		inline static Vector<Entry> _entries;
+
+		/// <summary>
+		/// Position of the oldest entry in _entries once the buffer has wrapped.
+		/// </summary>
+		inline static size_t _head = 0;
+
+		/// <summary>
+		/// Maximum number of entries.
+		/// </summary>
+		inline static size_t _capacity = 0;
+
+		/// <summary>
+		/// Entries overwritten since the last checkpoint.
+		/// </summary>
+		inline static size_t _dropped = 0;
+	};
+
+	inline bool ChangeJournal::IsEnabled()
+	{
+		return _enabled.load(std::memory_order_relaxed) && _suppressed == 0;
+	}
+}
@@ -0,0 +1,205 @@
+#pragma once
+#include <mutex>
+#include <utility>
+#include "DefaultEquality.h"
+#include "DefaultHash.h"
+#include "FrozenMap.h"
+#include "Rcu.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// ConcurrentHashMap Class - HashMap for read-mostly data shared between threads, such as the global registries. Lookups take no lock: they read the
+	/// published table inside an Rcu::ReadGuard. Writers are serialized by a mutex and publish a copy of the table with their change, retiring the old one.
+	/// Entries live in nodes of their own that every table version points to, so a writer only copies pointers and a found value stays where it is
+	/// until its key is removed. Once the map stops changing it can be frozen: lookups then go through a perfect hash of the current entries until
+	/// the next write.
+	/// </summary>
+	template <typename TKey, typename TData, typename HashFunctor = DefaultHash<TKey>, typename EqualityFunctor = DefaultEquality<TKey>>
+	class ConcurrentHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using value_type = PairType;
+		using mapped_type = TData;
+
+		/// <summary>
+		/// Constructor - Creates an empty map. Nothing is allocated until the first Insert or Reserve.
+		/// </summary>
+		ConcurrentHashMap() = default;
+
+		/// <summary>
+		/// Constructor - Creates an empty map with room for capacity entries.
+		/// </summary>
+		/// <param name="capacity">Number of entries the map can hold before its table grows.</param>
+		explicit ConcurrentHashMap(size_t capacity);
+
+		ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+		ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+
+		/// <summary>
+		/// Destructor - Deletes the table and its entries. No other thread may be using the map anymore.
+		/// </summary>
+		~ConcurrentHashMap();
+
+		/// <summary>
+		/// Find - Looks up a key without taking a lock.
+		/// </summary>
+		/// <param name="key">Key to look up.</param>
+		/// <returns>Address of the key's value, nullptr if the key isn't in the map. Valid until the key is removed.</returns>
+		const TData* Find(const TKey& key) const;
+
+		/// <summary>
+		/// ContainsKey - Checks if a key is in the map.
+		/// </summary>
+		/// <param name="key">Key to look up.</param>
+		/// <returns>True if the key is in the map, else false.</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// At - Returns the value of a key that must be in the map.
+		/// </summary>
+		/// <param name="key">Key to look up.</param>
+		/// <returns>Reference to the key's value. Valid until the key is removed.</returns>
+		/// <exception cref="std::runtime_error">Throws if the key isn't in the map.</exception>
+		const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// Insert - Adds an entry if its key isn't in the map yet.
+		/// </summary>
+		/// <param name="pair">Key and value to add.</param>
+		/// <returns>True if the entry was added, false if the key was already in the map.</returns>
+		bool Insert(const PairType& pair);
+
+		/// <summary>
+		/// Insert - Adds an entry if its key isn't in the map yet.
+		/// </summary>
+		/// <param name="pair">Key and value to add.</param>
+		/// <returns>True if the entry was added, false if the key was already in the map.</returns>
+		bool Insert(PairType&& pair);
+
+		/// <summary>
+		/// Remove - Removes a key and its value. The value is deleted once no reader can be using it.
+		/// </summary>
+		/// <param name="key">Key to remove.</param>
+		/// <returns>True if the key was in the map, else false.</returns>
+		bool Remove(const TKey& key);
+
+		/// <summary>
+		/// Reserve - Grows the table so count entries fit without another resize.
+		/// </summary>
+		/// <param name="count">Number of entries wanted.</param>
+		void Reserve(size_t count);
+
+		/// <summary>
+		/// Clear - Removes every entry.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Freeze - Builds a FrozenMap of the current entries and sends lookups through it. The next Insert, Remove or Clear drops it again.
+		/// Only available for key types FrozenHash supports.
+		/// </summary>
+		void Freeze();
+
+		/// <summary>
+		/// IsFrozen - Tells you if lookups currently go through a FrozenMap.
+		/// </summary>
+		bool IsFrozen() const;
+
+		/// <summary>
+		/// Size - Returns the number of entries.
+		/// </summary>
+		size_t Size() const;
+
+		/// <summary>
+		/// IsEmpty - Tells you if the map has no entries.
+		/// </summary>
+		bool IsEmpty() const;
+
+	private:
+		/// <summary>
+		/// Node - An entry and the hash of its key. Shared by every table version it appears in.
+		/// </summary>
+		struct Node final
+		{
+			PairType _pair;
+			size_t _hash;
+		};
+
+		/// <summary>
+		/// Table - One version of the map: open addressed slots pointing at nodes, with linear probing. Never more than half full.
+		/// </summary>
+		struct Table final
+		{
+			explicit Table(size_t capacity);
+			Table(const Table&) = delete;
+			Table& operator=(const Table&) = delete;
+			~Table();
+
+			/// <summary>
+			/// Index of the first slot to probe for a hash.
+			/// </summary>
+			size_t Home(size_t hash) const;
+
+			/// <summary>
+			/// Finds the node of a key, nullptr if there is none.
+			/// </summary>
+			const Node* Find(const TKey& key, size_t hash) const;
+
+			/// <summary>
+			/// Puts a node in the first free slot of its probe sequence.
+			/// </summary>
+			void Place(const Node& node);
+
+			size_t _capacity;
+			size_t _size = 0;
+			unsigned int _shift;
+			gsl::owner<const Node**> _slots;
+		};
+
+		/// <summary>
+		/// FrozenTable - Perfect hash of the entries, pointing at their values in the nodes.
+		/// </summary>
+		using FrozenTable = FrozenMap<TKey, const TData*>;
+
+		/// <summary>
+		/// Smallest table allocated.
+		/// </summary>
+		static constexpr size_t MinCapacity = 8;
+
+		/// <summary>
+		/// Capacity of the table that holds count entries, never less than the current table's.
+		/// </summary>
+		static size_t CapacityFor(size_t count, const Table* table);
+
+		/// <summary>
+		/// Copies a table's nodes into a new table of the given capacity, leaving out skip.
+		/// </summary>
+		static gsl::owner<Table*> Copy(const Table* table, size_t capacity, const Node* skip = nullptr);
+
+		/// <summary>
+		/// Publishes a table with node added, or deletes node if its key is already in the map.
+		/// </summary>
+		bool Insert(gsl::owner<Node*> node);
+
+		/// <summary>
+		/// _table - The published table, nullptr while the map is empty.
+		/// </summary>
+		RcuPointer<Table> _table;
+
+		/// <summary>
+		/// _frozen - Perfect hash of _table's entries, nullptr unless the map is frozen.
+		/// </summary>
+		RcuPointer<FrozenTable> _frozen;
+
+		/// <summary>
+		/// _writeMutex - Serializes writers.
+		/// </summary>
+		std::mutex _writeMutex;
+	};
+}
+
+#include "ConcurrentHashMap.inl"
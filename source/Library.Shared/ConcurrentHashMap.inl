@@ -0,0 +1,277 @@
+#include "pch.h"
+#include "ConcurrentHashMap.h"
+
+namespace FieaGameEngine
+{
+#pragma region Table
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Table::Table(size_t capacity) :
+		_capacity(capacity), _shift(64), _slots(new const Node* [capacity]())
+	{
+		assert(capacity >= MinCapacity && (capacity & (capacity - 1)) == 0);
+		for (size_t i = capacity; i > 1; i >>= 1)
+		{
+			--_shift;
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Table::~Table()
+	{
+		delete[] _slots;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Table::Home(size_t hash) const
+	{
+		//	Fibonacci hashing spreads the clustered values of the additive hashes over the whole table
+		return static_cast<size_t>((static_cast<std::uint64_t>(hash) * 11400714819323198485ull) >> _shift);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline auto ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Table::Find(const TKey& key, size_t hash) const -> const Node*
+	{
+		const EqualityFunctor equal;
+		for (size_t i = Home(hash); _slots[i] != nullptr; i = (i + 1) & (_capacity - 1))
+		{
+			const Node* node = _slots[i];
+			if (node->_hash == hash && equal(node->_pair.first, key))
+			{
+				return node;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline void ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Table::Place(const Node& node)
+	{
+		size_t i = Home(node._hash);
+		while (_slots[i] != nullptr)
+		{
+			i = (i + 1) & (_capacity - 1);
+		}
+
+		_slots[i] = &node;
+		++_size;
+	}
+#pragma endregion
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::ConcurrentHashMap(size_t capacity)
+	{
+		Reserve(capacity);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::~ConcurrentHashMap()
+	{
+		gsl::owner<const Table*> table = _table.Exchange(nullptr);
+		if (table != nullptr)
+		{
+			for (size_t i = 0; i < table->_capacity; ++i)
+			{
+				delete table->_slots[i];
+			}
+			delete table;
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline const TData* ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Find(const TKey& key) const
+	{
+		Rcu::ReadGuard guard;
+		const FrozenTable* frozen = _frozen.Load();
+		if (frozen != nullptr)
+		{
+			const TData* const* data = frozen->Find(key);
+			return (data != nullptr ? *data : nullptr);
+		}
+
+		const Table* table = _table.Load();
+		const Node* node = (table != nullptr ? table->Find(key, HashFunctor{}(key)) : nullptr);
+		return (node != nullptr ? &node->_pair.second : nullptr);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::ContainsKey(const TKey& key) const
+	{
+		return Find(key) != nullptr;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline const TData& ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::At(const TKey& key) const
+	{
+		const TData* data = Find(key);
+		if (data == nullptr)
+		{
+			throw std::runtime_error("Key not found with At()");
+		}
+
+		return *data;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Insert(const PairType& pair)
+	{
+		return Insert(new Node{ pair, HashFunctor{}(pair.first) });
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Insert(PairType&& pair)
+	{
+		const size_t hash = HashFunctor{}(pair.first);
+		return Insert(new Node{ std::move(pair), hash });
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Insert(gsl::owner<Node*> node)
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		const Table* table = _table.Load();
+		gsl::owner<Table*> copy = nullptr;
+		try
+		{
+			if (table != nullptr && table->Find(node->_pair.first, node->_hash) != nullptr)
+			{
+				delete node;
+				return false;
+			}
+
+			copy = Copy(table, CapacityFor((table != nullptr ? table->_size : 0) + 1, table));
+		}
+		catch (...)
+		{
+			delete node;
+			throw;
+		}
+
+		copy->Place(*node);
+		_frozen.Store(nullptr);
+		_table.Store(copy);
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Remove(const TKey& key)
+	{
+		const size_t hash = HashFunctor{}(key);
+
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		const Table* table = _table.Load();
+		const Node* node = (table != nullptr ? table->Find(key, hash) : nullptr);
+		if (node == nullptr)
+		{
+			return false;
+		}
+
+		//	Unpublished before it is retired, so readers that can still see it hold it back
+		_frozen.Store(nullptr);
+		_table.Store(table->_size > 1 ? Copy(table, table->_capacity, node) : nullptr);
+		Rcu::Retire(node);
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline void ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Reserve(size_t count)
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		const Table* table = _table.Load();
+		const size_t capacity = CapacityFor(count, table);
+		if (table == nullptr || capacity > table->_capacity)
+		{
+			_table.Store(Copy(table, capacity));
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline void ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Clear()
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		_frozen.Store(nullptr);
+		gsl::owner<const Table*> table = _table.Exchange(nullptr);
+		if (table != nullptr)
+		{
+			for (size_t i = 0; i < table->_capacity; ++i)
+			{
+				Rcu::Retire(table->_slots[i]);
+			}
+			Rcu::Retire(table);
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline void ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Freeze()
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		const Table* table = _table.Load();
+		Vector<typename FrozenTable::Entry> entries;
+		if (table != nullptr)
+		{
+			entries.Reserve(table->_size);
+			for (size_t i = 0; i < table->_capacity; ++i)
+			{
+				const Node* node = table->_slots[i];
+				if (node != nullptr)
+				{
+					entries.PushBack({ node->_pair.first, &node->_pair.second });
+				}
+			}
+		}
+
+		_frozen.Store(new FrozenTable(entries));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::IsFrozen() const
+	{
+		Rcu::ReadGuard guard;
+		return _frozen.Load() != nullptr;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Size() const
+	{
+		Rcu::ReadGuard guard;
+		const Table* table = _table.Load();
+		return (table != nullptr ? table->_size : 0);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::IsEmpty() const
+	{
+		return Size() == 0;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::CapacityFor(size_t count, const Table* table)
+	{
+		size_t capacity = (table != nullptr ? table->_capacity : MinCapacity);
+		while (count * 2 > capacity)
+		{
+			capacity *= 2;
+		}
+
+		return capacity;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline auto ConcurrentHashMap<TKey, TData, HashFunctor, EqualityFunctor>::Copy(const Table* table, size_t capacity, const Node* skip) -> gsl::owner<Table*>
+	{
+		gsl::owner<Table*> copy = new Table(capacity);
+		if (table != nullptr)
+		{
+			for (size_t i = 0; i < table->_capacity; ++i)
+			{
+				const Node* node = table->_slots[i];
+				if (node != nullptr && node != skip)
+				{
+					copy->Place(*node);
+				}
+			}
+		}
+
+		return copy;
+	}
+}
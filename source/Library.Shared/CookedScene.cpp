@@ -0,0 +1,552 @@
+#include "pch.h"
+#include "CookedScene.h"
+#include "FactoryHandle.h"
+#include "FrozenMap.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include "TypeManager.h"
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		//	Layout of a cooked file, every count and length a uint32_t:
+		//	Header, then the root Scope.
+		//	Scope:	entry count, then per entry its key, DatumType, value count and values.
+		//	Values:	numbers, vectors and matrices as one raw array starting on an ArrayAlignment boundary of the file,
+		//			strings one after the other, nested Scopes as their class name followed by the Scope.
+		//	Keys, strings and class names are a length followed by the characters.
+
+		/// <summary>
+		/// First bytes of every cooked file, "FSCN" in file order.
+		/// </summary>
+		constexpr std::uint32_t Magic = 0x4E435346;
+
+		/// <summary>
+		/// Alignment of the raw arrays, enough for vec4 and mat4x4 to be used in place.
+		/// </summary>
+		constexpr std::size_t ArrayAlignment = 16;
+
+		struct Header final
+		{
+			std::uint32_t _magic;
+			std::uint32_t _version;
+			std::uint64_t _sourceHash;
+			std::uint64_t _payloadSize;
+			std::uint64_t _reserved;
+		};
+
+		static_assert(sizeof(Header) % ArrayAlignment == 0, "The root Scope must start aligned.");
+
+		/// <summary>
+		/// Appends cooked values to a buffer.
+		/// </summary>
+		class Writer final
+		{
+		public:
+			template <typename T>
+			void Write(const T& value)
+			{
+				_out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+			}
+
+			void WriteCount(std::size_t count)
+			{
+				if (count > std::numeric_limits<std::uint32_t>::max())
+				{
+					throw std::runtime_error("Too many values to cook. CookedScene::Cook()");
+				}
+				Write(static_cast<std::uint32_t>(count));
+			}
+
+			void WriteString(std::string_view text)
+			{
+				WriteCount(text.size());
+				_out.append(text.data(), text.size());
+			}
+
+			void WriteArray(const void* values, std::size_t size)
+			{
+				_out.append((ArrayAlignment - _out.size() % ArrayAlignment) % ArrayAlignment, '\0');
+				_out.append(static_cast<const char*>(values), size);
+			}
+
+			std::string& Out()
+			{
+				return _out;
+			}
+
+		private:
+			std::string _out;
+		};
+
+		/// <summary>
+		/// Reads cooked values from a mapped file, checking every read against the end of the file.
+		/// </summary>
+		class Reader final
+		{
+		public:
+			Reader(char* data, std::size_t size) :
+				_data(data), _cursor(sizeof(Header)), _size(size)
+			{
+			}
+
+			template <typename T>
+			T Read()
+			{
+				T value;
+				std::memcpy(&value, Take(sizeof(T)), sizeof(T));
+				return value;
+			}
+
+			std::size_t ReadCount()
+			{
+				return Read<std::uint32_t>();
+			}
+
+			std::string_view ReadString()
+			{
+				const std::size_t length = ReadCount();
+				return std::string_view(Take(length), length);
+			}
+
+			template <typename T>
+			T* ReadArray(std::size_t count)
+			{
+				_cursor += (ArrayAlignment - _cursor % ArrayAlignment) % ArrayAlignment;
+				if (count > (_size - std::min(_cursor, _size)) / sizeof(T))
+				{
+					Truncated();
+				}
+				return reinterpret_cast<T*>(Take(count * sizeof(T)));
+			}
+
+		private:
+			char* Take(std::size_t size)
+			{
+				if (_cursor > _size || size > _size - _cursor)
+				{
+					Truncated();
+				}
+
+				char* bytes = _data + _cursor;
+				_cursor += size;
+				return bytes;
+			}
+
+			[[noreturn]] static void Truncated()
+			{
+				throw std::runtime_error("Cooked scene is corrupt, a value runs past the end of the file. CookedScene::Load()");
+			}
+
+			char* _data;
+			std::size_t _cursor;
+			std::size_t _size;
+		};
+
+		/// <summary>
+		/// Factory of the last class loaded, since the children of a Datum are usually all of one class.
+		/// </summary>
+		struct FactoryCache final
+		{
+			const FactoryHandle<Scope>& Find(std::string_view className)
+			{
+				if (_factory.IsValid() == false || className != _className)
+				{
+					_className = className;
+					_factory = FactoryHandle<Scope>(_className);
+					if (_factory.IsValid() == false)
+					{
+						throw std::runtime_error("Cooked scene uses class " + _className + ", which has no registered factory. CookedScene::Load()");
+					}
+				}
+
+				return _factory;
+			}
+
+			std::string _className;
+			FactoryHandle<Scope> _factory;
+		};
+
+		bool IsCookable(const Datum& datum)
+		{
+			return datum.Type() != Datum::DatumType::Unknown && datum.Type() != Datum::DatumType::Pointer;
+		}
+
+		/// <summary>
+		/// Checks that a Scope of a type known to the TypeManager still has its prescribed attributes, so it loads back into a fresh instance.
+		/// </summary>
+		void CheckSignatures(const Scope& scope)
+		{
+			if (TypeManager::ContainsType(scope.TypeIdInstance()) == false)
+			{
+				return;
+			}
+
+			for (const Signature& signature : TypeManager::GetSignaturesForType(scope.TypeIdInstance()))
+			{
+				const Datum* datum = scope.Find(signature.name);
+				if (datum == nullptr || datum->Type() != signature.type || (signature.type != Datum::DatumType::Table && datum->Size() != signature.size))
+				{
+					throw std::runtime_error("Scope of class " + scope.TypeNameInstance() + " doesn't match its prescribed attribute " + signature.name + ". CookedScene::Cook()");
+				}
+			}
+		}
+
+		void CookScope(const Scope& scope, Writer& writer)
+		{
+			CheckSignatures(scope);
+
+			std::size_t entryCount = 0;
+			for (std::size_t i = 0; i < scope.Size(); ++i)
+			{
+				entryCount += (IsCookable(scope.GetPair(i).second) ? 1 : 0);
+			}
+			writer.WriteCount(entryCount);
+
+			for (std::size_t i = 0; i < scope.Size(); ++i)
+			{
+				const auto& [key, datum] = scope.GetPair(i);
+				if (IsCookable(datum) == false)
+				{
+					continue;
+				}
+
+				writer.WriteString(key);
+				writer.Write(static_cast<std::uint32_t>(datum.Type()));
+				writer.WriteCount(datum.Size());
+				if (datum.Size() == 0)
+				{
+					continue;
+				}
+
+				switch (datum.Type())
+				{
+				case Datum::DatumType::Float:
+					writer.WriteArray(&datum.Get<float>(), datum.Size() * sizeof(float));
+					break;
+
+				case Datum::DatumType::Integer:
+					writer.WriteArray(&datum.Get<int>(), datum.Size() * sizeof(int));
+					break;
+
+				case Datum::DatumType::Vector:
+					writer.WriteArray(&datum.Get<vec4>(), datum.Size() * sizeof(vec4));
+					break;
+
+				case Datum::DatumType::Matrix:
+					writer.WriteArray(&datum.Get<mat4x4>(), datum.Size() * sizeof(mat4x4));
+					break;
+
+				case Datum::DatumType::String:
+					for (std::size_t j = 0; j < datum.Size(); ++j)
+					{
+						writer.WriteString(datum.Get<std::string>(j));
+					}
+					break;
+
+				case Datum::DatumType::Table:
+					for (std::size_t j = 0; j < datum.Size(); ++j)
+					{
+						const Scope& child = *datum.Get<Scope*>(j);
+						const std::string className = child.TypeNameInstance();
+						if (IFactory<Scope>::Find(className) == nullptr)
+						{
+							throw std::runtime_error("Scope of class " + className + " has no registered factory to load it with. CookedScene::Cook()");
+						}
+
+						writer.WriteString(className);
+						CookScope(child, writer);
+					}
+					break;
+
+				default:
+					assert(false);
+					break;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Moves count values into a Datum: set in place for prescribed attributes, referenced in the file or bulk copied otherwise.
+		/// </summary>
+		template <typename T>
+		void LoadArray(Datum& datum, T* values, std::size_t count, CookedScene::LoadMode mode)
+		{
+			if (datum.OwnsData() == false)
+			{
+				if (count != datum.Size())
+				{
+					throw std::runtime_error("Cooked scene doesn't match the size of a prescribed attribute. CookedScene::Load()");
+				}
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					datum.Set(values[i], i);
+				}
+			}
+			else if (mode == CookedScene::LoadMode::Reference && datum.Capacity() == 0)
+			{
+				datum.SetStorage(values, count);
+			}
+			else
+			{
+				datum.PushBack(values, count);
+			}
+		}
+
+		void LoadScope(Scope& scope, Reader& reader, CookedScene::LoadMode mode, bool isNew, FactoryCache& factories)
+		{
+			const std::size_t entryCount = reader.ReadCount();
+			for (std::size_t i = 0; i < entryCount; ++i)
+			{
+				const std::string key(reader.ReadString());
+				const auto type = static_cast<Datum::DatumType>(reader.Read<std::uint32_t>());
+				const std::size_t count = reader.ReadCount();
+				if (type >= Datum::DatumType::Unknown || type == Datum::DatumType::Pointer)
+				{
+					throw std::runtime_error("Cooked scene is corrupt, it holds an unknown type. CookedScene::Load()");
+				}
+
+				Datum& datum = scope.Append(key);
+
+				//	Same as parsing a value for an attribute of a prefab instance: it replaces the prefab's
+				if (datum.IsShared())
+				{
+					datum.Clear();
+				}
+
+				if (datum.Type() == Datum::DatumType::Unknown)
+				{
+					datum.SetType(type);
+				}
+				else if (datum.Type() != type)
+				{
+					throw std::runtime_error("Cooked scene holds another type for key " + key + " than the Scope it is loaded into. CookedScene::Load()");
+				}
+
+				if (count == 0)
+				{
+					continue;
+				}
+
+				switch (type)
+				{
+				case Datum::DatumType::Float:
+					LoadArray(datum, reader.ReadArray<float>(count), count, mode);
+					break;
+
+				case Datum::DatumType::Integer:
+					LoadArray(datum, reader.ReadArray<int>(count), count, mode);
+					break;
+
+				case Datum::DatumType::Vector:
+					LoadArray(datum, reader.ReadArray<vec4>(count), count, mode);
+					break;
+
+				case Datum::DatumType::Matrix:
+					LoadArray(datum, reader.ReadArray<mat4x4>(count), count, mode);
+					break;
+
+				case Datum::DatumType::String:
+					if (datum.OwnsData())
+					{
+						datum.Reserve(datum.Size() + count);
+					}
+
+					for (std::size_t j = 0; j < count; ++j)
+					{
+						const std::string_view value = reader.ReadString();
+						if (datum.OwnsData())
+						{
+							datum.PushBack(std::string(value));
+						}
+						else
+						{
+							datum.Set(std::string(value), j);
+						}
+					}
+					break;
+
+				case Datum::DatumType::Table:
+				{
+					//	Scopes an Attributed made for a prescribed table when it was created are the first ones that were cooked
+					const std::size_t existing = (isNew ? std::min(datum.Size(), count) : 0);
+					datum.Reserve(datum.Size() + count - existing);
+
+					for (std::size_t j = 0; j < count; ++j)
+					{
+						const std::string_view className = reader.ReadString();
+						Scope* child = nullptr;
+						if (j < existing)
+						{
+							child = &datum[j];
+						}
+						else
+						{
+							child = factories.Find(className).Create();
+							scope.Adopt(*child, key);
+						}
+
+						LoadScope(*child, reader, mode, true, factories);
+					}
+					break;
+				}
+
+				default:
+					break;
+				}
+			}
+		}
+	}
+
+	CookedScene::CookedScene(const std::string& fileName)
+	{
+		Open(fileName);
+	}
+
+	bool CookedScene::Open(const std::string& fileName)
+	{
+		Close();
+		if (_file.Open(fileName, MappedFile::Access::CopyOnWrite) == false)
+		{
+			return false;
+		}
+
+		Header header{};
+		if (_file.Size() >= sizeof(Header))
+		{
+			std::memcpy(&header, _file.Data(), sizeof(Header));
+		}
+
+		if (header._magic != Magic || header._payloadSize != _file.Size() - sizeof(Header))
+		{
+			_file.Close();
+			throw std::runtime_error(fileName + " is not a cooked scene, or is truncated. CookedScene::Open()");
+		}
+
+		if (header._version != FormatVersion)
+		{
+			_file.Close();
+			throw std::runtime_error(fileName + " was cooked with format version " + std::to_string(header._version) + ". CookedScene::Open()");
+		}
+
+		_fileName = fileName;
+		return true;
+	}
+
+	void CookedScene::Close()
+	{
+		_referenceViews.Clear();
+		_file.Close();
+		_fileName.clear();
+	}
+
+	bool CookedScene::IsOpen() const
+	{
+		return _file.IsOpen();
+	}
+
+	std::uint64_t CookedScene::SourceHash() const
+	{
+		if (_file.IsOpen() == false)
+		{
+			return 0;
+		}
+
+		Header header;
+		std::memcpy(&header, _file.Data(), sizeof(Header));
+		return header._sourceHash;
+	}
+
+	void CookedScene::Load(Scope& root, LoadMode mode)
+	{
+		if (_file.IsOpen() == false)
+		{
+			throw std::runtime_error("No cooked scene is open. CookedScene::Load()");
+		}
+
+		char* data = _file.MutableData();
+
+		//	Referenced trees get a mapping of their own, so writes to one don't show up in the others
+		if (mode == LoadMode::Reference)
+		{
+			MappedFile view(_fileName, MappedFile::Access::CopyOnWrite);
+			if (view.Size() != _file.Size() || std::memcmp(view.Data(), _file.Data(), sizeof(Header)) != 0)
+			{
+				throw std::runtime_error(_fileName + " changed since it was opened. CookedScene::Load()");
+			}
+
+			_referenceViews.PushBack(std::move(view));
+			data = _referenceViews.Back().MutableData();
+		}
+
+		Reader reader(data, _file.Size());
+		FactoryCache factories;
+		LoadScope(root, reader, mode, false, factories);
+	}
+
+	std::uint64_t CookedScene::Hash(std::string_view text)
+	{
+		return FrozenHash<std::string_view>{}(text);
+	}
+
+	std::string CookedScene::Cook(const Scope& root, std::uint64_t sourceHash)
+	{
+		Writer writer;
+		writer.Write(Header{});
+		CookScope(root, writer);
+
+		std::string& out = writer.Out();
+		const Header header{ Magic, FormatVersion, sourceHash, out.size() - sizeof(Header), 0 };
+		std::memcpy(out.data(), &header, sizeof(Header));
+		return std::move(out);
+	}
+
+	void CookedScene::CookFile(const std::string& jsonFileName, const std::string& cookedFileName)
+	{
+		const MappedFile json(jsonFileName);
+		if (json.IsOpen() == false)
+		{
+			throw std::runtime_error("Unable to open " + jsonFileName + ". CookedScene::CookFile()");
+		}
+
+		Scope root;
+		SharedTableData data(root);
+		JsonParseCoordinator parser(data);
+		JsonTableParseHelper helper;
+		parser.AddHelper(helper);
+		parser.ParseStreaming(json.View());
+
+		const std::string cooked = Cook(root, Hash(json.View()));
+		std::ofstream file(cookedFileName, std::ios::binary | std::ios::trunc);
+		if (file.is_open() == false)
+		{
+			throw std::runtime_error("Unable to open " + cookedFileName + " for writing. CookedScene::CookFile()");
+		}
+
+		file.write(cooked.data(), static_cast<std::streamsize>(cooked.size()));
+	}
+
+	bool CookedScene::IsStale(const std::string& jsonFileName, const std::string& cookedFileName)
+	{
+		CookedScene scene;
+		try
+		{
+			if (scene.Open(cookedFileName) == false)
+			{
+				return true;
+			}
+		}
+		catch (const std::runtime_error&)
+		{
+			return true;
+		}
+
+		const MappedFile json(jsonFileName);
+		return json.IsOpen() && Hash(json.View()) != scene.SourceHash();
+	}
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "MappedFile.h"
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// CookedScene Class - Binary form of a Json scene, cooked offline so that loading is a walk over the file instead of a parse.
+	/// Numbers, vectors and matrices are stored as raw arrays, aligned so a loader can bulk copy them into Datums - or leave them in the file and point
+	/// Datums at them. Strings are length prefixed and nested Scopes carry their class name, like JsonTableWriter writes them.
+	/// Every cooked file starts with a header holding the format version and a hash of the Json text it was cooked from, so stale cooks are detected.
+	/// Cooked files are read on the kind of machine that wrote them: values are stored in its byte order and type layouts.
+	/// </summary>
+	class CookedScene final
+	{
+	public:
+		/// <summary>
+		/// Version of the layout written by Cook. Files of any other version fail to Open and are always stale.
+		/// </summary>
+		static constexpr std::uint32_t FormatVersion = 1;
+
+		/// <summary>
+		/// LoadMode - How Load gets numeric arrays into Datums.
+		/// </summary>
+		enum class LoadMode
+		{
+			/// <summary>
+			/// Copy every array into Datums of their own. The tree doesn't depend on the CookedScene afterwards.
+			/// </summary>
+			Copy,
+
+			/// <summary>
+			/// Point new numeric Datums at their arrays in the file, copying nothing. Every Reference load maps the file again, copy on write, so
+			/// writing to those Datums is allowed and isn't seen by any other loaded tree, but they can't grow. The tree must be destroyed before the
+			/// CookedScene is closed, which is what unmaps those views. Strings are always copied.
+			/// </summary>
+			Reference
+		};
+
+		/// <summary>
+		/// Constructor - Creates a closed CookedScene.
+		/// </summary>
+		CookedScene() = default;
+
+		/// <summary>
+		/// Constructor - Opens a cooked file.
+		/// </summary>
+		/// <param name="fileName">Path of the cooked file.</param>
+		/// <exception cref="std::runtime_error">Throws if the file isn't a cooked scene of this FormatVersion.</exception>
+		explicit CookedScene(const std::string& fileName);
+
+		CookedScene(const CookedScene&) = delete;
+		CookedScene& operator=(const CookedScene&) = delete;
+
+		/// <summary>
+		/// Move constructor - Takes over other's file, leaving other closed.
+		/// </summary>
+		CookedScene(CookedScene&& other) noexcept = default;
+
+		/// <summary>
+		/// Move assignment - Closes this file and takes over other's, leaving other closed.
+		/// </summary>
+		CookedScene& operator=(CookedScene&& other) noexcept = default;
+
+		/// <summary>
+		/// Defaulted destructor - Unmaps the file.
+		/// </summary>
+		~CookedScene() = default;
+
+		/// <summary>
+		/// Open - Maps a cooked file and checks its header, closing the file opened before.
+		/// </summary>
+		/// <param name="fileName">Path of the cooked file.</param>
+		/// <returns>True if the file was opened, false if it couldn't be.</returns>
+		/// <exception cref="std::runtime_error">Throws if the file isn't a cooked scene of this FormatVersion.</exception>
+		bool Open(const std::string& fileName);
+
+		/// <summary>
+		/// Close - Unmaps the file and the views made for LoadMode::Reference loads. Trees loaded with LoadMode::Reference must be gone by then.
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// IsOpen - Tells you if a cooked file is open.
+		/// </summary>
+		bool IsOpen() const;
+
+		/// <summary>
+		/// SourceHash - Returns the Hash of the Json text the open file was cooked from, 0 if no file is open.
+		/// </summary>
+		std::uint64_t SourceHash() const;
+
+		/// <summary>
+		/// Load - Builds the cooked tree into root: each key is appended to root and its values are pushed back, as if the Json had been parsed into it.
+		/// Nested Scopes are made by the factory of their class. Values of prescribed attributes are set in place, and the Scopes a newly made
+		/// Attributed already has for a prescribed table are loaded into rather than added to, so a loaded tree matches the tree that was cooked.
+		/// </summary>
+		/// <param name="root">Scope to load into.</param>
+		/// <param name="mode">Whether numeric arrays are copied or referenced in the file.</param>
+		/// <exception cref="std::runtime_error">Throws if no file is open, the file is corrupt, a class has no registered factory, a key holds
+		/// another type in root, or the file was changed on disk since it was opened and a Reference load can't map it again.</exception>
+		void Load(Scope& root, LoadMode mode = LoadMode::Copy);
+
+		/// <summary>
+		/// Hash - Content hash of Json text (64 bit FNV-1a), the one recorded by CookFile.
+		/// </summary>
+		/// <param name="text">Text to hash.</param>
+		/// <returns>The hash.</returns>
+		static std::uint64_t Hash(std::string_view text);
+
+		/// <summary>
+		/// Cook - Serializes a tree into the cooked format, checking that it can be loaded back: every nested Scope's class needs a registered factory
+		/// and every Scope of a type known to the TypeManager needs its prescribed attributes, with their signature's type and size.
+		/// Pointer Datums (including Attributed's "this") and Datums of unknown type are not written.
+		/// </summary>
+		/// <param name="root">Root of the tree. Its entries become the top level of the cooked scene.</param>
+		/// <param name="sourceHash">Hash of the Json text the tree was parsed from.</param>
+		/// <returns>The cooked bytes.</returns>
+		/// <exception cref="std::runtime_error">Throws if the tree doesn't pass the checks.</exception>
+		static std::string Cook(const Scope& root, std::uint64_t sourceHash);
+
+		/// <summary>
+		/// CookFile - Parses a Json scene with JsonTableParseHelper, members in document order as with ParseStreaming, and writes it cooked.
+		/// The factories of the scene's classes have to be registered.
+		/// </summary>
+		/// <param name="jsonFileName">Path of the Json scene.</param>
+		/// <param name="cookedFileName">Path of the cooked file to (over)write.</param>
+		/// <exception cref="std::runtime_error">Throws if either file can't be opened, or the scene fails to parse or cook.</exception>
+		static void CookFile(const std::string& jsonFileName, const std::string& cookedFileName);
+
+		/// <summary>
+		/// IsStale - Tells you if a cooked file needs to be cooked again: it is missing, isn't a cooked scene of this FormatVersion, or was cooked from
+		/// text other than the Json file's. A cooked file without its Json file is taken as current, as it is all there is to load.
+		/// </summary>
+		/// <param name="jsonFileName">Path of the Json scene.</param>
+		/// <param name="cookedFileName">Path of the cooked file.</param>
+		/// <returns>True if the scene should be cooked again, else false.</returns>
+		static bool IsStale(const std::string& jsonFileName, const std::string& cookedFileName);
+
+	private:
+		/// <summary>
+		/// _file - The cooked file, read by LoadMode::Copy loads.
+		/// </summary>
+		MappedFile _file;
+
+		/// <summary>
+		/// _fileName - Path of the open file, mapped again for each LoadMode::Reference load.
+		/// </summary>
+		std::string _fileName;
+
+		/// <summary>
+		/// _referenceViews - One private copy on write mapping per LoadMode::Reference load, the storage its tree's numeric Datums point at.
+		/// </summary>
+		Vector<MappedFile> _referenceViews;
+	};
+}
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "Datum.h"
+#include "Scope.h"
+#include <cstring>
 #include <stdexcept>
 
 namespace FieaGameEngine
@@ -12,10 +14,18 @@ namespace FieaGameEngine
 	}
 
 	Datum::Datum(const Datum& other) :
-		_type(other._type), _size(other._size), _ownsData(other._ownsData)
+		_type(other._type), _size(other._size), _ownsData(other._ownsData), _sharesData(other._sharesData)
 	{
+		//	Copies of a prototype's data start out as views of it
+		if (other.IsShareable())
+		{
+			_ownsData = false;
+			_sharesData = true;
+			_capacity = other._size;
+			_data = other._data;
+		}
 		//	Case where the data is owned
-		if (other._ownsData == true)
+		else if (other._ownsData == true)
 		{
 			Reserve(other._capacity);
 
@@ -33,12 +43,14 @@ namespace FieaGameEngine
 	}
 
 	Datum::Datum(Datum&& other) noexcept :
-		_type(other._type), _size(other._size), _capacity(other._capacity), _data(other._data)
+		_type(other._type), _size(other._size), _capacity(other._capacity), _data(other._data), _ownsData(other._ownsData), _sharesData(other._sharesData)
 	{
 		other._type = DatumType::Unknown;
 		other._size = 0;
 		other._capacity = 0;
 		other._data.vp = nullptr;
+		other._ownsData = true;
+		other._sharesData = false;
 	}
 
 	Datum& Datum::operator=(Datum&& other) noexcept
@@ -52,11 +64,15 @@ namespace FieaGameEngine
 			_size = other._size;
 			_capacity = other._capacity;
 			_data = other._data;
+			_ownsData = other._ownsData;
+			_sharesData = other._sharesData;
 
 			other._type = DatumType::Unknown;
 			other._size = 0;
 			other._capacity = 0;
 			other._data.vp = nullptr;
+			other._ownsData = true;
+			other._sharesData = false;
 		}
 		return *this;
 	}
@@ -65,8 +81,31 @@ namespace FieaGameEngine
 	{
 		if (*this != other)
 		{
+			//	The old contents are replaced wholesale, there is no point copying a shared view first
+			if (_sharesData)
+			{
+				Detach();
+			}
+
+			//	Copies of a prototype's data start out as views of it, unless this is bound to external storage
+			if (_ownsData == true && other.IsShareable())
+			{
+				if (_type != DatumType::Unknown)
+				{
+					Clear();
+					ShrinkToFit();
+				}
+
+				_type = other._type;
+				_size = other._size;
+				_capacity = other._size;
+				_ownsData = false;
+				_sharesData = true;
+				_data = other._data;
+			}
+
 			//	Both are owners of the data
-			if (_ownsData == true && other._ownsData == true)
+			else if (_ownsData == true && other._ownsData == true)
 			{
 				if (_type != DatumType::Unknown)
 				{
@@ -100,6 +139,7 @@ namespace FieaGameEngine
 				
 				_capacity = other._capacity;
 				_ownsData = other._ownsData;
+				_sharesData = other._sharesData;
 				_data = other._data;
 			}
 
@@ -127,8 +167,14 @@ namespace FieaGameEngine
 				_size = other._size;
 				_capacity = other._capacity;
 				_ownsData = other._ownsData;
+				_sharesData = other._sharesData;
 				_data = other._data;
 			}
+
+			if (ChangeJournal::IsEnabled())
+			{
+				TrackChange(_size, ChangeJournal::ChangeType::Resize);
+			}
 		}
 
 		return *this;
@@ -136,6 +182,9 @@ namespace FieaGameEngine
 
 	Datum::~Datum()
 	{
+		//	The owning Scope is being torn down - nothing left to notify.
+		_owner = nullptr;
+
 		if (_ownsData == true)
 		{
 			Clear();
@@ -173,6 +222,8 @@ namespace FieaGameEngine
 			throw runtime_error("Unable to call reserve on an unknown type");
 		}
 
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -196,6 +247,8 @@ namespace FieaGameEngine
 			throw runtime_error("Unable to call reserve on an unknown type");
 		}
 
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -231,6 +284,11 @@ namespace FieaGameEngine
 		}
 
 		_size = size;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::Resize);
+		}
 	}
 
 	bool Datum::SetStorage(DatumType type, void* arr, size_t count)
@@ -251,6 +309,7 @@ namespace FieaGameEngine
 		}
 
 		_ownsData = false;
+		_sharesData = false;
 		_data.vp = arr;
 		_size = count;
 		_capacity = count;
@@ -258,8 +317,54 @@ namespace FieaGameEngine
 		return true;
 	}
 
+	size_t Datum::PushBack(DatumType type, const void* values, size_t count)
+	{
+		Unshare();
+
+		if (_ownsData == false)
+		{
+			throw runtime_error("Unable to modify data that Datum doesn't own.");
+		}
+
+		if (_type == DatumType::Unknown)
+		{
+			_type = type;
+		}
+
+		if (_type != type)
+		{
+			throw runtime_error("Data type for argument value in pushback does not match Datum._type.");
+		}
+
+		const size_t first = _size;
+		if (count > 0)
+		{
+			if (_size + count > _capacity)
+			{
+				Reserve(_size + count);
+			}
+
+			const size_t size = _sizeMap[static_cast<int>(_type)];
+			std::memcpy(static_cast<uint8_t*>(_data.vp) + first * size, values, count * size);
+			_size += count;
+
+			if (ChangeJournal::IsEnabled())
+			{
+				TrackChange(_size, ChangeJournal::ChangeType::Resize);
+			}
+		}
+
+		return first;
+	}
+
 	void Datum::Clear()
 	{
+		//	Nothing to copy if everything is going anyway
+		if (_sharesData)
+		{
+			Detach();
+		}
+
 		//	Do nothing if external storage
 		if (_ownsData != false)
 		{
@@ -271,11 +376,18 @@ namespace FieaGameEngine
 				}
 			}
 			_size = 0;
+
+			if (ChangeJournal::IsEnabled())
+			{
+				TrackChange(0, ChangeJournal::ChangeType::Resize);
+			}
 		}
 	}
 
 	bool Datum::PopBack()
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -293,11 +405,19 @@ namespace FieaGameEngine
 		}
 
 		--_size;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::RemoveAt);
+		}
+
 		return true;
 	}
 
 	bool Datum::RemoveAt(size_t index)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -324,9 +444,55 @@ namespace FieaGameEngine
 
 		--_size;
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::RemoveAt);
+		}
+
 		return true;
 	}
 
+	void Datum::TrackChange(size_t index, ChangeJournal::ChangeType type)
+	{
+		_dirty = true;
+
+		if (_owner != nullptr)
+		{
+			_owner->RecordChange(*this, index, type);
+		}
+	}
+
+	void Datum::Materialize()
+	{
+		assert(_sharesData);
+		DatumValues shared = _data;
+		size_t size = _size;
+
+		Detach();
+		Reserve(size);
+
+		CreateCopyFunction func = _copyFunctions[static_cast<int>(_type)];
+		assert(func != nullptr);
+
+		(this->*func)(shared, size);
+		_size = size;
+	}
+
+	void Datum::Detach()
+	{
+		assert(_sharesData);
+		_sharesData = false;
+		_ownsData = true;
+		_data.vp = nullptr;
+		_size = 0;
+		_capacity = 0;
+	}
+
+	bool Datum::IsShareable() const
+	{
+		return _ownsData && _size > 0 && _type != DatumType::Table && _owner != nullptr && _owner->_isPrototype;
+	}
+
 	void Datum::ShrinkToFit()
 	{
 		if (_capacity > _size)
@@ -348,7 +514,7 @@ namespace FieaGameEngine
 	}
 
 	//	Dont need to check s for nullptr because std::basic_string already does. index is already being checked by Set.
-	bool Datum::SetFromString(string s, size_t index)
+	bool Datum::SetFromString(const string& s, size_t index)
 	{
 		if (_type == DatumType::Unknown || _type == DatumType::Pointer || _type == DatumType::Table)
 		{
@@ -364,10 +530,10 @@ namespace FieaGameEngine
 		CreateParseFunc parseFunc = _parseFunctions[static_cast<int>(_type)];
 
 		//	Parses then calls the proper Set()
-		return (this->*parseFunc)(s, index);
+		return (this->*parseFunc)(s.c_str(), index);
 	}
 
-	bool Datum::PushBackFromString(string s)
+	bool Datum::PushBackFromString(const string& s)
 	{
 		if (_type == DatumType::Unknown || _type == DatumType::Pointer || _type == DatumType::Table || _type == DatumType::Integer || _type == DatumType::Float)
 		{
@@ -383,6 +549,6 @@ namespace FieaGameEngine
 		CreateParsePushBackFunc parsePBFunc = _parsePushBackFunctions[static_cast<int>(_type)];
 
 		//	Parses then calls the proper Set()
-		return (this->*parsePBFunc)(s);
+		return (this->*parsePBFunc)(s.c_str());
 	}
 }
\ No newline at end of file
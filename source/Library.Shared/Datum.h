@@ -6,6 +6,8 @@
 #include "RTTI.h"
 #include "json/json.h"
 #include "HashMap.h"
+#include "FrozenMap.h"
+#include "ChangeJournal.h"
 
 using namespace glm;
 using namespace std;
@@ -41,14 +43,17 @@ namespace FieaGameEngine
 			Unknown
 		};
 
-		const inline static HashMap<std::string, DatumType> _setTypeJsonTableParseMap = {
+		/// <summary>
+		/// Json "type" names of the Datum types. A perfect hash table built at compile time.
+		/// </summary>
+		static constexpr FrozenMap<std::string_view, DatumType, 6> _setTypeJsonTableParseMap = MakeFrozenMap<std::string_view, DatumType>({
 			{"float", DatumType::Float},
 			{"integer", DatumType::Integer},
 			{"matrix", DatumType::Matrix},
 			{"string", DatumType::String},
 			{"table", DatumType::Table},
 			{"vector", DatumType::Vector}
-		};
+		});
 
 #pragma region Datum Rule of 6
 
@@ -155,14 +160,14 @@ namespace FieaGameEngine
 		/// <param name="s">String to be parsed.</param>
 		/// <param name="index">Index to store the parsed value.</param>
 		/// <returns>True if a value was successfully parsed from the string and inserted.</returns>
-		bool SetFromString(string s, size_t index = 0);
+		bool SetFromString(const string& s, size_t index = 0);
 
 		/// <summary>
 		/// Parses a string and pushes the value to the back of the datum.
 		/// </summary>
 		/// <param name="s">String to be parsed.</param>
 		/// <returns>True if a value was successfully parsed and pushed back.</returns>
-		bool PushBackFromString(string s);
+		bool PushBackFromString(const string& s);
 #pragma endregion
 
 #pragma region Datum Equality Operator Overloads
@@ -295,6 +300,13 @@ namespace FieaGameEngine
 		/// <returns>True if the datum owns the data, else false.</returns>
 		bool OwnsData() const;
 
+		/// <summary>
+		/// IsShared - Returns whether this Datum is a copy on write view of a prefab prototype's data (see PrefabRegistry). Shared Datums don't own their data;
+		/// the first mutating call (Set, PushBack, a non-const Get/Front/Back, ...) copies it into storage of their own.
+		/// </summary>
+		/// <returns>True if the data still belongs to a prototype.</returns>
+		bool IsShared() const;
+
 #pragma endregion
 
 #pragma region Datum Data Setters and Getters
@@ -412,7 +424,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// SetFromJsonValue - Takes in a de-serialized json object and the proper index and calls the correct Set() based on the datum type.
 		/// </summary>
-		void SetFromJsonValue(Json::Value object, size_t index);
+		void SetFromJsonValue(const Json::Value& object, size_t index);
 
 #pragma endregion
 
@@ -483,10 +495,46 @@ namespace FieaGameEngine
 		/// <exception cref="std::runtime_error">Calling when datum doesn't own the array causes a runtime error.</exception>
 		size_t PushBack(const Scope& value);
 
+		/// <summary>
+		/// Appends count values to the back of the Datum value array in one copy, growing the capacity at most once.
+		/// </summary>
+		/// <param name="values">Address of the first value to append.</param>
+		/// <param name="count">Number of values to append.</param>
+		/// <returns>Index of the first appended value.</returns>
+		/// <exception cref="std::runtime_error">Calling when datum doesn't own the array or holds another type causes a runtime error.</exception>
+		size_t PushBack(const float* values, size_t count);
+
+		/// <summary>
+		/// Appends count values to the back of the Datum value array in one copy, growing the capacity at most once.
+		/// </summary>
+		/// <param name="values">Address of the first value to append.</param>
+		/// <param name="count">Number of values to append.</param>
+		/// <returns>Index of the first appended value.</returns>
+		/// <exception cref="std::runtime_error">Calling when datum doesn't own the array or holds another type causes a runtime error.</exception>
+		size_t PushBack(const int* values, size_t count);
+
+		/// <summary>
+		/// Appends count values to the back of the Datum value array in one copy, growing the capacity at most once.
+		/// </summary>
+		/// <param name="values">Address of the first value to append.</param>
+		/// <param name="count">Number of values to append.</param>
+		/// <returns>Index of the first appended value.</returns>
+		/// <exception cref="std::runtime_error">Calling when datum doesn't own the array or holds another type causes a runtime error.</exception>
+		size_t PushBack(const mat4x4* values, size_t count);
+
+		/// <summary>
+		/// Appends count values to the back of the Datum value array in one copy, growing the capacity at most once.
+		/// </summary>
+		/// <param name="values">Address of the first value to append.</param>
+		/// <param name="count">Number of values to append.</param>
+		/// <returns>Index of the first appended value.</returns>
+		/// <exception cref="std::runtime_error">Calling when datum doesn't own the array or holds another type causes a runtime error.</exception>
+		size_t PushBack(const vec4* values, size_t count);
+
 		/// <summary>
 		/// PushBackFromJsonValue - Takes in a de-serialized json object and passes it into the correct pushback based on the datum's type.
 		/// </summary>
-		void PushBackFromJsonValue(Json::Value object);
+		void PushBackFromJsonValue(const Json::Value& object);
 
 #pragma endregion
 
@@ -783,6 +831,22 @@ namespace FieaGameEngine
 		/// <returns>Reference to the scope at the passed in index</returns>
 		Scope& operator[](size_t index);
 
+#pragma endregion
+
+#pragma region Datum Change Tracking
+
+		/// <summary>
+		/// IsDirty - Returns whether a tracked mutation (Set, PushBack, RemoveAt, PopBack, Clear, Resize, assignment) has been made since the last ClearDirty().
+		/// Only maintained while the ChangeJournal is enabled. Writes through a non-const Get() reference or directly to external storage aren't seen.
+		/// </summary>
+		/// <returns>True if the Datum has been modified since the last checkpoint.</returns>
+		bool IsDirty() const;
+
+		/// <summary>
+		/// ClearDirty - Resets the dirty bit. Called by Scope::ClearDirty() after a save.
+		/// </summary>
+		void ClearDirty();
+
 #pragma endregion
 
 	private:	
@@ -804,6 +868,45 @@ namespace FieaGameEngine
 		/// <returns>True if set successfully. Can disregard the return value if you wish.</returns>
 		bool SetStorage(DatumType type, void* arr, size_t count);
 
+		/// <summary>
+		/// Helper function for the bulk PushBacks - Types an Unknown Datum, checks the type and copies count trivially copyable values to the back.
+		/// </summary>
+		/// <param name="type">The type of the values.</param>
+		/// <param name="values">Address of the first value.</param>
+		/// <param name="count">Number of values.</param>
+		/// <returns>Index of the first appended value.</returns>
+		size_t PushBack(DatumType type, const void* values, size_t count);
+
+		/// <summary>
+		/// TrackChange - Slow path of the change tracking hooks, only reached when ChangeJournal::IsEnabled(). Marks this Datum and its owning
+		/// Scope chain dirty and journals the mutation against the owning Scope.
+		/// </summary>
+		/// <param name="index">Index within the Datum that was mutated.</param>
+		/// <param name="type">The kind of mutation.</param>
+		void TrackChange(size_t index, ChangeJournal::ChangeType type);
+
+		/// <summary>
+		/// Unshare - Copy on write hook at the top of every mutator. Materializes a shared Datum, a single branch for everything else.
+		/// </summary>
+		void Unshare();
+
+		/// <summary>
+		/// Materialize - Slow path of Unshare(). Copies the prototype's data into newly allocated storage owned by this Datum.
+		/// </summary>
+		void Materialize();
+
+		/// <summary>
+		/// Detach - Drops a shared view without copying it, leaving an empty Datum of the same type that owns its (unallocated) storage.
+		/// Used when the contents are about to be replaced wholesale.
+		/// </summary>
+		void Detach();
+
+		/// <summary>
+		/// IsShareable - Returns whether copies of this Datum may share its data: it owns non-table data and lives in a prefab prototype Scope.
+		/// </summary>
+		/// <returns>True if copies should be copy on write views of this Datum.</returns>
+		bool IsShareable() const;
+
 		/// <summary>
 		/// Union of pointers to potential Datum Values.
 		/// Establishes lens' that we can use for pointer arithmetic.
@@ -849,6 +952,21 @@ namespace FieaGameEngine
 		/// </summary>
 		bool _ownsData{ true };
 
+		/// <summary>
+		/// Set while _data points at a prefab prototype's storage. Implies _ownsData == false, cleared by the first write.
+		/// </summary>
+		bool _sharesData{ false };
+
+		/// <summary>
+		/// Set by tracked mutations while the ChangeJournal is enabled, cleared by ClearDirty().
+		/// </summary>
+		bool _dirty{ false };
+
+		/// <summary>
+		/// The Scope this Datum is stored in, nullptr for free standing Datums. Set by Scope::Append(), not carried over by copies or moves.
+		/// </summary>
+		Scope* _owner{ nullptr };
+
 		/// <summary>
 		/// An array of potential data sizes. Referenced for allocation.
 		/// </summary>
@@ -1140,36 +1258,36 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Parses the given datatype out of the given string string and calls Set(parsedValue, index)
 		/// </summary>
-		/// <param name="s">String with the value to be parsed</param>
+		/// <param name="s">Null terminated string with the value to be parsed</param>
 		/// <param name="index">Position in the value array to set the value to</param>
 		/// <returns>True if the value is Set</returns>
-		bool ParseFloat(string s, size_t index);
+		bool ParseFloat(const char* s, size_t index);
 
 		/// <summary>
 		/// Parses the given datatype out of the given string string and calls Set(parsedValue, index)
 		/// </summary>
-		/// <param name="s">String with the value to be parsed</param>
+		/// <param name="s">Null terminated string with the value to be parsed</param>
 		/// <param name="index">Position in the value array to set the value to</param>
 		/// <returns>True if the value is Set</returns>
-		bool ParseInt(string s, size_t index);
+		bool ParseInt(const char* s, size_t index);
 
 		/// <summary>
 		/// Parses the given datatype out of the given string string and calls Set(parsedValue, index)
 		/// </summary>
-		/// <param name="s">String with the value to be parsed</param>
+		/// <param name="s">Null terminated string with the value to be parsed</param>
 		/// <param name="index">Position in the value array to set the value to</param>
 		/// <returns>True if the value is Set</returns>
-		bool ParseMatrix(string s, size_t index);
+		bool ParseMatrix(const char* s, size_t index);
 
 		/// <summary>
 		/// Parses the given datatype out of the given string string and calls Set(parsedValue, index)
 		/// </summary>
-		/// <param name="s">String with the value to be parsed</param>
+		/// <param name="s">Null terminated string with the value to be parsed</param>
 		/// <param name="index">Position in the value array to set the value to</param>
 		/// <returns>True if the value is Set</returns>
-		bool ParseVector(string s, size_t index);
+		bool ParseVector(const char* s, size_t index);
 
-		using CreateParseFunc = bool(Datum::*)(string s, size_t index);
+		using CreateParseFunc = bool(Datum::*)(const char* s, size_t index);
 
 		/// <summary>
 		/// Array of function pointers that point to correctly typed sscanf calls to parse incoming strings for Data values.
@@ -1187,13 +1305,13 @@ namespace FieaGameEngine
 
 #pragma endregion
 		
-		void ParsePushBackFloat(Json::Value object);
-		void ParsePushBackInteger(Json::Value object);
-		void ParsePushBackMatrix(Json::Value object);
-		void ParsePushBackString(Json::Value object);
-		void ParsePushBackVector(Json::Value object);
+		void ParsePushBackFloat(const Json::Value& object);
+		void ParsePushBackInteger(const Json::Value& object);
+		void ParsePushBackMatrix(const Json::Value& object);
+		void ParsePushBackString(const Json::Value& object);
+		void ParsePushBackVector(const Json::Value& object);
 
-		using PushBackJsonValueFunction = void(Datum::*)(Json::Value object);
+		using PushBackJsonValueFunction = void(Datum::*)(const Json::Value& object);
 
 		/// <summary>
 		/// Array of function pointers to the different placement news used for allocation. Indexed by DatumTypes.
@@ -1210,13 +1328,13 @@ namespace FieaGameEngine
 		};
 
 
-		void SetJsonFloat(Json::Value object, size_t index);
-		void SetJsonInteger(Json::Value object, size_t index);
-		void SetJsonMatrix(Json::Value object, size_t index);
-		void SetJsonString(Json::Value object, size_t index);
-		void SetJsonVector(Json::Value object, size_t index);
+		void SetJsonFloat(const Json::Value& object, size_t index);
+		void SetJsonInteger(const Json::Value& object, size_t index);
+		void SetJsonMatrix(const Json::Value& object, size_t index);
+		void SetJsonString(const Json::Value& object, size_t index);
+		void SetJsonVector(const Json::Value& object, size_t index);
 
-		using SetJsonValueFunction = void(Datum::*)(Json::Value object, size_t index);
+		using SetJsonValueFunction = void(Datum::*)(const Json::Value& object, size_t index);
 
 		inline static const SetJsonValueFunction _setJsonFunctions[static_cast<int>(DatumType::Unknown)] =
 		{
@@ -1230,10 +1348,10 @@ namespace FieaGameEngine
 		};
 
 
-		bool ParsePushBackMatrixString(string s);
-		bool ParsePushBackVectorString(string s);
+		bool ParsePushBackMatrixString(const char* s);
+		bool ParsePushBackVectorString(const char* s);
 
-		using CreateParsePushBackFunc = bool(Datum::*)(string s);
+		using CreateParsePushBackFunc = bool(Datum::*)(const char* s);
 
 		/// <summary>
 		/// Array of function pointers that point to correctly typed sscanf calls to parse incoming strings for Data values.
@@ -22,12 +22,37 @@ namespace FieaGameEngine
 	{
 		return _ownsData;
 	}
+
+	inline bool Datum::IsShared() const
+	{
+		return _sharesData;
+	}
+
+	inline bool Datum::IsDirty() const
+	{
+		return _dirty;
+	}
+
+	inline void Datum::ClearDirty()
+	{
+		_dirty = false;
+	}
+
+	inline void Datum::Unshare()
+	{
+		if (_sharesData)
+		{
+			Materialize();
+		}
+	}
 #pragma endregion
 
 #pragma region PushBack
 
 	inline size_t Datum::PushBack(const float& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -46,11 +71,18 @@ namespace FieaGameEngine
 
 		new(_data.f + _size)float(value);
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(const int& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -69,11 +101,18 @@ namespace FieaGameEngine
 
 		new(_data.i + _size)int(value);
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(const mat4x4& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -92,11 +131,18 @@ namespace FieaGameEngine
 
 		new(_data.m + _size)mat4x4(value);
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(RTTI* const& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -115,11 +161,18 @@ namespace FieaGameEngine
 
 		new(_data.p + _size)RTTI* (value);
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(const string& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -138,11 +191,18 @@ namespace FieaGameEngine
 
 		new(_data.s + _size)string(value);
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(const vec4& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -161,11 +221,18 @@ namespace FieaGameEngine
 
 		new(_data.v + _size)vec4(value);
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(const Scope& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -189,11 +256,18 @@ namespace FieaGameEngine
 
 		new(_data.t + _size)Scope* (&const_cast<Scope&>(value));
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
 	inline size_t Datum::PushBack(string&& value)
 	{
+		Unshare();
+
 		if (_ownsData == false)
 		{
 			throw runtime_error("Unable to modify data that Datum doesn't own.");
@@ -212,6 +286,11 @@ namespace FieaGameEngine
 
 		new(_data.s + _size)string(std::move(value));
 
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(_size, ChangeJournal::ChangeType::PushBack);
+		}
+
 		return _size++;
 	}
 
@@ -227,6 +306,8 @@ namespace FieaGameEngine
 	template<>
 	inline float& Datum::Back<float>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -243,6 +324,8 @@ namespace FieaGameEngine
 	template<>
 	inline int& Datum::Back<int>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -259,6 +342,8 @@ namespace FieaGameEngine
 	template<>
 	inline mat4x4& Datum::Back<mat4x4>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -275,6 +360,8 @@ namespace FieaGameEngine
 	template<>
 	inline string& Datum::Back<string>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -291,6 +378,8 @@ namespace FieaGameEngine
 	template<>
 	inline RTTI*& Datum::Back<RTTI*>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -307,6 +396,8 @@ namespace FieaGameEngine
 	template<>
 	inline vec4& Datum::Back<vec4>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -434,6 +525,8 @@ namespace FieaGameEngine
 	template<>
 	inline float& Datum::Front<float>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -450,6 +543,8 @@ namespace FieaGameEngine
 	template<>
 	inline int& Datum::Front<int>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -466,6 +561,8 @@ namespace FieaGameEngine
 	template<>
 	inline mat4x4& Datum::Front<mat4x4>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -482,6 +579,8 @@ namespace FieaGameEngine
 	template<>
 	inline string& Datum::Front<string>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -498,6 +597,8 @@ namespace FieaGameEngine
 	template<>
 	inline RTTI*& Datum::Front<RTTI*>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -514,6 +615,8 @@ namespace FieaGameEngine
 	template<>
 	inline vec4& Datum::Front<vec4>()
 	{
+		Unshare();
+
 		if (_data.vp == nullptr)
 		{
 			throw std::runtime_error("Attempting to access _data that is referencing nullptr.");
@@ -777,6 +880,8 @@ namespace FieaGameEngine
 	template<>
 	inline float& Datum::Get<float>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -793,6 +898,8 @@ namespace FieaGameEngine
 	template<>
 	inline int& Datum::Get<int>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -809,6 +916,8 @@ namespace FieaGameEngine
 	template<>
 	inline mat4x4& Datum::Get<mat4x4>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -825,6 +934,8 @@ namespace FieaGameEngine
 	template<>
 	inline Scope*& Datum::Get<Scope*>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -841,6 +952,8 @@ namespace FieaGameEngine
 	template<>
 	inline RTTI*& Datum::Get<RTTI*>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -857,6 +970,8 @@ namespace FieaGameEngine
 	template<>
 	inline string& Datum::Get<string>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -873,6 +988,8 @@ namespace FieaGameEngine
 	template<>
 	inline vec4& Datum::Get<vec4>(size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to access index beyond the _size.");
@@ -1004,6 +1121,8 @@ namespace FieaGameEngine
 
 	inline bool Datum::Set(const float& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1015,11 +1134,19 @@ namespace FieaGameEngine
 		}
 
 		_data.f[index] = value;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(const int& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1031,11 +1158,19 @@ namespace FieaGameEngine
 		}
 
 		_data.i[index] = value;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(const mat4x4& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1047,11 +1182,19 @@ namespace FieaGameEngine
 		}
 
 		_data.m[index] = value;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(RTTI* const & value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1063,11 +1206,19 @@ namespace FieaGameEngine
 		}
 
 		_data.p[index] = value;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(const string& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1079,11 +1230,19 @@ namespace FieaGameEngine
 		}
 
 		_data.s[index] = value;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(const vec4& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1095,11 +1254,19 @@ namespace FieaGameEngine
 		}
 
 		_data.v[index] = value;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(const Scope& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1113,11 +1280,19 @@ namespace FieaGameEngine
 		Scope* s = const_cast<Scope*>(&value);
 
 		_data.t[index] = s;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
 	inline bool Datum::Set(string&& value, size_t index)
 	{
+		Unshare();
+
 		if (index >= _size)
 		{
 			throw runtime_error("Attempting to set at an index beyond capacity.");
@@ -1129,6 +1304,12 @@ namespace FieaGameEngine
 		}
 
 		_data.s[index] = std::move(value);
+
+		if (ChangeJournal::IsEnabled())
+		{
+			TrackChange(index, ChangeJournal::ChangeType::Set);
+		}
+
 		return true;
 	}
 
@@ -1311,6 +1492,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(const float& other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1325,6 +1508,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(const int& other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1339,6 +1524,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(const mat4x4& other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1353,6 +1540,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(RTTI* const & other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1367,6 +1556,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(const string& other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1381,6 +1572,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(const vec4& other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1395,6 +1588,8 @@ namespace FieaGameEngine
 
 	inline Datum& Datum::operator=(const Scope& other)
 	{
+		Unshare();
+
 		if (_type != DatumType::Unknown && _ownsData == true)
 		{
 			Clear();
@@ -1522,6 +1717,26 @@ namespace FieaGameEngine
 
 #pragma region SetStorage
 
+	inline size_t Datum::PushBack(const float* values, size_t count)
+	{
+		return PushBack(DatumType::Float, values, count);
+	}
+
+	inline size_t Datum::PushBack(const int* values, size_t count)
+	{
+		return PushBack(DatumType::Integer, values, count);
+	}
+
+	inline size_t Datum::PushBack(const mat4x4* values, size_t count)
+	{
+		return PushBack(DatumType::Matrix, values, count);
+	}
+
+	inline size_t Datum::PushBack(const vec4* values, size_t count)
+	{
+		return PushBack(DatumType::Vector, values, count);
+	}
+
 	inline bool Datum::SetStorage(float* arr, size_t count)
 	{
 		return SetStorage(DatumType::Float, arr, count);
@@ -1728,27 +1943,27 @@ namespace FieaGameEngine
 
 #pragma region String Parse Function Table
 
-	inline bool Datum::ParseFloat(string s, size_t index)
+	inline bool Datum::ParseFloat(const char* s, size_t index)
 	{
 		float val;
-		sscanf_s(s.c_str(), "%f", &val);
+		sscanf_s(s, "%f", &val);
 
 		return Set(val, index);
 	}
 
-	inline bool Datum::ParseInt(string s, size_t index)
+	inline bool Datum::ParseInt(const char* s, size_t index)
 	{
 		int val;
-		sscanf_s(s.c_str(), "%d", &val);
+		sscanf_s(s, "%d", &val);
 
 		return Set(val, index);
 	}
 
-	inline bool Datum::ParseMatrix(string s, size_t index)
+	inline bool Datum::ParseMatrix(const char* s, size_t index)
 	{
 		mat4x4 matrix;
 
-		sscanf_s(s.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))", 
+		sscanf_s(s, "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))", 
 			&matrix[0][0], &matrix[1][0], &matrix[2][0], &matrix[3][0],
 			&matrix[0][1], &matrix[1][1], &matrix[2][1], &matrix[3][1],
 			&matrix[0][2], &matrix[1][2], &matrix[2][2], &matrix[3][2],
@@ -1757,96 +1972,84 @@ namespace FieaGameEngine
 		return Set(matrix, index);
 	}
 
-	inline bool Datum::ParseVector(string s, size_t index)
+	inline bool Datum::ParseVector(const char* s, size_t index)
 	{
 		vec4 vector;
 
-		sscanf_s(s.c_str(), "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w);
+		sscanf_s(s, "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w);
 
 		return Set(vector, index);
 	}
 
-	inline void Datum::SetFromJsonValue(Json::Value object, size_t index)
+	inline void Datum::SetFromJsonValue(const Json::Value& object, size_t index)
 	{
 		SetJsonValueFunction func = _setJsonFunctions[static_cast<int>(_type)];
 		assert(func != nullptr);
 		(this->*func)(object, index);
 	}
 
-	inline void Datum::SetJsonFloat(Json::Value object, size_t index)
+	inline void Datum::SetJsonFloat(const Json::Value& object, size_t index)
 	{
 		Set(object.asFloat(), index);
 	}
 
-	inline void Datum::SetJsonInteger(Json::Value object, size_t index)
+	inline void Datum::SetJsonInteger(const Json::Value& object, size_t index)
 	{
 		Set(object.asInt(), index);
 	}
 
-	inline void Datum::SetJsonMatrix(Json::Value object, size_t index)
+	inline void Datum::SetJsonMatrix(const Json::Value& object, size_t index)
 	{
-		SetFromString(object.asString(), index);
+		ParseMatrix(object.asCString(), index);
 	}
 
-	inline void Datum::SetJsonString(Json::Value object, size_t index)
+	inline void Datum::SetJsonString(const Json::Value& object, size_t index)
 	{
 		Set(object.asString(), index);
 	}
 
-	inline void Datum::SetJsonVector(Json::Value object, size_t index)
+	inline void Datum::SetJsonVector(const Json::Value& object, size_t index)
 	{
-		SetFromString(object.asString(), index);
+		ParseVector(object.asCString(), index);
 	}
 
-	inline void Datum::PushBackFromJsonValue(Json::Value object)
+	inline void Datum::PushBackFromJsonValue(const Json::Value& object)
 	{
 		PushBackJsonValueFunction func = _pushbackFunctions[static_cast<int>(_type)];
 		assert(func != nullptr);
 		(this->*func)(object);
 	}
 
-	inline void Datum::ParsePushBackFloat(Json::Value object)
+	inline void Datum::ParsePushBackFloat(const Json::Value& object)
 	{
 		PushBack(object.asFloat());
 	}
 
-	inline void Datum::ParsePushBackInteger(Json::Value object)
+	inline void Datum::ParsePushBackInteger(const Json::Value& object)
 	{
 		PushBack(object.asInt());
 	}
 
-	inline void Datum::ParsePushBackMatrix(Json::Value object)
+	inline void Datum::ParsePushBackMatrix(const Json::Value& object)
 	{
-		mat4x4 matrix;
-
-		sscanf_s(object.asCString(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-			&matrix[0][0], &matrix[1][0], &matrix[2][0], &matrix[3][0],
-			&matrix[0][1], &matrix[1][1], &matrix[2][1], &matrix[3][1],
-			&matrix[0][2], &matrix[1][2], &matrix[2][2], &matrix[3][2],
-			&matrix[0][3], &matrix[1][3], &matrix[2][3], &matrix[3][3]);
-
-		PushBack(matrix);
+		ParsePushBackMatrixString(object.asCString());
 	}
 
-	inline void Datum::ParsePushBackString(Json::Value object)
+	inline void Datum::ParsePushBackString(const Json::Value& object)
 	{
 		PushBack(object.asString());
 	}
 
-	inline void Datum::ParsePushBackVector(Json::Value object)
+	inline void Datum::ParsePushBackVector(const Json::Value& object)
 	{
-		vec4 vector;
-
-		sscanf_s(object.asCString(), "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w);
-
-		PushBack(vector);
+		ParsePushBackVectorString(object.asCString());
 	}
 
-	inline bool Datum::ParsePushBackMatrixString(string s)
+	inline bool Datum::ParsePushBackMatrixString(const char* s)
 	{
 		mat4x4 matrix;
 
-		sscanf_s(s.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
+		sscanf_s(s, "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
 			&matrix[0][0], &matrix[1][0], &matrix[2][0], &matrix[3][0],
 			&matrix[0][1], &matrix[1][1], &matrix[2][1], &matrix[3][1],
 			&matrix[0][2], &matrix[1][2], &matrix[2][2], &matrix[3][2],
@@ -1855,11 +2058,11 @@ namespace FieaGameEngine
 		return PushBack(matrix);
 	}
 
-	inline bool Datum::ParsePushBackVectorString(string s)
+	inline bool Datum::ParsePushBackVectorString(const char* s)
 	{
 		vec4 vector;
 
-		sscanf_s(s.c_str(), "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w);
+		sscanf_s(s, "vec4(%f, %f, %f, %f)", &vector.x, &vector.y, &vector.z, &vector.w);
 
 		return PushBack(vector);
 	}
@@ -1,5 +1,6 @@
 #include "DefaultHash.h"
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 namespace FieaGameEngine
@@ -18,6 +19,21 @@ namespace FieaGameEngine
 		return hash;
 	}
 
+	/// <summary>
+	/// AdditiveHash - Compile time version for strings. Gives the same value as DefaultHash&lt;std::string&gt; for the same characters.
+	/// </summary>
+	constexpr size_t AdditiveHash(std::string_view key)
+	{
+		size_t hash = 0;
+
+		for (char c : key)
+		{
+			hash += HashPrime * static_cast<uint8_t>(c);
+		}
+
+		return hash;
+	}
+
 	template<typename TKey>
 	inline size_t DefaultHash<TKey>::operator()(const TKey& key) const
 	{
@@ -71,7 +71,7 @@ namespace FieaGameEngine
 		static void Unsubscribe(class IEventSubscriber&);
 
 		/// <summary>
-		/// UnsubscribeAll - Removes all Events subscribed from the list of subscribers (calls Vector::Clear() on the list)
+		/// UnsubscribeAll - Removes all Events subscribed from the list of subscribers.
 		/// </summary>
 		static void UnsubscribeAll();
 
@@ -83,9 +83,14 @@ namespace FieaGameEngine
 
 	private:
 		/// <summary>
-		/// _subscribers - Vector of all event subscribers that are subscribed to the event.
+		/// _subscribers - Vector of all event subscribers that are subscribed to the event. Replaced with an updated copy on every change, nullptr when empty.
 		/// </summary>
-		inline static Vector<IEventSubscriber*> _subscribers;
+		inline static RcuPointer<SubscriberList> _subscribers;
+
+		/// <summary>
+		/// _subscribersMutex - Serializes changes to _subscribers.
+		/// </summary>
+		inline static std::mutex _subscribersMutex;
 
 		/// <summary>
 		/// _message - Message payload of the event that is to be delivered to subscribers when notified.
@@ -13,35 +13,56 @@ namespace FieaGameEngine
 
 	template<typename T>
 	inline Event<T>::Event(T&& message) :
-		EventPublisher(_subscribers), _message(std::forward(message))
+		EventPublisher(_subscribers), _message(std::move(message))
 	{
 	}
 
 	template<typename T>
 	inline void Event<T>::Subscribe(IEventSubscriber& subscriber)
 	{
-		auto iterator = _subscribers.Find(&subscriber);
-		if (iterator == _subscribers.end())
+		std::lock_guard<std::mutex> lock(_subscribersMutex);
+		const SubscriberList* subscribers = _subscribers.Load();
+		if (subscribers == nullptr || subscribers->Find(&subscriber) == subscribers->end())
 		{
-			_subscribers.PushBack(&subscriber);
+			gsl::owner<SubscriberList*> updated = (subscribers != nullptr ? new SubscriberList(*subscribers) : new SubscriberList());
+			try
+			{
+				updated->PushBack(&subscriber);
+			}
+			catch (...)
+			{
+				delete updated;
+				throw;
+			}
+			_subscribers.Store(updated);
 		}
 	}
 
 	template<typename T>
 	inline void Event<T>::Unsubscribe(IEventSubscriber& subscriber)
 	{
-		auto iterator = _subscribers.Find(&subscriber);
-		if (iterator != _subscribers.end())
+		std::lock_guard<std::mutex> lock(_subscribersMutex);
+		const SubscriberList* subscribers = _subscribers.Load();
+		if (subscribers != nullptr && subscribers->Find(&subscriber) != subscribers->end())
 		{
-			_subscribers.Remove(iterator);
+			if (subscribers->Size() == 1)
+			{
+				_subscribers.Store(nullptr);
+			}
+			else
+			{
+				gsl::owner<SubscriberList*> updated = new SubscriberList(*subscribers);
+				updated->Remove(&subscriber);
+				_subscribers.Store(updated);
+			}
 		}
 	}
 
 	template<typename T>
 	inline void Event<T>::UnsubscribeAll()
 	{
-		_subscribers.Clear();
-		_subscribers.ShrinkToFit();
+		std::lock_guard<std::mutex> lock(_subscribersMutex);
+		_subscribers.Store(nullptr);
 	}
 
 	template<typename T>
@@ -5,15 +5,21 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(EventMessageAttributed)
 
-	const Vector<Signature> EventMessageAttributed::Signatures()
+	StaticSignatureList EventMessageAttributed::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Subtype", Datum::DatumType::String, 1, offsetof(EventMessageAttributed, _subType)},
-			{"GameObject", Datum::DatumType::Table, 0, 0}
+			REFLECT_FIELD("Subtype", EventMessageAttributed, _subType),
+			REFLECT_TABLE("GameObject", 0)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of EventMessageAttributed share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> EventMessageAttributed::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	EventMessageAttributed::EventMessageAttributed() :
@@ -34,7 +40,7 @@ namespace FieaGameEngine
 	void EventMessageAttributed::SetGameObject(const GameObject& gameObject)
 	{
 		assert(gameObject.Is(GameObject::TypeIdClass()));
-		Datum& d = _orderList[_gameObjectIndex]->second;
+		Datum& d = _table.At(_gameObjectIndex).second;
 		if (d.Size() == 0)
 		{
 			d.PushBack(gameObject);
@@ -45,10 +51,10 @@ namespace FieaGameEngine
 		}
 	}
 
-	GameObject* EventMessageAttributed::GetGameObject()
+	GameObject* EventMessageAttributed::GetGameObject() const
 	{
-		Datum& d = _orderList[_gameObjectIndex]->second;
-		return (d.Size() != 0 ? static_cast<GameObject*>(&d[0]) : nullptr);
+		const Datum& d = _table.At(_gameObjectIndex).second;
+		return (d.Size() != 0 ? static_cast<GameObject*>(d.Get<Scope*>(0)) : nullptr);
 	}
 
 	const std::string& EventMessageAttributed::GetSubType() const
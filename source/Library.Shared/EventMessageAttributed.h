@@ -49,7 +49,13 @@ namespace FieaGameEngine
 		/// Signatures - Returns the static signature vector for all prescribed attributes. Required for Attributed.
 		/// </summary>
 		/// <returns>Returns the static signature vector for all prescribed attributes.</returns>
-		const Vector<Signature> Signatures();
+		static const Vector<Signature> Signatures();
+
+		/// <summary>
+		/// StaticSignatures - Returns the compile time signatures of the prescribed attributes, declared with REFLECT_FIELD. Register with TypeManager::AddType&lt;EventMessageAttributed&gt;().
+		/// </summary>
+		/// <returns>View of the static signature array.</returns>
+		static StaticSignatureList StaticSignatures();
 
 		/// <summary>
 		/// GetSubType - Returns the subtype of the EventMessageAttributed.
@@ -61,7 +67,7 @@ namespace FieaGameEngine
 		/// GetGameObject - Returns a pointer to the game object to be effected by this event message attributed's payload
 		/// </summary>
 		/// <returns>Pointer to the game object to be effected by this event message attributed's payload</returns>
-		GameObject* GetGameObject();
+		GameObject* GetGameObject() const;
 
 		/// <summary>
 		/// SetSubType - sets the subtype of the event message attributed
@@ -94,7 +100,7 @@ namespace FieaGameEngine
 		std::string _subType;
 
 		/// <summary>
-		/// _gameObjectIndex - index of the GameObject prescribed attribute in the _orderList of this scope.
+		/// _gameObjectIndex - index of the GameObject prescribed attribute in the _table of this scope.
 		/// </summary>
 		const static size_t _gameObjectIndex = 2;
 	};
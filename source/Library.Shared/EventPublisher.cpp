@@ -5,14 +5,21 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(EventPublisher)
 
-	EventPublisher::EventPublisher(const Vector<IEventSubscriber*>& subscribers) :
+	EventPublisher::EventPublisher(const RcuPointer<SubscriberList>& subscribers) :
 		_subscribers(&subscribers)
 	{
 	}
 
 	void EventPublisher::Deliver() const
 	{
-		for (IEventSubscriber* subscriber : *(_subscribers))
+		Rcu::ReadGuard guard;
+		const SubscriberList* subscribers = _subscribers->Load();
+		if (subscribers == nullptr)
+		{
+			return;
+		}
+
+		for (IEventSubscriber* subscriber : *subscribers)
 		{
 			assert(subscriber != nullptr);
 			subscriber->Notify(*this);
@@ -1,6 +1,7 @@
 #pragma once
 #include "RTTI.h"
 #include "Vector.h"
+#include "Rcu.h"
 #include "IEventSubscriber.h"
 
 namespace FieaGameEngine
@@ -11,6 +12,10 @@ namespace FieaGameEngine
 		RTTI_DECLARATIONS(EventPublisher, RTTI)
 
 	public:
+		/// <summary>
+		/// SubscriberList - Subscribers of one event type, published through an RcuPointer so events can be delivered while other threads subscribe.
+		/// </summary>
+		using SubscriberList = Vector<IEventSubscriber*>;
 
 		/// <summary>
 		/// EventPublisher Default Constructor - Deleted to prevent instantiation without being provided a list of subscribers.
@@ -21,7 +26,7 @@ namespace FieaGameEngine
 		/// EventPublisher constructor - Takes a reference to a list of subscribers and stores it's address.
 		/// </summary>
 		/// <param name="subscribers">Address to a list of all subscribers to this event publisher.</param>
-		explicit EventPublisher(const Vector<IEventSubscriber*>& subscribers);
+		explicit EventPublisher(const RcuPointer<SubscriberList>& subscribers);
 
 		/// <summary>
 		/// EventPublisher Copy Constructor - defaulted since not responsible for the data of the subscriber pointer.
@@ -55,7 +60,8 @@ namespace FieaGameEngine
 		virtual ~EventPublisher() = default;
 
 		/// <summary>
-		/// Deliver - Loops through the list of subscribers and calls their Notify methods.
+		/// Deliver - Loops through the list of subscribers and calls their Notify methods. Subscribers added or removed during delivery take
+		/// effect from the next Deliver.
 		/// </summary>
 		void Deliver() const;
 
@@ -64,7 +70,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// _subscribers - Pointer to the list of subscribers to this event publisher
 		/// </summary>
-		const Vector<IEventSubscriber*>* _subscribers = nullptr;
+		const RcuPointer<SubscriberList>* _subscribers = nullptr;
 	};
 
 }
@@ -64,8 +64,12 @@ namespace FieaGameEngine
 			(*expiredStart)._event->Deliver();
 		}
 
-		//	Remove expired events
-		_events.Remove(it, _events.end());
+		//	Remove expired events. Vector::Remove takes the last element to remove rather than one past it, so they are popped instead.
+		size_t remaining = static_cast<size_t>(std::distance(_events.begin(), it));
+		while (_events.Size() > remaining)
+		{
+			_events.PopBack();
+		}
 	}
 
 	void EventQueue::Send(EventPublisher* e)
@@ -0,0 +1,106 @@
+#pragma once
+#include "IFactory.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// FactoryHandle Class - A factory resolved once, from a class name or from a product type, so repeated creation skips the name hash and
+	/// table lookup IFactory::Create does on every call. A handle does not keep its factory alive and must not be used after the factory is destroyed.
+	/// </summary>
+	/// <typeparam name="T">Abstract product type of the factory, as in IFactory.</typeparam>
+	template <typename T>
+	class FactoryHandle final
+	{
+	public:
+		/// <summary>
+		/// Constructor - Creates an empty handle.
+		/// </summary>
+		FactoryHandle() = default;
+
+		/// <summary>
+		/// Constructor - Resolves the factory registered for className.
+		/// </summary>
+		/// <param name="className">String containing the name of the class whose factory you are trying to access.</param>
+		explicit FactoryHandle(const std::string& className);
+
+		FactoryHandle(const FactoryHandle&) = default;
+		FactoryHandle(FactoryHandle&&) noexcept = default;
+		FactoryHandle& operator=(const FactoryHandle&) = default;
+		FactoryHandle& operator=(FactoryHandle&&) noexcept = default;
+		~FactoryHandle() = default;
+
+		/// <summary>
+		/// Of - Returns a handle to the factory of a product type, found through the type rather than its name.
+		/// </summary>
+		/// <typeparam name="TProduct">Concrete product type, the first argument of the ConcreteFactory macro.</typeparam>
+		/// <returns>Handle to the ProductFactory of TProduct, empty if none is alive.</returns>
+		template <typename TProduct>
+		static FactoryHandle Of();
+
+		/// <summary>
+		/// Create - Creates an instance of the factory's product.
+		/// </summary>
+		/// <returns>Address of the newly instantiated product, nullptr if the handle is empty. The calling scope must also delete the memory when done.</returns>
+		gsl::owner<T*> Create() const;
+
+		/// <summary>
+		/// CreateN - Creates count instances of the factory's product, see IFactory::CreateN.
+		/// </summary>
+		/// <param name="count">Number of products to create.</param>
+		/// <returns>Addresses of the new products, in creation order - empty if the handle is empty. The calling scope must delete each of them.</returns>
+		Vector<gsl::owner<T*>> CreateN(size_t count) const;
+
+		/// <summary>
+		/// IsValid - Tells you if the handle refers to a factory.
+		/// </summary>
+		/// <returns>True if a factory was resolved, else false.</returns>
+		bool IsValid() const;
+
+		/// <summary>
+		/// operator bool - Same as IsValid.
+		/// </summary>
+		explicit operator bool() const;
+
+		/// <summary>
+		/// ClassName - Returns the class name of the factory's product.
+		/// </summary>
+		/// <returns>String containing the class name.</returns>
+		/// <exception cref="std::runtime_error">Throws if the handle is empty.</exception>
+		const std::string& ClassName() const;
+
+		/// <summary>
+		/// Pool - Returns the pool the factory creates its products from.
+		/// </summary>
+		/// <returns>Reference to the factory's pool.</returns>
+		/// <exception cref="std::runtime_error">Throws if the handle is empty.</exception>
+		ObjectPool& Pool() const;
+
+		/// <summary>
+		/// operator== - Handles are equal if they refer to the same factory.
+		/// </summary>
+		bool operator==(const FactoryHandle& rhs) const;
+
+		/// <summary>
+		/// operator!= - Handles are not equal if they refer to different factories.
+		/// </summary>
+		bool operator!=(const FactoryHandle& rhs) const;
+
+	private:
+		/// <summary>
+		/// Constructor - Wraps an already resolved factory.
+		/// </summary>
+		explicit FactoryHandle(const IFactory<T>* factory);
+
+		/// <summary>
+		/// Throws if the handle is empty, otherwise returns the factory.
+		/// </summary>
+		const IFactory<T>& Factory() const;
+
+		/// <summary>
+		/// _factory - The resolved factory, nullptr for an empty handle.
+		/// </summary>
+		const IFactory<T>* _factory = nullptr;
+	};
+}
+
+#include "FactoryHandle.inl"
@@ -0,0 +1,83 @@
+#include "pch.h"
+#include "FactoryHandle.h"
+
+namespace FieaGameEngine
+{
+	template<typename T>
+	inline FactoryHandle<T>::FactoryHandle(const std::string& className) :
+		_factory(IFactory<T>::Find(className))
+	{
+	}
+
+	template<typename T>
+	inline FactoryHandle<T>::FactoryHandle(const IFactory<T>* factory) :
+		_factory(factory)
+	{
+	}
+
+	template<typename T>
+	template<typename TProduct>
+	inline FactoryHandle<T> FactoryHandle<T>::Of()
+	{
+		return FactoryHandle(IFactory<T>::template FindFor<TProduct>());
+	}
+
+	template<typename T>
+	inline gsl::owner<T*> FactoryHandle<T>::Create() const
+	{
+		return (_factory != nullptr ? _factory->Create() : nullptr);
+	}
+
+	template<typename T>
+	inline Vector<gsl::owner<T*>> FactoryHandle<T>::CreateN(size_t count) const
+	{
+		return IFactory<T>::CreateN(_factory, count);
+	}
+
+	template<typename T>
+	inline bool FactoryHandle<T>::IsValid() const
+	{
+		return _factory != nullptr;
+	}
+
+	template<typename T>
+	inline FactoryHandle<T>::operator bool() const
+	{
+		return _factory != nullptr;
+	}
+
+	template<typename T>
+	inline const std::string& FactoryHandle<T>::ClassName() const
+	{
+		return Factory().ClassName();
+	}
+
+	template<typename T>
+	inline ObjectPool& FactoryHandle<T>::Pool() const
+	{
+		return Factory().Pool();
+	}
+
+	template<typename T>
+	inline bool FactoryHandle<T>::operator==(const FactoryHandle& rhs) const
+	{
+		return _factory == rhs._factory;
+	}
+
+	template<typename T>
+	inline bool FactoryHandle<T>::operator!=(const FactoryHandle& rhs) const
+	{
+		return _factory != rhs._factory;
+	}
+
+	template<typename T>
+	inline const IFactory<T>& FactoryHandle<T>::Factory() const
+	{
+		if (_factory == nullptr)
+		{
+			throw std::runtime_error("Empty FactoryHandle - no factory was resolved. FactoryHandle::Factory()");
+		}
+
+		return *_factory;
+	}
+}
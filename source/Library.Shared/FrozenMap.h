@@ -0,0 +1,199 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// FrozenMix - Scrambles the bits of a 64 bit value (the splitmix64 finalizer), so nearby values land far apart.
+	/// </summary>
+	constexpr std::uint64_t FrozenMix(std::uint64_t value);
+
+	/// <summary>
+	/// FrozenHash - 64 bit key hashes for FrozenMap, usable at compile time. Integral and enum keys are mixed, strings are hashed with FNV-1a.
+	/// </summary>
+	template <typename TKey, typename = void>
+	struct FrozenHash;
+
+	template <typename TKey>
+	struct FrozenHash<TKey, std::enable_if_t<std::is_integral_v<TKey> || std::is_enum_v<TKey>>> final
+	{
+		constexpr std::uint64_t operator()(TKey key) const;
+	};
+
+	template <>
+	struct FrozenHash<std::string_view> final
+	{
+		constexpr std::uint64_t operator()(std::string_view key) const;
+	};
+
+	template <>
+	struct FrozenHash<std::string> final
+	{
+		std::uint64_t operator()(const std::string& key) const;
+	};
+
+	/// <summary>
+	/// FrozenEntry - A key and its value, as stored in a FrozenMap.
+	/// </summary>
+	template <typename TKey, typename TData>
+	struct FrozenEntry final
+	{
+		TKey first;
+		TData second;
+	};
+
+	/// <summary>
+	/// Size of a FrozenMap whose keys are only known at run time.
+	/// </summary>
+	inline constexpr std::size_t DynamicSize = std::numeric_limits<std::size_t>::max();
+
+	/// <summary>
+	/// FrozenMap Class - Immutable map over a key set fixed at construction, for lookup tables that never change once built. The constructor searches
+	/// for a minimal perfect hash (hash and displace: keys are split into buckets, and each bucket gets the seed that sends its keys to free slots), so a
+	/// lookup is one key hash, one seed read and one key compare against a flat array, with no chains or probing.
+	/// With an EntryCount the entries live in the map itself and a map of literal keys can be built at compile time with MakeFrozenMap. With DynamicSize
+	/// they are kept in a Vector and built from a Vector of entries at run time.
+	/// </summary>
+	/// <typeparam name="TKey">Key type. Compile time maps use std::string_view for text.</typeparam>
+	/// <typeparam name="TData">Value type.</typeparam>
+	/// <typeparam name="EntryCount">Number of entries, or DynamicSize.</typeparam>
+	/// <typeparam name="HashFunctor">Hash with the interface of FrozenHash.</typeparam>
+	template <typename TKey, typename TData, std::size_t EntryCount = DynamicSize, typename HashFunctor = FrozenHash<TKey>>
+	class FrozenMap final
+	{
+	public:
+		using Entry = FrozenEntry<TKey, TData>;
+
+		/// <summary>
+		/// Constructor - Builds the map over a fixed number of entries. Constant evaluated when the entries are constants.
+		/// </summary>
+		/// <param name="entries">The map's entries. Keys must be unique.</param>
+		/// <exception cref="std::runtime_error">Throws if a key appears twice - a compile error for a constant map.</exception>
+		template <std::size_t Length, typename = std::enable_if_t<Length == EntryCount>>
+		constexpr explicit FrozenMap(const Entry(&entries)[Length]);
+
+		/// <summary>
+		/// Constructor - Builds a DynamicSize map over entries known at run time.
+		/// </summary>
+		/// <param name="entries">The map's entries. Keys must be unique.</param>
+		/// <exception cref="std::runtime_error">Throws if a key appears twice.</exception>
+		explicit FrozenMap(const Vector<Entry>& entries);
+
+		/// <summary>
+		/// Find - Looks a key up.
+		/// </summary>
+		/// <param name="key">Key to look up.</param>
+		/// <returns>Address of the key's value, nullptr if the key isn't in the map.</returns>
+		constexpr const TData* Find(const TKey& key) const;
+
+		/// <summary>
+		/// At - Returns the value of a key that must be in the map.
+		/// </summary>
+		/// <param name="key">Key to look up.</param>
+		/// <returns>Reference to the key's value.</returns>
+		/// <exception cref="std::runtime_error">Throws if the key isn't in the map.</exception>
+		constexpr const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// ContainsKey - Checks if a key is in the map.
+		/// </summary>
+		constexpr bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Size - Returns the number of entries.
+		/// </summary>
+		constexpr std::size_t Size() const;
+
+		/// <summary>
+		/// IsEmpty - Tells you if the map has no entries.
+		/// </summary>
+		constexpr bool IsEmpty() const;
+
+		/// <summary>
+		/// begin - Iterates the entries, in slot order.
+		/// </summary>
+		constexpr auto begin() const { return _entries.begin(); }
+
+		/// <summary>
+		/// end - End of the entries.
+		/// </summary>
+		constexpr auto end() const { return _entries.end(); }
+
+	private:
+		static constexpr bool IsDynamic = (EntryCount == DynamicSize);
+
+		/// <summary>
+		/// Storage for entries, seeds and the builder's scratch: an array of Length in the map for a fixed EntryCount, a Vector otherwise.
+		/// </summary>
+		template <typename T, std::size_t Length>
+		using Storage = std::conditional_t<IsDynamic, Vector<T>, std::array<T, (IsDynamic ? 1 : Length)>>;
+
+		/// <summary>
+		/// Seeds tried per bucket before giving up. Only unique keys can run out, duplicates never find a seed.
+		/// </summary>
+		static constexpr std::uint32_t MaxSeed = 1u << 16;
+
+		/// <summary>
+		/// Number of buckets for count keys - two keys per bucket on average.
+		/// </summary>
+		static constexpr std::size_t BucketCountFor(std::size_t count) { return (count + 1) / 2; }
+
+		/// <summary>
+		/// Number of buckets of a fixed EntryCount map.
+		/// </summary>
+		static constexpr std::size_t FixedBucketCount = BucketCountFor(IsDynamic ? 0 : EntryCount);
+
+		/// <summary>
+		/// Slot a key hash lands in with a bucket's seed.
+		/// </summary>
+		constexpr std::size_t Slot(std::uint64_t hash, std::uint32_t seed) const;
+
+		/// <summary>
+		/// Sizes a Vector to count elements. Arrays are already full size.
+		/// </summary>
+		template <typename TStorage>
+		static constexpr void Allocate(TStorage& storage, std::size_t count);
+
+		/// <summary>
+		/// Searches the seeds and places source's entries in their slots.
+		/// </summary>
+		template <typename TSource>
+		constexpr void Build(const TSource& source);
+
+		/// <summary>
+		/// _entries - Entries by slot.
+		/// </summary>
+		Storage<Entry, EntryCount> _entries{};
+
+		/// <summary>
+		/// _seeds - Seed of each bucket.
+		/// </summary>
+		Storage<std::uint32_t, FixedBucketCount> _seeds{};
+
+		/// <summary>
+		/// _size - Number of entries.
+		/// </summary>
+		std::size_t _size;
+
+		/// <summary>
+		/// _bucketCount - Number of buckets.
+		/// </summary>
+		std::size_t _bucketCount;
+	};
+
+	/// <summary>
+	/// MakeFrozenMap - Builds a FrozenMap sized to a list of entries, at compile time when they are constants:
+	/// constexpr auto map = MakeFrozenMap&lt;std::string_view, int&gt;({ { "one", 1 }, { "two", 2 } });
+	/// </summary>
+	template <typename TKey, typename TData, std::size_t Count>
+	constexpr FrozenMap<TKey, TData, Count> MakeFrozenMap(const FrozenEntry<TKey, TData>(&entries)[Count]);
+}
+
+#include "FrozenMap.inl"
@@ -0,0 +1,246 @@
+#include "pch.h"
+#include "FrozenMap.h"
+
+namespace FieaGameEngine
+{
+#pragma region FrozenHash
+	constexpr std::uint64_t FrozenMix(std::uint64_t value)
+	{
+		value ^= value >> 30;
+		value *= 0xBF58476D1CE4E5B9ull;
+		value ^= value >> 27;
+		value *= 0x94D049BB133111EBull;
+		value ^= value >> 31;
+		return value;
+	}
+
+	template<typename TKey>
+	constexpr std::uint64_t FrozenHash<TKey, std::enable_if_t<std::is_integral_v<TKey> || std::is_enum_v<TKey>>>::operator()(TKey key) const
+	{
+		return FrozenMix(static_cast<std::uint64_t>(key));
+	}
+
+	constexpr std::uint64_t FrozenHash<std::string_view>::operator()(std::string_view key) const
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		for (char c : key)
+		{
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	inline std::uint64_t FrozenHash<std::string>::operator()(const std::string& key) const
+	{
+		return FrozenHash<std::string_view>{}(key);
+	}
+#pragma endregion
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	template<std::size_t Length, typename>
+	constexpr FrozenMap<TKey, TData, EntryCount, HashFunctor>::FrozenMap(const Entry(&entries)[Length]) :
+		_size(Length), _bucketCount(FixedBucketCount)
+	{
+		Build(entries);
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	inline FrozenMap<TKey, TData, EntryCount, HashFunctor>::FrozenMap(const Vector<Entry>& entries) :
+		_size(entries.Size()), _bucketCount(BucketCountFor(entries.Size()))
+	{
+		static_assert(IsDynamic, "Maps with a fixed EntryCount are built from an array of exactly that many entries.");
+		Allocate(_entries, _size);
+		Allocate(_seeds, _bucketCount);
+		Build(entries);
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	constexpr const TData* FrozenMap<TKey, TData, EntryCount, HashFunctor>::Find(const TKey& key) const
+	{
+		if (_size == 0)
+		{
+			return nullptr;
+		}
+
+		const std::uint64_t hash = HashFunctor{}(key);
+		const Entry& entry = _entries[Slot(hash, _seeds[static_cast<std::size_t>(hash % _bucketCount)])];
+		return (entry.first == key ? &entry.second : nullptr);
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	constexpr const TData& FrozenMap<TKey, TData, EntryCount, HashFunctor>::At(const TKey& key) const
+	{
+		const TData* data = Find(key);
+		if (data == nullptr)
+		{
+			throw std::runtime_error("Key not found with At()");
+		}
+
+		return *data;
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	constexpr bool FrozenMap<TKey, TData, EntryCount, HashFunctor>::ContainsKey(const TKey& key) const
+	{
+		return Find(key) != nullptr;
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	constexpr std::size_t FrozenMap<TKey, TData, EntryCount, HashFunctor>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	constexpr bool FrozenMap<TKey, TData, EntryCount, HashFunctor>::IsEmpty() const
+	{
+		return _size == 0;
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	constexpr std::size_t FrozenMap<TKey, TData, EntryCount, HashFunctor>::Slot(std::uint64_t hash, std::uint32_t seed) const
+	{
+		return static_cast<std::size_t>(FrozenMix(hash + seed * 0x9E3779B97F4A7C15ull) % _size);
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	template<typename TStorage>
+	constexpr void FrozenMap<TKey, TData, EntryCount, HashFunctor>::Allocate(TStorage& storage, std::size_t count)
+	{
+		if constexpr (IsDynamic)
+		{
+			storage.Resize(count);
+		}
+		else
+		{
+			UNREFERENCED_LOCAL(storage);
+			UNREFERENCED_LOCAL(count);
+		}
+	}
+
+	template<typename TKey, typename TData, std::size_t EntryCount, typename HashFunctor>
+	template<typename TSource>
+	constexpr void FrozenMap<TKey, TData, EntryCount, HashFunctor>::Build(const TSource& source)
+	{
+		const std::size_t count = _size;
+		if (count == 0)
+		{
+			return;
+		}
+
+		//	Bucket the keys by hash, as runs of members between offsets
+		Storage<std::uint64_t, EntryCount> hashes{};
+		Storage<std::size_t, FixedBucketCount + 1> offsets{};
+		Storage<std::size_t, FixedBucketCount> cursors{};
+		Storage<std::size_t, FixedBucketCount> order{};
+		Storage<std::size_t, EntryCount> members{};
+		Storage<std::size_t, EntryCount> slots{};
+		Storage<bool, EntryCount> isTaken{};
+		Allocate(hashes, count);
+		Allocate(offsets, _bucketCount + 1);
+		Allocate(cursors, _bucketCount);
+		Allocate(order, _bucketCount);
+		Allocate(members, count);
+		Allocate(slots, count);
+		Allocate(isTaken, count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			hashes[i] = HashFunctor{}(source[i].first);
+			++offsets[static_cast<std::size_t>(hashes[i] % _bucketCount) + 1];
+		}
+
+		for (std::size_t b = 0; b < _bucketCount; ++b)
+		{
+			offsets[b + 1] += offsets[b];
+			cursors[b] = offsets[b];
+			order[b] = b;
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			members[cursors[static_cast<std::size_t>(hashes[i] % _bucketCount)]++] = i;
+		}
+
+		//	Largest buckets first, while there are the most free slots to fit them in
+		for (std::size_t i = 1; i < _bucketCount; ++i)
+		{
+			const std::size_t bucket = order[i];
+			const std::size_t bucketSize = offsets[bucket + 1] - offsets[bucket];
+			std::size_t j = i;
+			for (; j > 0 && offsets[order[j - 1] + 1] - offsets[order[j - 1]] < bucketSize; --j)
+			{
+				order[j] = order[j - 1];
+			}
+			order[j] = bucket;
+		}
+
+		for (std::size_t i = 0; i < _bucketCount; ++i)
+		{
+			const std::size_t bucket = order[i];
+			const std::size_t first = offsets[bucket];
+			const std::size_t bucketSize = offsets[bucket + 1] - first;
+			if (bucketSize == 0)
+			{
+				break;
+			}
+
+			//	Equal keys share a bucket and could never be separated
+			for (std::size_t j = 1; j < bucketSize; ++j)
+			{
+				for (std::size_t k = 0; k < j; ++k)
+				{
+					if (hashes[members[first + j]] == hashes[members[first + k]] && source[members[first + j]].first == source[members[first + k]].first)
+					{
+						throw std::runtime_error("Duplicate key given to FrozenMap.");
+					}
+				}
+			}
+
+			std::uint32_t seed = 0;
+			for (;; ++seed)
+			{
+				if (seed == MaxSeed)
+				{
+					throw std::runtime_error("FrozenMap found no perfect hash for its keys.");
+				}
+
+				std::size_t placed = 0;
+				for (; placed < bucketSize; ++placed)
+				{
+					const std::size_t slot = Slot(hashes[members[first + placed]], seed);
+					if (isTaken[slot])
+					{
+						break;
+					}
+					isTaken[slot] = true;
+					slots[placed] = slot;
+				}
+
+				if (placed == bucketSize)
+				{
+					break;
+				}
+
+				for (std::size_t j = 0; j < placed; ++j)
+				{
+					isTaken[slots[j]] = false;
+				}
+			}
+
+			_seeds[bucket] = seed;
+			for (std::size_t j = 0; j < bucketSize; ++j)
+			{
+				_entries[slots[j]] = source[members[first + j]];
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, std::size_t Count>
+	constexpr FrozenMap<TKey, TData, Count> MakeFrozenMap(const FrozenEntry<TKey, TData>(&entries)[Count])
+	{
+		return FrozenMap<TKey, TData, Count>(entries);
+	}
+}
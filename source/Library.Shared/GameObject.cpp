@@ -40,53 +40,63 @@ namespace FieaGameEngine
 
 #pragma endregion
 
-	const Vector<Signature> GameObject::Signatures()
+	StaticSignatureList GameObject::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(GameObject, _name)},
-			{"Transform", Datum::DatumType::Matrix, 1, offsetof(GameObject, _transform)},
-			{"Actions", Datum::DatumType::Table, 0, 0},
-			{"Children", Datum::DatumType::Table, 0, 0}
+			REFLECT_FIELD("Name", GameObject, _name),
+			REFLECT_FIELD("Transform", GameObject, _transform),
+			REFLECT_TABLE("Actions", 0),
+			REFLECT_TABLE("Children", 0)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of GameObject share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> GameObject::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	GameObject::GameObject() :
 		Attributed(TypeIdClass())
 	{
-		assert(_orderList.At(_actionsIndex)->first == "Actions");
-		assert(_orderList.At(_actionsIndex)->second.Type() == Datum::DatumType::Table);
-		assert(_orderList.At(_childrenIndex)->first == "Children");
-		assert(_orderList.At(_childrenIndex)->second.Type() == Datum::DatumType::Table);
+		assert(_table.At(_actionsIndex).first == "Actions");
+		assert(_table.At(_actionsIndex).second.Type() == Datum::DatumType::Table);
+		assert(_table.At(_childrenIndex).first == "Children");
+		assert(_table.At(_childrenIndex).second.Type() == Datum::DatumType::Table);
 
-		_updateTable.Insert(std::make_pair("Children", &(_orderList[_childrenIndex]->second)));
-		_actionTable.Insert(std::make_pair("Actions", &(_orderList[_actionsIndex]->second)));
+		_updateTable.Insert(std::make_pair("Children", &(_table.At(_childrenIndex).second)));
+		_actionTable.Insert(std::make_pair("Actions", &(_table.At(_actionsIndex).second)));
 	}
 
 	GameObject::GameObject(RTTI::IdType typeID) :
 		Attributed(typeID)
 	{
-		assert(_orderList.At(_actionsIndex)->first == "Actions");
-		assert(_orderList.At(_actionsIndex)->second.Type() == Datum::DatumType::Table);
+		assert(_table.At(_actionsIndex).first == "Actions");
+		assert(_table.At(_actionsIndex).second.Type() == Datum::DatumType::Table);
 
-		assert(_orderList.At(_childrenIndex)->first == "Children");
-		assert(_orderList.At(_childrenIndex)->second.Type() == Datum::DatumType::Table);
+		assert(_table.At(_childrenIndex).first == "Children");
+		assert(_table.At(_childrenIndex).second.Type() == Datum::DatumType::Table);
 
-		_updateTable.Insert(std::make_pair("Children", &(_orderList[_childrenIndex]->second)));
-		_actionTable.Insert(std::make_pair("Actions", &(_orderList[_actionsIndex]->second)));
+		_updateTable.Insert(std::make_pair("Children", &(_table.At(_childrenIndex).second)));
+		_actionTable.Insert(std::make_pair("Actions", &(_table.At(_actionsIndex).second)));
 	}
 
 	Datum& GameObject::Actions()
 	{
-		return _orderList[_actionsIndex]->second;
+		return _table.At(_actionsIndex).second;
 	}
 
 	void GameObject::CreateAction(const std::string& className, const std::string& instanceName)
 	{
-		const IFactory<Scope>* fp;
-		Scope* newAction = fp->Create(className);
+		CreateAction(FactoryHandle<Scope>(className), instanceName);
+	}
+
+	void GameObject::CreateAction(const FactoryHandle<Scope>& factory, const std::string& instanceName)
+	{
+		Scope* newAction = factory.Create();
 
 		if (newAction == nullptr)
 		{
@@ -135,8 +145,12 @@ namespace FieaGameEngine
 
 	typename GameObject* GameObject::CreateGameObject(const std::string& className, const std::string& instanceName)
 	{
-		const IFactory<Scope>* fp;
-		Scope* newObject = fp->Create(className);
+		return CreateGameObject(FactoryHandle<Scope>(className), instanceName);
+	}
+
+	typename GameObject* GameObject::CreateGameObject(const FactoryHandle<Scope>& factory, const std::string& instanceName)
+	{
+		Scope* newObject = factory.Create();
 
 		if (newObject == nullptr)
 		{
@@ -194,7 +208,7 @@ namespace FieaGameEngine
 
 	Datum& GameObject::Children()
 	{
-		return _orderList[_childrenIndex]->second;
+		return _table.At(_childrenIndex).second;
 	}
 
 	EventQueue* GameState::GetEventQueue()
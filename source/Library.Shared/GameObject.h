@@ -2,7 +2,7 @@
 #include "Attributed.h"
 #include "GameTime.h"
 #include "GameClock.h"
-#include "IFactory.h"
+#include "FactoryHandle.h"
 #include "Action.h"
 
 namespace FieaGameEngine
@@ -188,6 +188,15 @@ namespace FieaGameEngine
 		/// cause a runtime_error.</exception>
 		GameObject* CreateGameObject(const std::string& className, const std::string& instanceName);
 
+		/// <summary>
+		/// CreateGameObject - Creates an instance of a game object from an already resolved factory, skipping the Factory manager lookup.
+		/// </summary>
+		/// <param name="factory">Handle to the factory of the Class that you wish to create.</param>
+		/// <param name="instanceName">Key that you wish for the instantiated class to be associated with in the GameObject hierarchy.</param>
+		/// <returns>Pointer to the game object that is created.</returns>
+		/// <exception cref="std::runtime_error">Passing in an empty handle will cause a runtime_error.</exception>
+		GameObject* CreateGameObject(const FactoryHandle<Scope>& factory, const std::string& instanceName);
+
 		/// <summary>
 		/// CreateAction - Convenience method that Creates a factory scope based on the passed in class name and adopts it to the gameObject paired
 		/// with the associated instanceName.
@@ -197,6 +206,15 @@ namespace FieaGameEngine
 		///	<exception cref="std::runtime_error">Passing in a className that has no registered factory will cause a runtime error.</exception>
 		void CreateAction(const std::string& className, const std::string& instanceName);
 
+		/// <summary>
+		/// CreateAction - Creates an action from an already resolved factory, skipping the Factory manager lookup, and adopts it to the gameObject
+		/// paired with the associated instanceName.
+		/// </summary>
+		/// <param name="factory">Handle to the factory of the action you wish to create.</param>
+		/// <param name="instanceName">Key string that you wish to associate with the action.</param>
+		///	<exception cref="std::runtime_error">Passing in an empty handle will cause a runtime error.</exception>
+		void CreateAction(const FactoryHandle<Scope>& factory, const std::string& instanceName);
+
 		/// <summary>
 		/// Update - Calls all the update functions of all children in the hierarchy.
 		/// </summary>
@@ -214,6 +232,12 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>Vector of signatures of all prescribed objects.</returns>
 		static const Vector<Signature> Signatures();
+
+		/// <summary>
+		/// StaticSignatures - Returns the compile time signatures of the prescribed attributes, declared with REFLECT_FIELD. Register with TypeManager::AddType&lt;GameObject&gt;().
+		/// </summary>
+		/// <returns>View of the static signature array.</returns>
+		static StaticSignatureList StaticSignatures();
 	protected:
 		/// <summary>
 		/// TypeID constructor - Constructor provided for children to call in their default constructors. Registers the Type ID of "this" game object as
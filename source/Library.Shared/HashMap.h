@@ -446,6 +446,12 @@ namespace FieaGameEngine
 		/// <returns>Current number of elements in the HashMap as a size_t.</returns>
 		size_t Size() const;
 
+		/// <summary>
+		/// Returns the number of buckets (chains) the HashMap hashes into. Only changes on Resize().
+		/// </summary>
+		/// <returns>Current number of buckets as a size_t.</returns>
+		size_t BucketCount() const;
+
 #pragma endregion
 
 #pragma region HashMap Iterator/ConstIterator Public Method Calls
@@ -174,6 +174,12 @@ namespace FieaGameEngine
 		return _size;
 	}
 
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t HashMap<TKey, TData, HashFunctor, EqualityFunctor>::BucketCount() const
+	{
+		return _buckets.Size();
+	}
+
 	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
 	inline void HashMap<TKey, TData, HashFunctor, EqualityFunctor>::Resize(const size_t& size)
 	{
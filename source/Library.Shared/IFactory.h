@@ -1,8 +1,13 @@
 #pragma once
-#include "HashMap.h"
+#include "ConcurrentHashMap.h"
+#include "ObjectPool.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
+	template <typename T>
+	class FactoryHandle;
+
 	/// <summary>
 	/// IFactory Class - Interface for the ConcreteFactory macro. Also provides an interface as a manager for Factory Classes.
 	/// </summary>
@@ -17,6 +22,13 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>String containing the class name of the calling child.</returns>
 		virtual const std::string& ClassName() const = 0;
+
+		/// <summary>
+		/// Pool - Pure Virtual, returns the pool the factory creates its products from. Implemented by the ConcreteFactory macro.
+		/// Products that aren't pool allocated (see IsPoolAllocated) are created with a plain new and leave the pool empty.
+		/// </summary>
+		/// <returns>Reference to the factory's pool.</returns>
+		virtual ObjectPool& Pool() const = 0;
 	private:
 		/// <summary>
 		/// Create - Pure Virtual, Creates an instance of a product in a factory class. Returns a pointer to the newly instantiated object.
@@ -24,6 +36,26 @@ namespace FieaGameEngine
 		/// <returns>Address of the newly instantiated product. The calling scope must also delete the memory when done.</returns>
 		virtual gsl::owner<T*> Create() const = 0;
 
+		/// <summary>
+		/// Create - Pure Virtual, Creates count instances of a product and appends them to products. Implemented by the ConcreteFactory macro.
+		/// </summary>
+		/// <param name="count">Number of products to create.</param>
+		/// <param name="products">Vector the addresses of the new products are appended to.</param>
+		virtual void Create(size_t count, Vector<gsl::owner<T*>>& products) const = 0;
+
+		/// <summary>
+		/// CreateN - Creates count products from an already resolved factory. Deletes the products made so far if one of them throws.
+		/// </summary>
+		/// <param name="factory">Factory to create from, may be nullptr.</param>
+		/// <param name="count">Number of products to create.</param>
+		/// <returns>Addresses of the new products, empty if factory is nullptr.</returns>
+		static Vector<gsl::owner<T*>> CreateN(const IFactory* factory, size_t count);
+
+		/// <summary>
+		/// FactoryHandle calls Create directly on the factory it resolved.
+		/// </summary>
+		friend class FactoryHandle<T>;
+
 #pragma endregion
 
 #pragma region Factory Manager
@@ -36,6 +68,15 @@ namespace FieaGameEngine
 		/// <returns>Address of the newly instantiated product. The calling scope must also delete the memory when done.</returns>
 		static gsl::owner<T*> Create(const std::string& className);
 
+		/// <summary>
+		/// CreateN - Creates count instances of a product with a single factory lookup. Pool allocated products are carved back to back from one new block
+		/// of the factory's pool, whatever its free list holds.
+		/// </summary>
+		/// <param name="className">String containing the name of the class whose factory you are trying to access.</param>
+		/// <param name="count">Number of products to create.</param>
+		/// <returns>Addresses of the new products, in creation order - empty if no factory of that class is registered. The calling scope must delete each of them.</returns>
+		static Vector<gsl::owner<T*>> CreateN(const std::string& className, size_t count);
+
 		/// <summary>
 		/// Find - Finds and returns the address of a factory that produces products of the className passed into this method.
 		/// </summary>
@@ -43,6 +84,22 @@ namespace FieaGameEngine
 		/// <returns>Address to the ProductFactory of the corresponding class that was passed into this method.</returns>
 		static const IFactory* Find(const std::string& className);
 
+		/// <summary>
+		/// FindFor - Returns the registered factory of a product type without a name lookup. Each ConcreteFactory binds itself to its product type
+		/// when constructed and unbinds when destroyed.
+		/// </summary>
+		/// <typeparam name="TProduct">Concrete product type, the first argument of the ConcreteFactory macro.</typeparam>
+		/// <returns>Address of the ProductFactory of TProduct, nullptr if none is alive.</returns>
+		template <typename TProduct>
+		static const IFactory* FindFor();
+
+		/// <summary>
+		/// FindPool - Finds the pool of the factory that produces products of the className passed into this method, to reserve ahead or read its statistics.
+		/// </summary>
+		/// <param name="className">String containing the name of the class whose pool you are trying to retrieve.</param>
+		/// <returns>Address of the factory's pool, nullptr if no factory of that class is registered.</returns>
+		static ObjectPool* FindPool(const std::string& className);
+
 		/// <summary>
 		/// Size - Returns the number of ProductFactories that have been registered into the manager at current time.
 		/// </summary>
@@ -50,10 +107,22 @@ namespace FieaGameEngine
 		static size_t Size();
 
 		/// <summary>
-		/// Clear - Clears all factories in the factory manager.
+		/// Clear - Clears all factories in the factory manager. Factories stay bound to their product types for FindFor until they are destroyed.
 		/// </summary>
 		static void Clear();
 
+		/// <summary>
+		/// Freeze - Builds a perfect hash of the registered factories for Find and Create to look names up in. Call once every factory is registered -
+		/// adding or removing a factory afterwards goes back to the regular table until Freeze is called again.
+		/// </summary>
+		static void Freeze();
+
+		/// <summary>
+		/// IsFrozen - Tells you if lookups currently go through the perfect hash built by Freeze.
+		/// </summary>
+		/// <returns>True if frozen, else false.</returns>
+		static bool IsFrozen();
+
 		/// <summary>
 		/// IsEmpty - Tells you if there are any factories registered in the manager.
 		/// </summary>
@@ -61,7 +130,7 @@ namespace FieaGameEngine
 		static bool IsEmpty();
 
 		/// <summary>
-		/// Resize - Resizes the factory manager's hashmap to however many buckets you pass in. Preserves any already existing entries but does rehash them.
+		/// Resize - Makes room in the factory manager for however many factories you pass in. Preserves any already existing entries.
 		/// </summary>
 		static void Resize(const size_t& size);
 
@@ -80,11 +149,32 @@ namespace FieaGameEngine
 		/// <param name="factory">Factory to be removed from the manager.</param>
 		static void Remove(const IFactory& factory);
 
+		/// <summary>
+		/// Bind - Makes the passed in factory the one FindFor returns for TProduct.
+		/// </summary>
+		/// <param name="factory">Factory producing TProduct.</param>
+		template <typename TProduct>
+		static void Bind(const IFactory& factory);
+
+		/// <summary>
+		/// Unbind - Clears the factory FindFor returns for TProduct, if it is still the passed in factory.
+		/// </summary>
+		/// <param name="factory">Factory producing TProduct.</param>
+		template <typename TProduct>
+		static void Unbind(const IFactory& factory);
+
 	private:
 		/// <summary>
-		/// _factoryTable - A table of string : factory pairs that stores all currently registered factories.
+		/// _factoryTable - A table of string : factory pairs that stores all currently registered factories. Lookups are lock free, so factories
+		/// can be found and created from on any thread.
+		/// </summary>
+		inline static ConcurrentHashMap<std::string, const IFactory*> _factoryTable;
+
+		/// <summary>
+		/// _productFactory - The factory bound to each product type, one slot per TProduct.
 		/// </summary>
-		inline static HashMap<const std::string, const IFactory*> _factoryTable;
+		template <typename TProduct>
+		inline static const IFactory* _productFactory = nullptr;
 
 #pragma endregion
 
@@ -94,7 +184,8 @@ namespace FieaGameEngine
 
 /// <summary>
 /// ConcreteFactory - Macro that creates a ProductFactory class for integration with Json Parsing. Registers the factory in the IFactory manager
-/// upon construction of a ProductFactory and similarly removes it upon destruction.
+/// upon construction of a ProductFactory and similarly removes it upon destruction. Pool allocated products are created from the factory's
+/// ObjectPool and return to it when deleted.
 /// </summary>
 #define ConcreteFactory(Product, AbstractProduct)										\
 	class Product##Factory final : FieaGameEngine::IFactory<AbstractProduct>			\
@@ -103,10 +194,12 @@ namespace FieaGameEngine
 		Product##Factory()																\
 		{																				\
 			Add(*this);																	\
+			Bind<Product>(*this);														\
 		}																				\
 																						\
 		~Product##Factory()																\
 		{																				\
+			Unbind<Product>(*this);														\
 			Remove(*this);																\
 		}																				\
 																						\
@@ -115,13 +208,24 @@ namespace FieaGameEngine
 			return _className;															\
 		}																				\
 																						\
+		FieaGameEngine::ObjectPool& Pool() const override								\
+		{																				\
+			return _pool;																\
+		}																				\
+																						\
 	private:																			\
 		gsl::owner<AbstractProduct*> Create() const override							\
 		{																				\
-			return new Product();														\
+			return _pool.Create<Product>();												\
+		}																				\
+																						\
+		void Create(size_t count, FieaGameEngine::Vector<gsl::owner<AbstractProduct*>>& products) const override \
+		{																				\
+			_pool.Create<Product>(count, products);										\
 		}																				\
 																						\
 		const std::string _className = #Product;										\
+		mutable FieaGameEngine::ObjectPool _pool{ sizeof(Product) };					\
 	};
 
 #pragma endregion
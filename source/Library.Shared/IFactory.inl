@@ -6,10 +6,7 @@ namespace FieaGameEngine
 	template<typename T>
 	inline void IFactory<T>::Add(const IFactory<T>& factory)
 	{
-		auto it = _factoryTable.Insert(std::make_pair(factory.ClassName(), &factory));
-
-		//	If wasInserted == false
-		if (it.second == false)
+		if (_factoryTable.Insert(std::make_pair(factory.ClassName(), &factory)) == false)
 		{
 			throw std::runtime_error("Attempting to register a class into the factory table that is already present.");
 		}
@@ -22,11 +19,55 @@ namespace FieaGameEngine
 		return (factory != nullptr ? factory->Create() : nullptr);
 	}
 
+	template<typename T>
+	inline Vector<gsl::owner<T*>> IFactory<T>::CreateN(const std::string& className, size_t count)
+	{
+		return CreateN(Find(className), count);
+	}
+
+	template<typename T>
+	inline Vector<gsl::owner<T*>> IFactory<T>::CreateN(const IFactory* factory, size_t count)
+	{
+		Vector<gsl::owner<T*>> products;
+		if (factory != nullptr)
+		{
+			products.Reserve(count);
+			try
+			{
+				factory->Create(count, products);
+			}
+			catch (...)
+			{
+				for (T* product : products)
+				{
+					delete product;
+				}
+				throw;
+			}
+		}
+
+		return products;
+	}
+
 	template<typename T>
 	inline typename const IFactory<T>* IFactory<T>::Find(const std::string& className)
 	{
-		auto it = _factoryTable.Find(className);
-		return (it != _factoryTable.end() ? it->second : nullptr);
+		const IFactory* const* factory = _factoryTable.Find(className);
+		return (factory != nullptr ? *factory : nullptr);
+	}
+
+	template<typename T>
+	template<typename TProduct>
+	inline const IFactory<T>* IFactory<T>::FindFor()
+	{
+		return _productFactory<TProduct>;
+	}
+
+	template<typename T>
+	inline ObjectPool* IFactory<T>::FindPool(const std::string& className)
+	{
+		const IFactory* const factory = Find(className);
+		return (factory != nullptr ? &factory->Pool() : nullptr);
 	}
 
 	template<typename T>
@@ -35,6 +76,23 @@ namespace FieaGameEngine
 		_factoryTable.Remove(factory.ClassName());
 	}
 
+	template<typename T>
+	template<typename TProduct>
+	inline void IFactory<T>::Bind(const IFactory<T>& factory)
+	{
+		_productFactory<TProduct> = &factory;
+	}
+
+	template<typename T>
+	template<typename TProduct>
+	inline void IFactory<T>::Unbind(const IFactory<T>& factory)
+	{
+		if (_productFactory<TProduct> == &factory)
+		{
+			_productFactory<TProduct> = nullptr;
+		}
+	}
+
 	template<typename T>
 	inline size_t IFactory<T>::Size()
 	{
@@ -47,6 +105,18 @@ namespace FieaGameEngine
 		_factoryTable.Clear();
 	}
 
+	template<typename T>
+	inline void IFactory<T>::Freeze()
+	{
+		_factoryTable.Freeze();
+	}
+
+	template<typename T>
+	inline bool IFactory<T>::IsFrozen()
+	{
+		return _factoryTable.IsFrozen();
+	}
+
 	template<typename T>
 	inline bool IFactory<T>::IsEmpty()
 	{
@@ -56,7 +126,7 @@ namespace FieaGameEngine
 	template<typename T>
 	inline void IFactory<T>::Resize(const size_t& size)
 	{
-		_factoryTable.Resize(size);
+		_factoryTable.Reserve(size);
 	}
 
 }
\ No newline at end of file
@@ -5,7 +5,28 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(IJsonParseHelper)
 
+	bool IJsonParseHelper::HasKind(ValueKinds kinds, ValueKinds kind)
+	{
+		return (static_cast<std::uint8_t>(kinds) & static_cast<std::uint8_t>(kind)) != 0;
+	}
+
 	void IJsonParseHelper::Initialize() {}
 
 	void IJsonParseHelper::CleanUp() {}
+
+	void IJsonParseHelper::ArrayStartHandler(SharedData&, const std::string&, const Json::Value&) {}
+
+	void IJsonParseHelper::ArrayEndHandler(SharedData&, const std::string&) {}
+
+	void IJsonParseHelper::DeclareKeywords(Vector<Keyword>&) const {}
+
+	IJsonParseHelper::ValueKinds IJsonParseHelper::OtherKeys() const
+	{
+		return ValueKinds::Any;
+	}
+
+	bool IJsonParseHelper::KeywordStartHandler(SharedData& data, std::uint32_t, const std::string& key, const Json::Value& object, bool inArray, size_t index)
+	{
+		return StartHandler(data, key, object, inArray, index);
+	}
 }
\ No newline at end of file
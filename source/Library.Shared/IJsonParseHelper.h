@@ -1,6 +1,9 @@
 #pragma once
+#include <cstdint>
+#include <string_view>
 #include "json/value.h"
 #include "JsonParseCoordinator.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
@@ -16,6 +19,44 @@ namespace FieaGameEngine
 
 		friend JsonParseCoordinator;
 	public:
+
+		/// <summary>
+		/// ValueKinds - Flags for the kinds of Json values a helper's StartHandler takes under a key. Arrays aren't a kind of their own:
+		/// their elements are dispatched one by one, and ArrayStartHandler and ArrayEndHandler are called on every helper.
+		/// </summary>
+		enum class ValueKinds : std::uint8_t
+		{
+			None = 0,
+			Scalar = 1,
+			Object = 2,
+			Any = Scalar | Object
+		};
+
+		/// <summary>
+		/// Keyword - A key a helper declares it handles, the kinds of values it takes under it, and the token KeywordStartHandler is told the key by.
+		/// </summary>
+		struct Keyword final
+		{
+			/// <summary>
+			/// The key, as it appears in the Json.
+			/// </summary>
+			std::string_view key;
+
+			/// <summary>
+			/// Kinds of values handled under the key. Values of other kinds under it aren't passed to this helper at all.
+			/// </summary>
+			ValueKinds kinds;
+
+			/// <summary>
+			/// Token of the key, chosen by the helper.
+			/// </summary>
+			std::uint32_t token;
+		};
+
+		/// <summary>
+		/// HasKind - Tells you if kinds includes kind.
+		/// </summary>
+		static bool HasKind(ValueKinds kinds, ValueKinds kind);
 		
 		/// <summary>
 		/// Defaulted Constructor.
@@ -83,6 +124,48 @@ namespace FieaGameEngine
 		/// <returns>True if the handler was able to handle the information passed into start handler, false otherwise.</returns>
 		virtual bool EndHandler(SharedData& data, const std::string& key) = 0;
 
+		/// <summary>
+		/// DeclareKeywords - Lists the keys this helper handles, so the coordinator can dispatch them through its keyword table instead of offering
+		/// every key to every helper. Declares nothing in the interface.
+		/// </summary>
+		/// <param name="keywords">Output parameter the helper's keywords are pushed back into.</param>
+		virtual void DeclareKeywords(Vector<Keyword>& keywords) const;
+
+		/// <summary>
+		/// OtherKeys - Kinds of values this helper takes under keys it didn't declare. Any in the interface: a helper that declares nothing is offered
+		/// every key, like a link of the old chain of responsibility. Return None for a helper that only handles its keywords.
+		/// </summary>
+		/// <returns>The kinds of values the helper's StartHandler takes under undeclared keys.</returns>
+		virtual ValueKinds OtherKeys() const;
+
+		/// <summary>
+		/// KeywordStartHandler - Start handler for the keys the helper declared. The coordinator passes the keyword's token, so the helper can switch
+		/// on it rather than compare the key. Calls StartHandler in the interface.
+		/// </summary>
+		/// <param name="data">Output Parameter where the parsed data handled by the helper is stored.</param>
+		/// <param name="token">Token the helper declared the key with.</param>
+		/// <param name="key">Key for the json value/object being passed in.</param>
+		/// <param name="object">The json value/object to be parsed.</param>
+		/// <param name="inArray">Boolean indicating if the json object is an array element.</param>
+		/// <returns>True if the data can - and was - handled, false if the helper cannot handle grammar for this data type.</returns>
+		virtual bool KeywordStartHandler(SharedData& data, std::uint32_t token, const std::string& key, const Json::Value& object, bool inArray, size_t index);
+
+		/// <summary>
+		/// Array Start Handler - Called on every helper before the elements of a json array are parsed, so a helper can prepare for all of them at once.
+		/// Does nothing in the interface.
+		/// </summary>
+		/// <param name="data">The output parameter data where the parsed information is stored.</param>
+		/// <param name="key">Key the array is stored under.</param>
+		/// <param name="array">The json array about to be parsed.</param>
+		virtual void ArrayStartHandler(SharedData& data, const std::string& key, const Json::Value& array);
+
+		/// <summary>
+		/// Array End Handler - Called on every helper after the elements of a json array were parsed. Does nothing in the interface.
+		/// </summary>
+		/// <param name="data">The output parameter data where the parsed information is stored.</param>
+		/// <param name="key">Key the array is stored under.</param>
+		virtual void ArrayEndHandler(SharedData& data, const std::string& key);
+
 		/// <summary>
 		/// Create - Emulation of a virtual constructor utilized within the Clone method of the parse master. This needs to be pointed correctly at implementing
 		/// data types.
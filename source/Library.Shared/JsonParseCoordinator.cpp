@@ -1,13 +1,76 @@
 #include "pch.h"
 #include "JsonParseCoordinator.h"
 #include "json/json.h"
+#include "MappedFile.h"
+#include "ChangeJournal.h"
 #include <istream>
 #include <fstream>
 #include <cassert>
+#include <atomic>
+#include <charconv>
 #include <limits>
+#include <mutex>
+#include <thread>
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Stand-ins for the object and array values of a streamed parse, whose contents haven't been read when their handlers run.
+		/// </summary>
+		const Json::Value EmptyObject(Json::objectValue);
+		const Json::Value EmptyArray(Json::arrayValue);
+
+		/// <summary>
+		/// Converts a scalar token to the Json::Value JsonCpp would have read for it.
+		/// </summary>
+		Json::Value ToJsonValue(const JsonTokenizer& tokenizer)
+		{
+			const std::string_view text = tokenizer.Text();
+			switch (tokenizer.Type())
+			{
+			case JsonTokenizer::TokenType::String:
+				return Json::Value(text.data(), text.data() + text.size());
+
+			case JsonTokenizer::TokenType::Integer:
+			{
+				//	Like JsonCpp, integers that don't fit a 64 bit integer are read as reals
+				if (text[0] == '-')
+				{
+					Json::Int64 value;
+					if (std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc())
+					{
+						return Json::Value(value);
+					}
+				}
+				else
+				{
+					Json::UInt64 value;
+					if (std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc())
+					{
+						return (value <= static_cast<Json::UInt64>(std::numeric_limits<Json::Int64>::max()) ? Json::Value(static_cast<Json::Int64>(value)) : Json::Value(value));
+					}
+				}
+				[[fallthrough]];
+			}
+
+			case JsonTokenizer::TokenType::Real:
+			{
+				double value = 0.0;
+				std::from_chars(text.data(), text.data() + text.size(), value);
+				return Json::Value(value);
+			}
+
+			case JsonTokenizer::TokenType::Boolean:
+				return Json::Value(text == "true");
+
+			default:
+				return Json::Value();
+			}
+		}
+	}
+
 #pragma region SharedData Methods
 
 	RTTI_DEFINITIONS(SharedData)
@@ -49,6 +112,17 @@ namespace FieaGameEngine
 	{
 	}
 
+	gsl::owner<SharedData*> SharedData::CreateBatchData()
+	{
+		return Create();
+	}
+
+	void SharedData::MergeBatchData(SharedData& batchData)
+	{
+		UNREFERENCED_LOCAL(batchData);
+		throw std::runtime_error("This shared data does not support merging, so it can't be used with ParseBatch.");
+	}
+
 #pragma endregion
 
 #pragma region ParseCoordinator Methods
@@ -68,12 +142,15 @@ namespace FieaGameEngine
 	}
 
 	JsonParseCoordinator::JsonParseCoordinator(JsonParseCoordinator&& other) noexcept :
-		_sharedData(other._sharedData), _fileName(std::move(other._fileName)), _isClone(other._isClone), _parseHelperList(std::move(other._parseHelperList))
+		_sharedData(other._sharedData), _fileName(std::move(other._fileName)), _isClone(other._isClone), _parseHelperList(std::move(other._parseHelperList)),
+		_progress(other._progress)
 	{	
 		_sharedData->SetJsonParseCoordinator(this);
 
 		other._sharedData = nullptr;
+		other._progress = nullptr;
 		other._isClone = false;
+		other._isDispatchBuilt = false;
 	}
 
 	JsonParseCoordinator& JsonParseCoordinator::operator=(JsonParseCoordinator&& other) noexcept
@@ -92,9 +169,13 @@ namespace FieaGameEngine
 			_parseHelperList = std::move(other._parseHelperList);
 			_fileName = std::move(other._fileName);
 			_isClone = other._isClone;
+			_isDispatchBuilt = false;
+			_progress = other._progress;
 
 			other._isClone = false;
+			other._progress = nullptr;
 			other._sharedData = nullptr;
+			other._isDispatchBuilt = false;
 		}
 
 		return *this;
@@ -102,6 +183,10 @@ namespace FieaGameEngine
 
 	void JsonParseCoordinator::Initialize()
 	{
+		//	A streamed parse that threw leaves its tokenizer behind
+		_tokenizer = nullptr;
+		_isObjectSkipped = false;
+
 		for (auto helper : _parseHelperList)
 		{
 			helper->Initialize();
@@ -162,6 +247,7 @@ namespace FieaGameEngine
 		}
 
 		_parseHelperList.PushBack(const_cast<IJsonParseHelper*>(&helper));
+		_isDispatchBuilt = false;
 	}
 
 	void JsonParseCoordinator::RemoveHelper(const IJsonParseHelper& helper)
@@ -172,6 +258,7 @@ namespace FieaGameEngine
 		}
 
 		_parseHelperList.Remove(const_cast<IJsonParseHelper*>(&helper));
+		_isDispatchBuilt = false;
 	}
 
 	size_t JsonParseCoordinator::GetHelperCount() const
@@ -205,12 +292,12 @@ namespace FieaGameEngine
 		{
 			_sharedData->IncrementDepth();
 
-			for (auto* helper : _parseHelperList)
+			for (const auto& handler : FindDispatch(key)._objects)
 			{
-				if (helper->StartHandler(*(_sharedData), key, value, isArrayElement, index))
+				if (StartHandler(handler, key, value, isArrayElement, index))
 				{
 					ParseMembers(value);
-					helper->EndHandler(*(_sharedData), key);
+					handler._helper->EndHandler(*(_sharedData), key);
 					break;
 				}
 			}
@@ -219,6 +306,11 @@ namespace FieaGameEngine
 		}
 		else if (value.isArray())
 		{
+			for (auto* helper : _parseHelperList)
+			{
+				helper->ArrayStartHandler(*(_sharedData), key, value);
+			}
+
 			size_t i = 0;
 			for (const auto& element : value)
 			{
@@ -234,14 +326,19 @@ namespace FieaGameEngine
 				}
 				++i;
 			}
+
+			for (auto* helper : _parseHelperList)
+			{
+				helper->ArrayEndHandler(*(_sharedData), key);
+			}
 		}
 		else
 		{
-			for (auto* helper : _parseHelperList)
+			for (const auto& handler : FindDispatch(key)._scalars)
 			{
-				if (helper->StartHandler(*(_sharedData), key, value, isArrayElement, index))
+				if (StartHandler(handler, key, value, isArrayElement, index))
 				{
-					helper->EndHandler(*(_sharedData), key);
+					handler._helper->EndHandler(*(_sharedData), key);
 				}
 			}
 		}
@@ -249,12 +346,105 @@ namespace FieaGameEngine
 
 	void JsonParseCoordinator::ParseMembers(const Json::Value& root, bool isArrayElement, size_t index)
 	{
-		if (root.size() > 0)
+		//	Walks the members in place rather than copying out their names and looking each one up again. One key buffer is reused for the
+		//	whole object, helpers only hold on to its address until the member's EndHandler.
+		std::string key;
+		for (auto member = root.begin(); member != root.end(); ++member)
 		{
-			const auto keys = root.getMemberNames();
-			for (const auto& key : keys)
+			const char* end;
+			const char* begin = member.memberName(&end);
+			key.assign(begin, end);
+			Parse(key, *member, isArrayElement, index);
+		}
+	}
+
+	void JsonParseCoordinator::StreamMembers(JsonTokenizer& tokenizer, bool isArrayElement, size_t index)
+	{
+		std::string key;
+		while (tokenizer.Next() == JsonTokenizer::TokenType::Key)
+		{
+			if (_progress != nullptr)
 			{
-				Parse(key, root[key], isArrayElement, index);
+				_progress->_bytesParsed.store(tokenizer.Offset(), std::memory_order_relaxed);
+				if (_progress->_isCancelled.load(std::memory_order_relaxed))
+				{
+					throw std::runtime_error("The parse was cancelled.");
+				}
+			}
+
+			key = tokenizer.Text();
+			tokenizer.Next();
+			StreamValue(tokenizer, key, isArrayElement, index);
+		}
+	}
+
+	void JsonParseCoordinator::StreamValue(JsonTokenizer& tokenizer, const std::string& key, bool isArrayElement, size_t index)
+	{
+		const JsonTokenizer::TokenType type = tokenizer.Type();
+		if (type == JsonTokenizer::TokenType::BeginObject)
+		{
+			_sharedData->IncrementDepth();
+
+			bool isHandled = false;
+			for (const auto& handler : FindDispatch(key)._objects)
+			{
+				if (StartHandler(handler, key, EmptyObject, isArrayElement, index))
+				{
+					if (_isObjectSkipped == false)
+					{
+						StreamMembers(tokenizer);
+					}
+					_isObjectSkipped = false;
+					handler._helper->EndHandler(*(_sharedData), key);
+					isHandled = true;
+					break;
+				}
+			}
+
+			if (isHandled == false)
+			{
+				tokenizer.Skip();
+			}
+
+			_sharedData->DecrementDepth();
+		}
+		else if (type == JsonTokenizer::TokenType::BeginArray)
+		{
+			for (auto* helper : _parseHelperList)
+			{
+				helper->ArrayStartHandler(*(_sharedData), key, EmptyArray);
+			}
+
+			size_t i = 0;
+			for (JsonTokenizer::TokenType element = tokenizer.Next(); element != JsonTokenizer::TokenType::EndArray; element = tokenizer.Next())
+			{
+				if (element == JsonTokenizer::TokenType::BeginObject)
+				{
+					_sharedData->IncrementDepth();
+					StreamMembers(tokenizer, true, i);
+					_sharedData->DecrementDepth();
+				}
+				else
+				{
+					StreamValue(tokenizer, key, true, i);
+				}
+				++i;
+			}
+
+			for (auto* helper : _parseHelperList)
+			{
+				helper->ArrayEndHandler(*(_sharedData), key);
+			}
+		}
+		else
+		{
+			const Json::Value value = ToJsonValue(tokenizer);
+			for (const auto& handler : FindDispatch(key)._scalars)
+			{
+				if (StartHandler(handler, key, value, isArrayElement, index))
+				{
+					handler._helper->EndHandler(*(_sharedData), key);
+				}
 			}
 		}
 	}
@@ -273,6 +463,7 @@ namespace FieaGameEngine
 			return;
 		}
 
+		BuildDispatch();
 		Initialize();
 
 		Json::Value root;
@@ -298,5 +489,293 @@ namespace FieaGameEngine
 		}
 	}
 
+	void JsonParseCoordinator::ParseStreaming(std::string_view json)
+	{
+		if (_sharedData == nullptr || _parseHelperList.Size() == 0_z)
+		{
+			return;
+		}
+
+		BuildDispatch();
+		Initialize();
+
+		if (_progress != nullptr)
+		{
+			_progress->_bytesTotal.store(json.size(), std::memory_order_relaxed);
+		}
+
+		JsonTokenizer tokenizer(json);
+		if (tokenizer.Next() != JsonTokenizer::TokenType::BeginObject)
+		{
+			throw std::runtime_error("The root of a streamed Json document must be an object.");
+		}
+		_tokenizer = &tokenizer;
+
+		_sharedData->IncrementDepth();
+		StreamMembers(tokenizer);
+		_sharedData->DecrementDepth();
+
+		//	Rejects anything after the root object
+		tokenizer.Next();
+
+		if (_progress != nullptr)
+		{
+			_progress->_bytesParsed.store(json.size(), std::memory_order_relaxed);
+		}
+
+		_tokenizer = nullptr;
+		CleanUp();
+	}
+
+	void JsonParseCoordinator::ParseFromFileStreaming(std::string& fileName)
+	{
+		const MappedFile file(fileName);
+		if (file.IsOpen())
+		{
+			ParseStreaming(file.View());
+			_fileName = std::move(fileName);
+		}
+	}
+
+	void JsonParseCoordinator::SetProgress(ParseProgress* progress)
+	{
+		_progress = progress;
+	}
+
+	std::string_view JsonParseCoordinator::SkipObject()
+	{
+		if (_tokenizer == nullptr || _isObjectSkipped || _tokenizer->Type() != JsonTokenizer::TokenType::BeginObject)
+		{
+			return std::string_view();
+		}
+
+		const size_t begin = _tokenizer->Offset();
+		_tokenizer->Skip();
+		_isObjectSkipped = true;
+		return _tokenizer->Document().substr(begin, _tokenizer->Offset() + 1 - begin);
+	}
+
+	void JsonParseCoordinator::ParseBatch(const Vector<std::string>& fileNames, size_t threadCount)
+	{
+		if (_sharedData == nullptr || _parseHelperList.Size() == 0_z || fileNames.IsEmpty())
+		{
+			return;
+		}
+
+		if (threadCount == 0)
+		{
+			threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		}
+		threadCount = std::min(threadCount, fileNames.Size());
+
+		//	One slot per file, so the merge order doesn't depend on which worker finished first
+		Vector<gsl::owner<SharedData*>> results;
+		results.Resize(fileNames.Size());
+
+		//	The calling thread parses with this coordinator, every other worker with a clone of it
+		Vector<gsl::owner<JsonParseCoordinator*>> clones(threadCount - 1);
+		Vector<std::thread> workers(threadCount - 1);
+
+		std::atomic<size_t> nextFile{ 0 };
+		std::atomic<bool> failed{ false };
+		std::exception_ptr error;
+		std::mutex errorMutex;
+
+		auto worker = [&](JsonParseCoordinator& parser)
+		{
+			//	Batch data is detached until it is merged, and the journal can only be written from one thread
+			ChangeJournal::Suppression suppression;
+
+			try
+			{
+				for (size_t i = nextFile++; i < fileNames.Size() && failed == false; i = nextFile++)
+				{
+					results[i] = parser._sharedData->CreateBatchData();
+					parser.ParseFileInto(fileNames[i], *results[i]);
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (error == nullptr)
+				{
+					error = std::current_exception();
+				}
+				failed = true;
+			}
+		};
+
+		try
+		{
+			for (size_t i = 1; i < threadCount; ++i)
+			{
+				clones.PushBack(Clone());
+				workers.PushBack(std::thread(worker, std::ref(*clones.Back())));
+			}
+		}
+		catch (...)
+		{
+			//	Out of threads or memory for another clone - whoever did start, plus this thread, still parse every file.
+		}
+
+		worker(*this);
+
+		for (size_t i = 0; i < workers.Size(); ++i)
+		{
+			workers[i].join();
+		}
+
+		for (auto* clone : clones)
+		{
+			delete clone;
+		}
+
+		try
+		{
+			if (error != nullptr)
+			{
+				std::rethrow_exception(error);
+			}
+
+			for (auto* result : results)
+			{
+				if (result != nullptr)
+				{
+					_sharedData->MergeBatchData(*result);
+				}
+			}
+		}
+		catch (...)
+		{
+			for (auto* result : results)
+			{
+				delete result;
+			}
+			throw;
+		}
+
+		for (auto* result : results)
+		{
+			delete result;
+		}
+
+		_fileName = fileNames.Back();
+	}
+
+	void JsonParseCoordinator::ParseFileInto(const std::string& fileName, SharedData& data)
+	{
+		SharedData* sharedData = _sharedData;
+		_sharedData = &data;
+		data.SetJsonParseCoordinator(this);
+
+		try
+		{
+			std::string name = fileName;
+			ParseFromFile(name);
+		}
+		catch (...)
+		{
+			_sharedData = sharedData;
+			throw;
+		}
+
+		_sharedData = sharedData;
+	}
+
+	void JsonParseCoordinator::BuildDispatch()
+	{
+		if (_isDispatchBuilt)
+		{
+			return;
+		}
+
+		Vector<Vector<IJsonParseHelper::Keyword>> declarations(_parseHelperList.Size());
+		Vector<KeywordTable::Entry> entries;
+		for (auto* helper : _parseHelperList)
+		{
+			declarations.PushBack(Vector<IJsonParseHelper::Keyword>());
+			helper->DeclareKeywords(declarations.Back());
+			for (const auto& keyword : declarations.Back())
+			{
+				bool isNewKey = true;
+				for (const auto& entry : entries)
+				{
+					if (entry.first == keyword.key)
+					{
+						isNewKey = false;
+						break;
+					}
+				}
+
+				if (isNewKey)
+				{
+					entries.PushBack(KeywordTable::Entry{ std::string(keyword.key), entries.Size() });
+				}
+			}
+		}
+
+		//	A helper is offered a keyword under the kinds it declared it with, and under its OtherKeys if it didn't declare it
+		_keywordDispatch.Clear();
+		_keywordDispatch.Resize(entries.Size());
+		_otherKeys = KeyDispatch();
+		for (size_t i = 0; i < _parseHelperList.Size(); ++i)
+		{
+			IJsonParseHelper* helper = _parseHelperList[i];
+			const IJsonParseHelper::ValueKinds otherKinds = helper->OtherKeys();
+			for (const auto& entry : entries)
+			{
+				IJsonParseHelper::ValueKinds kinds = otherKinds;
+				std::uint32_t token = NoToken;
+				for (const auto& keyword : declarations[i])
+				{
+					if (entry.first == keyword.key)
+					{
+						kinds = keyword.kinds;
+						token = keyword.token;
+						break;
+					}
+				}
+
+				KeyDispatch& dispatch = _keywordDispatch[entry.second];
+				if (IJsonParseHelper::HasKind(kinds, IJsonParseHelper::ValueKinds::Object))
+				{
+					dispatch._objects.PushBack(KeyHandler{ helper, token });
+				}
+				if (IJsonParseHelper::HasKind(kinds, IJsonParseHelper::ValueKinds::Scalar))
+				{
+					dispatch._scalars.PushBack(KeyHandler{ helper, token });
+				}
+			}
+
+			if (IJsonParseHelper::HasKind(otherKinds, IJsonParseHelper::ValueKinds::Object))
+			{
+				_otherKeys._objects.PushBack(KeyHandler{ helper, NoToken });
+			}
+			if (IJsonParseHelper::HasKind(otherKinds, IJsonParseHelper::ValueKinds::Scalar))
+			{
+				_otherKeys._scalars.PushBack(KeyHandler{ helper, NoToken });
+			}
+		}
+
+		_keywords = KeywordTable(entries);
+		_isDispatchBuilt = true;
+	}
+
+	const JsonParseCoordinator::KeyDispatch& JsonParseCoordinator::FindDispatch(const std::string& key) const
+	{
+		const size_t* index = _keywords.Find(key);
+		return (index != nullptr ? _keywordDispatch[*index] : _otherKeys);
+	}
+
+	bool JsonParseCoordinator::StartHandler(const KeyHandler& handler, const std::string& key, const Json::Value& value, bool isArrayElement, size_t index)
+	{
+		if (handler._token == NoToken)
+		{
+			return handler._helper->StartHandler(*(_sharedData), key, value, isArrayElement, index);
+		}
+
+		return handler._helper->KeywordStartHandler(*(_sharedData), handler._token, key, value, isArrayElement, index);
+	}
+
 #pragma endregion
 }
@@ -1,8 +1,12 @@
 #pragma once
 #include "RTTI.h"
 #include "Vector.h"
+#include "FrozenMap.h"
 #include "IJsonParseHelper.h"
+#include "JsonTokenizer.h"
 #include "Stack.h"
+#include <atomic>
+#include <string_view>
 
 namespace FieaGameEngine
 {
@@ -87,6 +91,21 @@ namespace FieaGameEngine
 		/// <returns>A pointer to the newly instantiated type of shared data created by implementing children.</returns>
 		virtual gsl::owner<SharedData*> Create() = 0;
 
+		/// <summary>
+		/// CreateBatchData - Creates the shared data one file of a ParseBatch is parsed into on a worker thread. Files are parsed at the same time,
+		/// so it must not write to this shared data's output. Defaults to Create().
+		/// </summary>
+		/// <returns>A pointer to the new shared data, deleted by the coordinator once merged.</returns>
+		virtual gsl::owner<SharedData*> CreateBatchData();
+
+		/// <summary>
+		/// MergeBatchData - Moves what was parsed into batchData, made by CreateBatchData, into this shared data's output. Called on the thread that
+		/// called ParseBatch, once per file and in the order the files were listed. Shared data that can't merge can't be batched: the default throws.
+		/// </summary>
+		/// <param name="batchData">Shared data one file of the batch was parsed into.</param>
+		/// <exception cref="std::runtime_error">Throws unless overridden.</exception>
+		virtual void MergeBatchData(SharedData& batchData);
+
 	private:
 
 		/// <summary>
@@ -118,11 +137,75 @@ namespace FieaGameEngine
 
 	/// <summary>
 	/// JsonParseCoordinator - The parse master - Contains a list of helpers which provide a way to parse the grammar of Json files into c++.
+	/// Keys are dispatched through a keyword table built from the helpers' DeclareKeywords and OtherKeys: a key is only offered to the helpers that
+	/// declared it, plus the helpers that take undeclared keys, in the order the helpers were added.
 	/// </summary>
 	class JsonParseCoordinator
 	{
+		/// <summary>
+		/// KeyHandler - A helper a key is dispatched to, and the token it declared the key with.
+		/// </summary>
+		struct KeyHandler final
+		{
+			/// <summary>
+			/// _helper - The helper.
+			/// </summary>
+			IJsonParseHelper* _helper;
+
+			/// <summary>
+			/// _token - Token the helper declared the key with, NoToken if the helper takes it as an undeclared key.
+			/// </summary>
+			std::uint32_t _token;
+		};
+
+		/// <summary>
+		/// KeyDispatch - The helpers a key is dispatched to, per kind of value, in the order the helpers were added.
+		/// </summary>
+		struct KeyDispatch final
+		{
+			/// <summary>
+			/// _objects - Helpers offered object values, until one accepts.
+			/// </summary>
+			Vector<KeyHandler> _objects;
+
+			/// <summary>
+			/// _scalars - Helpers offered scalar values, every one of them.
+			/// </summary>
+			Vector<KeyHandler> _scalars;
+		};
+
+		/// <summary>
+		/// KeywordTable - Index into _keywordDispatch of every declared keyword.
+		/// </summary>
+		using KeywordTable = FrozenMap<std::string, size_t>;
+
+		/// <summary>
+		/// Token of a KeyHandler for an undeclared key.
+		/// </summary>
+		static constexpr std::uint32_t NoToken = std::numeric_limits<std::uint32_t>::max();
 
 	public:
+		/// <summary>
+		/// ParseProgress - Lets another thread follow a ParseStreaming and stop it. See SetProgress().
+		/// </summary>
+		struct ParseProgress final
+		{
+			/// <summary>
+			/// _bytesParsed - Offset in the document of the member being read, the document's size once the parse is done.
+			/// </summary>
+			std::atomic<size_t> _bytesParsed{ 0 };
+
+			/// <summary>
+			/// _bytesTotal - Size of the document, set when the parse starts.
+			/// </summary>
+			std::atomic<size_t> _bytesTotal{ 0 };
+
+			/// <summary>
+			/// _isCancelled - Set to stop the parse at the next member it reads.
+			/// </summary>
+			std::atomic<bool> _isCancelled{ false };
+		};
+
 		/// <summary>
 		/// Default Constructor - Deleted to prevent instantiation without assigning a shared data.
 		/// </summary>
@@ -225,6 +308,50 @@ namespace FieaGameEngine
 		/// <param name="fileName">Json File to be parsed.</param>
 		void ParseFromFile(std::string& fileName);
 
+		/// <summary>
+		/// ParseStreaming - Parses Json text without building a Json::Value tree: helpers get their start and end events straight from a JsonTokenizer
+		/// as it reads the text, so only the value being handled is ever materialized. Helpers see the same events as with Parse, with two differences:
+		/// members come in document order rather than sorted by name, and the object and array values passed to StartHandler and ArrayStartHandler are
+		/// empty, since their contents haven't been read yet. The root must be an object.
+		/// </summary>
+		/// <param name="json">The Json text to be parsed. Not copied.</param>
+		/// <exception cref="std::runtime_error">Throws if the text is malformed or its root isn't an object.</exception>
+		void ParseStreaming(std::string_view json);
+
+		/// <summary>
+		/// ParseFromFileStreaming - Memory maps the file and passes its contents into ParseStreaming, so the file is never read into the heap.
+		/// Does nothing if the file can't be opened.
+		/// </summary>
+		/// <param name="fileName">Json File to be parsed.</param>
+		void ParseFromFileStreaming(std::string& fileName);
+
+		/// <summary>
+		/// SetProgress - Has ParseStreaming report how far it got into progress before each member it reads, and throw if progress was cancelled.
+		/// Members are small, so this is a check every few dozen bytes. Parse doesn't report progress: its document is read before any member is.
+		/// </summary>
+		/// <param name="progress">Progress to report into, nullptr to stop reporting. Must outlive the parses it is set for.</param>
+		void SetProgress(ParseProgress* progress);
+
+		/// <summary>
+		/// SkipObject - Called by a helper from the StartHandler of an object value during ParseStreaming, to take the object's text instead of
+		/// having its members parsed. The helper's EndHandler is still called. Nothing is skipped outside of such a StartHandler, or by Parse.
+		/// </summary>
+		/// <returns>The object's text, braces included, a view into the streamed document. Empty if nothing was skipped.</returns>
+		std::string_view SkipObject();
+
+		/// <summary>
+		/// ParseBatch - Parses several files at once, one clone of the coordinator per worker thread. Every file is parsed into shared data of its own,
+		/// made by the shared data's CreateBatchData, and the results are merged into the shared data with MergeBatchData on the calling thread, in the
+		/// order the files are listed - so the output doesn't depend on which file finishes first. Files that can't be opened are skipped, as with
+		/// ParseFromFile. Everything the helpers touch besides their shared data - factories, prefabs, the type manager - is only read. The workers parse
+		/// with the ChangeJournal suppressed, so the journal only sees what the merge adds to the shared data, recorded on the calling thread.
+		/// If a file fails to parse, the workers stop taking files, nothing is merged and the first exception is rethrown once all of them have joined.
+		/// </summary>
+		/// <param name="fileNames">Json Files to be parsed.</param>
+		/// <param name="threadCount">Number of threads to use, including the calling thread. 0 uses std::thread::hardware_concurrency().</param>
+		/// <exception cref="std::runtime_error">Throws if the shared data doesn't support merging.</exception>
+		void ParseBatch(const Vector<std::string>& fileNames, size_t threadCount = 0);
+
 		/// <summary>
 		/// GetFileName - returns the filename of the last file parsed by the ParseCoordinator
 		/// </summary>
@@ -259,11 +386,70 @@ namespace FieaGameEngine
 		/// <param name="value">The Json Value containing the information to be parsed.</param>
 		void Parse(const std::string& key, const Json::Value& value, bool isArrayElement, size_t index);
 
+		/// <summary>
+		/// StreamMembers - Reads the members of the object the tokenizer just began and passes each one into StreamValue, up to the object's end.
+		/// </summary>
+		/// <param name="tokenizer">Tokenizer whose current token is the object's BeginObject.</param>
+		void StreamMembers(JsonTokenizer& tokenizer, bool isArrayElement = false, size_t index = 0);
+
+		/// <summary>
+		/// StreamValue - The streaming counterpart of Parse(key, value): raises the helper events for the value that starts with the current token,
+		/// reading the rest of it from the tokenizer. Objects no helper accepts are skipped.
+		/// </summary>
+		/// <param name="tokenizer">Tokenizer whose current token starts the value.</param>
+		/// <param name="key">Name of the member the value belongs to.</param>
+		void StreamValue(JsonTokenizer& tokenizer, const std::string& key, bool isArrayElement, size_t index);
+
+		/// <summary>
+		/// ParseFileInto - Parses a file into data in place of this coordinator's own shared data, which is restored afterwards.
+		/// </summary>
+		/// <param name="fileName">Json File to be parsed.</param>
+		/// <param name="data">Shared data to parse into.</param>
+		void ParseFileInto(const std::string& fileName, SharedData& data);
+
+		/// <summary>
+		/// BuildDispatch - Rebuilds the keyword table from the helpers' declarations, if helpers were added or removed since it was last built.
+		/// </summary>
+		void BuildDispatch();
+
+		/// <summary>
+		/// FindDispatch - Returns the helpers a key is dispatched to: its keyword's, or the ones for undeclared keys.
+		/// </summary>
+		/// <param name="key">The key.</param>
+		/// <returns>Reference to the key's dispatch.</returns>
+		const KeyDispatch& FindDispatch(const std::string& key) const;
+
+		/// <summary>
+		/// StartHandler - Calls the start handler of a dispatched helper: KeywordStartHandler with the token for a declared key, StartHandler otherwise.
+		/// </summary>
+		/// <returns>True if the helper handled the value.</returns>
+		bool StartHandler(const KeyHandler& handler, const std::string& key, const Json::Value& value, bool isArrayElement, size_t index);
+
 		/// <summary>
 		/// _parseHelperList - Vector containing the addresses of all helpers associated with this parse coordinator.
 		/// </summary>
 		Vector<IJsonParseHelper*> _parseHelperList;
 
+		/// <summary>
+		/// _keywords - Keyword table, from every keyword the helpers declared to its dispatch.
+		/// </summary>
+		KeywordTable _keywords{ Vector<KeywordTable::Entry>() };
+
+		/// <summary>
+		/// _keywordDispatch - Dispatch of each declared keyword.
+		/// </summary>
+		Vector<KeyDispatch> _keywordDispatch;
+
+		/// <summary>
+		/// _otherKeys - Dispatch of the keys no helper declared.
+		/// </summary>
+		KeyDispatch _otherKeys;
+
+		/// <summary>
+		/// _isDispatchBuilt - False when helpers were added or removed since the keyword table was built.
+		/// </summary>
+		bool _isDispatchBuilt = false;
+
 		/// <summary>
 		/// _sharedData - address to the shared data associated with this parse coordinator.
 		/// </summary>
@@ -279,6 +465,21 @@ namespace FieaGameEngine
 		/// _fileName - member that stores the name/path of the last file to be parsed by this coordinator.
 		/// </summary>
 		std::string _fileName;
+
+		/// <summary>
+		/// _progress - Progress ParseStreaming reports into, see SetProgress(). Not carried over to clones.
+		/// </summary>
+		ParseProgress* _progress = nullptr;
+
+		/// <summary>
+		/// _tokenizer - Tokenizer of the ParseStreaming running, for SkipObject(). nullptr otherwise.
+		/// </summary>
+		JsonTokenizer* _tokenizer = nullptr;
+
+		/// <summary>
+		/// _isObjectSkipped - Set by SkipObject(), so StreamValue doesn't stream the members of the object that was skipped.
+		/// </summary>
+		bool _isObjectSkipped = false;
 	};
 
 }
\ No newline at end of file
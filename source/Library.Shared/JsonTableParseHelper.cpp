@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "JsonTableParseHelper.h"
-#include "IFactory.h"
+#include "Attributed.h"
+#include "PrefabRegistry.h"
+#include "Base64.h"
+#include "MappedFile.h"
+#include <cstring>
 namespace FieaGameEngine
 {
     RTTI_DEFINITIONS(SharedTableData)
@@ -17,8 +21,41 @@ namespace FieaGameEngine
         _scopePointer = &s;
     }
 
+    SharedTableData::~SharedTableData()
+    {
+        if (_ownsScope)
+        {
+            delete _scopePointer;
+        }
+    }
+
+    gsl::owner<SharedData*> SharedTableData::CreateBatchData()
+    {
+        SharedTableData* data = new SharedTableData();
+        data->_scopePointer = new Scope();
+        data->_ownsScope = true;
+        return data;
+    }
+
+    void SharedTableData::MergeBatchData(SharedData& batchData)
+    {
+        if (_scopePointer == nullptr)
+        {
+            throw std::runtime_error("SharedTableData has no root scope to merge into.");
+        }
+
+        SharedTableData* tableData = batchData.As<SharedTableData>();
+        assert(tableData != nullptr && tableData->_scopePointer != nullptr);
+        _scopePointer->Merge(*tableData->_scopePointer);
+    }
+
     void SharedTableData::SetRootScope(Scope& s)
     {
+        if (_ownsScope)
+        {
+            delete _scopePointer;
+            _ownsScope = false;
+        }
         _scopePointer = &s;
     }
 
@@ -27,11 +64,42 @@ namespace FieaGameEngine
         return _scopePointer;
     }
 
+    void SharedTableData::SetLazySource(std::shared_ptr<const void> owner, std::string_view document)
+    {
+        _lazyOwner = std::move(owner);
+        _lazyDocument = (_lazyOwner != nullptr ? document : std::string_view());
+    }
+
+    JsonLazyContent::JsonLazyContent(std::shared_ptr<const void> owner, std::string_view text) :
+        _owner(std::move(owner)), _text(text)
+    {
+    }
+
+    void JsonLazyContent::Materialize(Scope& scope) const
+    {
+        SharedTableData data(scope);
+        data.SetLazySource(_owner, _text);
+        JsonParseCoordinator parser(data);
+        JsonTableParseHelper helper;
+        parser.AddHelper(helper);
+        parser.ParseStreaming(_text);
+    }
+
+    std::size_t JsonLazyContent::ByteSize() const
+    {
+        return _text.size();
+    }
+
     gsl::owner<JsonTableParseHelper*> JsonTableParseHelper::Create()
     {
         return new JsonTableParseHelper();
     }
 
+    void JsonTableParseHelper::SetDirectWrites(bool isEnabled)
+    {
+        _isDirectWriteEnabled = isEnabled;
+    }
+
     void JsonTableParseHelper::SetDatumValue(Datum& datum, const Json::Value& value, size_t index)
     {
         if (datum.OwnsData())
@@ -44,17 +112,59 @@ namespace FieaGameEngine
         }
     }
 
+    JsonTableParseHelper::~JsonTableParseHelper()
+    {
+        ReleaseBatch();
+    }
+
     void JsonTableParseHelper::Initialize()
     {
         IJsonParseHelper::Initialize();
+        ReleaseBatch();
+
+        //  A parse that threw can leave frames behind
+        _contextStack.Clear();
+        _valueArrayDepth = 0;
+        _componentCount = 0;
+        _binaryKey = nullptr;
     }
 
     void JsonTableParseHelper::CleanUp()
     {
         IJsonParseHelper::CleanUp();
+        ReleaseBatch();
     }
 
     bool JsonTableParseHelper::StartHandler(SharedData& data, const std::string& key, const Json::Value& object, bool isArray, size_t index)
+    {
+        const KeywordToken* token = _keywordTokens.Find(key);
+        UNREFERENCED_LOCAL(isArray);
+
+        return Start(data, (token != nullptr ? *token : KeywordToken::Attribute), key, object, index);
+    }
+
+    bool JsonTableParseHelper::KeywordStartHandler(SharedData& data, std::uint32_t token, const std::string& key, const Json::Value& object, bool isArray, size_t index)
+    {
+        assert(token < static_cast<std::uint32_t>(KeywordToken::Attribute));
+        UNREFERENCED_LOCAL(isArray);
+
+        return Start(data, static_cast<KeywordToken>(token), key, object, index);
+    }
+
+    void JsonTableParseHelper::DeclareKeywords(Vector<Keyword>& keywords) const
+    {
+        for (const auto& [keyword, token] : _keywordTokens)
+        {
+            keywords.PushBack(Keyword{ keyword, ValueKinds::Any, static_cast<std::uint32_t>(token) });
+        }
+    }
+
+    IJsonParseHelper::ValueKinds JsonTableParseHelper::OtherKeys() const
+    {
+        return ValueKinds::Object;
+    }
+
+    bool JsonTableParseHelper::Start(SharedData& data, KeywordToken token, const std::string& key, const Json::Value& object, size_t index)
     {
         if (!data.Is(SharedTableData::TypeIdClass()))
         {
@@ -63,48 +173,119 @@ namespace FieaGameEngine
 
         SharedTableData& tableData = reinterpret_cast<SharedTableData&>(data);
      
-        if (key == "value"s)
+        //  The binary value keywords are only scalars, an object under one of them is an attribute
+        if (token >= KeywordToken::Base64 && object.isObject())
+        {
+            token = KeywordToken::Attribute;
+        }
+
+        if (token == KeywordToken::Value)
         {
             assert(_contextStack.IsEmpty() == false);
             StackFrame& currentContext = _contextStack.Peek();
+            currentContext._valueIndex = index;
             if (currentContext._datum.Type() == Datum::DatumType::Table)
             {
-                assert(currentContext._className.empty() == false);
-                Scope* factoryScope = IFactory<Scope>::Create(currentContext._className);
-                if (factoryScope == nullptr)
+                Scope* factoryScope = nullptr;
+                if (currentContext._prefabName.empty() == false)
                 {
-                    throw std::runtime_error("Attempted to create an instance of a factory that is not registered in the factory table.");
+                    //  Keys nested in the value override the prefab's attributes
+                    factoryScope = PrefabRegistry::Instantiate(currentContext._prefabName);
+                }
+                else
+                {
+                    factoryScope = TakeBatchedScope(currentContext._factory);
+                    if (factoryScope == nullptr)
+                    {
+                        factoryScope = currentContext._factory.Create();
+                    }
+
+                    if (factoryScope == nullptr)
+                    {
+                        throw std::runtime_error("Attempted to create an instance of a factory that is not registered in the factory table.");
+                    }
                 }
 
                 assert(currentContext._attributeName != nullptr);
                 currentContext._context->Adopt(*factoryScope, *currentContext._attributeName);
-                _contextStack.Push(StackFrame{ &key, factoryScope, currentContext._className, currentContext._datum });
+
+                //  Attributed tables are read member by member as they are parsed, only plain ones can wait
+                if (tableData._lazyOwner != nullptr && currentContext._prefabName.empty() && factoryScope->TypeIdInstance() == Scope::TypeIdClass())
+                {
+                    DeferTable(tableData, *factoryScope);
+                }
+
+                //  Prefab instances share their values copy on write, and journaled writes must go through their Datums
+                Attributed* attributed = nullptr;
+                if (_isDirectWriteEnabled && currentContext._prefabName.empty() && ChangeJournal::IsEnabled() == false)
+                {
+                    attributed = factoryScope->As<Attributed>();
+                }
+
+                _contextStack.Push(StackFrame{ &key, factoryScope, currentContext._factory, currentContext._datum });
+                if (attributed != nullptr)
+                {
+                    StackFrame& objectContext = _contextStack.Peek();
+                    objectContext._signatures = &attributed->PrescribedAttributes();
+                    objectContext._object = reinterpret_cast<std::byte*>(attributed);
+                }
             }
-            else
+            else if (object.isObject())
+            {
+                //  A binary value object, its members are read by ReadBinaryField
+                BinaryValueSize(currentContext._datum);
+                _binaryKey = &key;
+                _binaryFile.clear();
+                _binaryOffset = 0;
+                _binaryCount = AllValues;
+            }
+            else if (object.isNumeric() && (currentContext._datum.Type() == Datum::DatumType::Vector || currentContext._datum.Type() == Datum::DatumType::Matrix))
+            {
+                AppendComponent(currentContext._datum, object.asFloat());
+            }
+            else if (currentContext._member == nullptr || WritePrescribed(currentContext, object, index) == false)
             {
                 SetDatumValue(currentContext._datum, object, index);
             }
         }
-        else if (key == "type"s)
+        else if (token == KeywordToken::Type)
         {
             assert(_contextStack.IsEmpty() == false);
             const StackFrame& currentContext = _contextStack.Peek();
             currentContext._datum.SetType(Datum::_setTypeJsonTableParseMap.At(object.asString()));
         }
-        else if (key == "class"s)
+        else if (token == KeywordToken::Class)
         {
             assert(_contextStack.IsEmpty() == false);
             StackFrame& currentContext = _contextStack.Peek();
-            currentContext._className = object.asString();
+            currentContext._factory = FactoryHandle<Scope>(object.asString());
         }
-        else
+        else if (token == KeywordToken::Prefab)
+        {
+            assert(_contextStack.IsEmpty() == false);
+            StackFrame& currentContext = _contextStack.Peek();
+            if (currentContext._valueIndex == index)
+            {
+                throw std::runtime_error("\"prefab\" " + object.asString() + " of " + *currentContext._attributeName + " must come before its \"value\".");
+            }
+            currentContext._prefabName = object.asString();
+        }
+        else if (token != KeywordToken::Attribute)
+        {
+            return ReadBinaryField(token, object);
+        }
+        else if (_contextStack.IsEmpty() || _contextStack.Peek()._signatures == nullptr || StartPrescribed(key) == false)
         {
             Scope* context = _contextStack.IsEmpty() ? tableData.GetRootScope() : _contextStack.Peek()._context;
             Datum& datum = context->Append(key);
-            _contextStack.Push(StackFrame{ &key, context, "Scope"s, datum });
-        }
 
-        UNREFERENCED_LOCAL(isArray);
+            //  A value given for an attribute of a prefab instance replaces the prefab's, rather than appending to it
+            if (datum.IsShared())
+            {
+                datum.Clear();
+            }
+            _contextStack.Push(StackFrame{ &key, context, FactoryHandle<Scope>::Of<Scope>(), datum });
+        }
 
         return true;
     }
@@ -116,6 +297,17 @@ namespace FieaGameEngine
             return false;
         }
 
+        if (_binaryKey == &key)
+        {
+            _binaryKey = nullptr;
+            if (_binaryFile.empty() == false)
+            {
+                assert(_contextStack.IsEmpty() == false);
+                ReadBinaryFile(_contextStack.Peek()._datum);
+            }
+            return true;
+        }
+
         if (_contextStack.IsEmpty() == false)
         {
             const StackFrame& currentContext = _contextStack.Peek();
@@ -127,4 +319,402 @@ namespace FieaGameEngine
         return true;
     }
 
+    void JsonTableParseHelper::ArrayStartHandler(SharedData& data, const std::string& key, const Json::Value& array)
+    {
+        if (!data.Is(SharedTableData::TypeIdClass()) || key != "value" || _contextStack.IsEmpty())
+        {
+            return;
+        }
+
+        const StackFrame& currentContext = _contextStack.Peek();
+        if (currentContext._datum.Type() != Datum::DatumType::Table)
+        {
+            BeginValueArray(currentContext._datum, array);
+            return;
+        }
+
+        //  One batch at a time - arrays nested in a batched array's elements create their Scopes one by one
+        if (_batch.IsEmpty() == false || array.size() < 2 || currentContext._prefabName.empty() == false)
+        {
+            return;
+        }
+
+        //  Every element must create a Scope of the same class. "class" and "type" carry over to the elements after the one that sets them.
+        const char* frameClassName = currentContext._factory.IsValid() ? currentContext._factory.ClassName().c_str() : nullptr;
+        const char* className = frameClassName;
+        const char* batchClassName = nullptr;
+        bool isTable = currentContext._datum.Type() == Datum::DatumType::Table;
+        for (const auto& element : array)
+        {
+            if (element.isObject() == false || element.isMember("value") == false || element.isMember("prefab"))
+            {
+                return;
+            }
+
+            const Json::Value& elementType = element["type"];
+            if (elementType.isString())
+            {
+                isTable = std::strcmp(elementType.asCString(), "table") == 0;
+            }
+
+            const Json::Value& elementClass = element["class"];
+            if (elementClass.isString())
+            {
+                className = elementClass.asCString();
+            }
+
+            if (isTable == false || className == nullptr || (batchClassName != nullptr && std::strcmp(batchClassName, className) != 0))
+            {
+                return;
+            }
+            batchClassName = className;
+        }
+
+        //  The frame's factory is already resolved, a class named by the elements is looked up once for the whole array
+        _batchFactory = (batchClassName == frameClassName ? currentContext._factory : FactoryHandle<Scope>(batchClassName));
+        _batch = _batchFactory.CreateN(array.size());
+        _batchNext = 0;
+        _batchDepth = _contextStack.Size();
+    }
+
+    void JsonTableParseHelper::ArrayEndHandler(SharedData& data, const std::string& key)
+    {
+        if (!data.Is(SharedTableData::TypeIdClass()) || key != "value")
+        {
+            return;
+        }
+
+        if (_valueArrayDepth > 0 && _contextStack.IsEmpty() == false && _contextStack.Peek()._datum.Type() != Datum::DatumType::Table)
+        {
+            if (--_valueArrayDepth == 0 && _componentCount != 0)
+            {
+                throw std::runtime_error("A native vector array needs four numbers per vector, a native matrix array sixteen per matrix.");
+            }
+        }
+        else if (_batchDepth == _contextStack.Size())
+        {
+            ReleaseBatch();
+        }
+    }
+
+    void JsonTableParseHelper::BeginValueArray(Datum& datum, const Json::Value& array)
+    {
+        if (_valueArrayDepth++ > 0)
+        {
+            return;
+        }
+
+        _componentCount = 0;
+        _valueIndex = 0;
+        if (datum.OwnsData() == false || datum.Type() == Datum::DatumType::Unknown || array.empty())
+        {
+            return;
+        }
+
+        //  Native vector and matrix arrays may nest, the count follows the first elements down to the numbers
+        size_t count = array.size();
+        const bool isComponents = datum.Type() == Datum::DatumType::Vector || datum.Type() == Datum::DatumType::Matrix;
+        if (isComponents)
+        {
+            size_t numbers = 1;
+            const Json::Value* element = &array;
+            for (; element->isArray() && element->empty() == false; element = &(*element)[0])
+            {
+                numbers *= element->size();
+            }
+
+            if (element->isNumeric())
+            {
+                count = numbers / (datum.Type() == Datum::DatumType::Vector ? 4 : 16);
+            }
+        }
+
+        datum.Reserve(datum.Size() + count);
+    }
+
+    void JsonTableParseHelper::AppendComponent(Datum& datum, float component)
+    {
+        if (_valueArrayDepth == 0)
+        {
+            throw std::runtime_error("Numbers given for a vector or matrix value must be in an array.");
+        }
+
+        _components[_componentCount++] = component;
+        if (datum.Type() == Datum::DatumType::Vector)
+        {
+            if (_componentCount == 4)
+            {
+                const vec4 vector(_components[0], _components[1], _components[2], _components[3]);
+                if (datum.OwnsData())
+                {
+                    datum.PushBack(vector);
+                }
+                else
+                {
+                    datum.Set(vector, _valueIndex);
+                }
+                ++_valueIndex;
+                _componentCount = 0;
+            }
+        }
+        else if (_componentCount == 16)
+        {
+            //  Rows first, as in "mat4x4((row 0), (row 1), (row 2), (row 3))"
+            mat4x4 matrix;
+            for (size_t i = 0; i < 16; ++i)
+            {
+                matrix[i % 4][i / 4] = _components[i];
+            }
+            if (datum.OwnsData())
+            {
+                datum.PushBack(matrix);
+            }
+            else
+            {
+                datum.Set(matrix, _valueIndex);
+            }
+            ++_valueIndex;
+            _componentCount = 0;
+        }
+    }
+
+    bool JsonTableParseHelper::ReadBinaryField(KeywordToken token, const Json::Value& object)
+    {
+        if (_binaryKey == nullptr)
+        {
+            return false;
+        }
+
+        assert(_contextStack.IsEmpty() == false);
+        if (token == KeywordToken::Base64)
+        {
+            const char* begin;
+            const char* end;
+            if (object.getString(&begin, &end) == false)
+            {
+                throw std::runtime_error("\"base64\" must be a string.");
+            }
+
+            const std::string_view text(begin, static_cast<size_t>(end - begin));
+            Datum& datum = _contextStack.Peek()._datum;
+            const size_t size = Base64::DecodedSize(text);
+            const size_t valueSize = BinaryValueSize(datum);
+            if (size % valueSize != 0)
+            {
+                throw std::runtime_error("\"base64\" doesn't decode to a whole number of values.");
+            }
+
+            //  Decoded aside first, so bad text throws before the Datum grows
+            std::string decoded(size, '\0');
+            Base64::Decode(text, decoded.data());
+            if (size > 0)
+            {
+                std::memcpy(PrepareBinaryValues(datum, size / valueSize), decoded.data(), size);
+            }
+        }
+        else if (token == KeywordToken::File)
+        {
+            _binaryFile = object.asString();
+        }
+        else if (token == KeywordToken::Offset)
+        {
+            _binaryOffset = static_cast<size_t>(object.asLargestUInt());
+        }
+        else
+        {
+            assert(token == KeywordToken::Count);
+            _binaryCount = static_cast<size_t>(object.asLargestUInt());
+        }
+
+        return true;
+    }
+
+    void JsonTableParseHelper::ReadBinaryFile(Datum& datum)
+    {
+        const MappedFile file(_binaryFile);
+        if (file.IsOpen() == false)
+        {
+            throw std::runtime_error("Unable to open the binary value file " + _binaryFile + ".");
+        }
+
+        const size_t valueSize = BinaryValueSize(datum);
+        if (_binaryOffset > file.Size())
+        {
+            throw std::runtime_error("The binary value offset is past the end of " + _binaryFile + ".");
+        }
+
+        const size_t available = file.Size() - _binaryOffset;
+        if (_binaryCount == AllValues)
+        {
+            if (available % valueSize != 0)
+            {
+                throw std::runtime_error(_binaryFile + " doesn't hold a whole number of values.");
+            }
+            _binaryCount = available / valueSize;
+        }
+        else if (_binaryCount > available / valueSize)
+        {
+            throw std::runtime_error(_binaryFile + " is too short for the values it is read for.");
+        }
+
+        if (_binaryCount > 0)
+        {
+            std::memcpy(PrepareBinaryValues(datum, _binaryCount), file.Data() + _binaryOffset, _binaryCount * valueSize);
+        }
+    }
+
+    std::byte* JsonTableParseHelper::PrepareBinaryValues(Datum& datum, size_t count)
+    {
+        size_t first = 0;
+        if (datum.OwnsData())
+        {
+            first = datum.Size();
+            datum.Resize(first + count);
+        }
+        else if (count > datum.Size())
+        {
+            throw std::runtime_error("The binary value holds more values than the Datum's external storage.");
+        }
+
+        if (count == 0)
+        {
+            return nullptr;
+        }
+
+        switch (datum.Type())
+        {
+        case Datum::DatumType::Float:
+            return reinterpret_cast<std::byte*>(&datum.Get<float>(first));
+        case Datum::DatumType::Integer:
+            return reinterpret_cast<std::byte*>(&datum.Get<int>(first));
+        case Datum::DatumType::Vector:
+            return reinterpret_cast<std::byte*>(&datum.Get<vec4>(first));
+        case Datum::DatumType::Matrix:
+            return reinterpret_cast<std::byte*>(&datum.Get<mat4x4>(first));
+        default:
+            throw std::runtime_error("Only float, integer, vector and matrix values can be binary.");
+        }
+    }
+
+    size_t JsonTableParseHelper::BinaryValueSize(const Datum& datum)
+    {
+        switch (datum.Type())
+        {
+        case Datum::DatumType::Float:
+            return sizeof(float);
+        case Datum::DatumType::Integer:
+            return sizeof(int);
+        case Datum::DatumType::Vector:
+            return sizeof(vec4);
+        case Datum::DatumType::Matrix:
+            return sizeof(mat4x4);
+        default:
+            throw std::runtime_error("Only float, integer, vector and matrix values can be binary.");
+        }
+    }
+
+    Scope* JsonTableParseHelper::TakeBatchedScope(const FactoryHandle<Scope>& factory)
+    {
+        if (_batchNext < _batch.Size() && _batchDepth == _contextStack.Size() && factory == _batchFactory)
+        {
+            return _batch[_batchNext++];
+        }
+
+        return nullptr;
+    }
+
+    bool JsonTableParseHelper::StartPrescribed(const std::string& key)
+    {
+        StackFrame& objectContext = _contextStack.Peek();
+        const Vector<Signature>& signatures = *objectContext._signatures;
+
+        //  Attributes the file leaves out are skipped over, one named before the previous member falls back to Append
+        size_t index = objectContext._nextSignature;
+        while (index < signatures.Size() && signatures[index].name != key)
+        {
+            ++index;
+        }
+
+        if (index == signatures.Size())
+        {
+            return false;
+        }
+
+        //  The prescribed attributes follow "this" in signature order, see TypeManager::GetLayoutForType()
+        const Signature& signature = signatures[index];
+        Scope* context = objectContext._context;
+        std::byte* member = (signature.type != Datum::DatumType::Table ? objectContext._object + signature.offset : nullptr);
+        objectContext._nextSignature = index + 1;
+
+        Datum& datum = (*context)[index + 1];
+        assert(context->GetPair(index + 1).first == key);
+
+        _contextStack.Push(StackFrame{ &key, context, FactoryHandle<Scope>::Of<Scope>(), datum });
+        StackFrame& attribute = _contextStack.Peek();
+        attribute._member = member;
+        attribute._signature = &signature;
+        return true;
+    }
+
+    bool JsonTableParseHelper::WritePrescribed(const StackFrame& frame, const Json::Value& value, size_t index)
+    {
+        const Signature& signature = *frame._signature;
+        if (signature.type != Datum::DatumType::Integer && signature.type != Datum::DatumType::Float && signature.type != Datum::DatumType::String)
+        {
+            return false;
+        }
+
+        if (index >= signature.size)
+        {
+            throw std::runtime_error("Attempting to set at an index beyond capacity.");
+        }
+
+        switch (signature.type)
+        {
+        case Datum::DatumType::Integer:
+            reinterpret_cast<int*>(frame._member)[index] = value.asInt();
+            break;
+        case Datum::DatumType::Float:
+            reinterpret_cast<float*>(frame._member)[index] = value.asFloat();
+            break;
+        default:
+            reinterpret_cast<std::string*>(frame._member)[index] = value.asString();
+            break;
+        }
+
+        return true;
+    }
+
+    void JsonTableParseHelper::DeferTable(SharedTableData& data, Scope& scope)
+    {
+        JsonParseCoordinator* coordinator = data.GetJsonParseCoordinator();
+        const std::string_view text = (coordinator != nullptr ? coordinator->SkipObject() : std::string_view());
+        if (text.empty())
+        {
+            return;
+        }
+
+        const std::string_view& document = data._lazyDocument;
+        if (text.data() >= document.data() && text.data() + text.size() <= document.data() + document.size())
+        {
+            scope.SetLazyContent(std::make_shared<JsonLazyContent>(data._lazyOwner, text));
+        }
+        else
+        {
+            auto copy = std::make_shared<const std::string>(text);
+            scope.SetLazyContent(std::make_shared<JsonLazyContent>(copy, *copy));
+        }
+    }
+
+    void JsonTableParseHelper::ReleaseBatch()
+    {
+        for (size_t i = _batchNext; i < _batch.Size(); ++i)
+        {
+            delete _batch[i];
+        }
+
+        _batch.Clear();
+        _batchNext = 0;
+        _batchDepth = 0;
+    }
 }
\ No newline at end of file
@@ -2,6 +2,14 @@
 #include "IJsonParseHelper.h"
 #include "JsonParseCoordinator.h"
 #include "Scope.h"
+#include "FactoryHandle.h"
+#include "FrozenMap.h"
+#include "TypeManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
 #include <tuple>
 
 namespace FieaGameEngine
@@ -62,9 +70,18 @@ namespace FieaGameEngine
         Scope* GetRootScope();
 
         /// <summary>
-        /// Virtual Destructor - Required for the V-Table
+        /// SetLazySource - Has ParseStreaming of document leave the nested tables of class Scope as placeholders (see Scope::SetLazyContent()),
+        /// which parse their text the first time they are accessed. Tables of other classes, and prefab instances, are parsed straight away.
         /// </summary>
-        virtual ~SharedTableData() = default;
+        /// <param name="owner">Keeps document alive for as long as a placeholder refers to it, such as the std::string or MappedFile holding it.
+        /// nullptr parses every table straight away.</param>
+        /// <param name="document">The text that will be streamed. Deferred text outside of it, streamed from elsewhere, is copied.</param>
+        void SetLazySource(std::shared_ptr<const void> owner, std::string_view document);
+
+        /// <summary>
+        /// Virtual Destructor - Deletes the root scope if it was made by CreateBatchData.
+        /// </summary>
+        virtual ~SharedTableData();
 
         /// <summary>
         /// Create - Emulates a Virtual Constructor.
@@ -72,6 +89,21 @@ namespace FieaGameEngine
         /// <returns>Reference to a newly created SharedTableData</returns>
         virtual gsl::owner<SharedTableData*> Create() override;
 
+    protected:
+
+        /// <summary>
+        /// CreateBatchData - Creates a SharedTableData with a root scope of its own, which it deletes with itself.
+        /// </summary>
+        /// <returns>Address of the new SharedTableData.</returns>
+        virtual gsl::owner<SharedData*> CreateBatchData() override;
+
+        /// <summary>
+        /// MergeBatchData - Moves the entries of batchData's root scope into this root scope with Scope::Merge.
+        /// </summary>
+        /// <param name="batchData">A SharedTableData made by CreateBatchData.</param>
+        /// <exception cref="std::runtime_error">Throws if there is no root scope to merge into.</exception>
+        virtual void MergeBatchData(SharedData& batchData) override;
+
     private:
 
         /// <summary>
@@ -84,15 +116,63 @@ namespace FieaGameEngine
         /// _scopePointer - Pointer to the Scope that you wish to be the root of the parsed data.
         /// </summary>
         Scope* _scopePointer = nullptr;
+
+        /// <summary>
+        /// _ownsScope - Whether _scopePointer was made by CreateBatchData and is deleted with this.
+        /// </summary>
+        bool _ownsScope = false;
+
+        /// <summary>
+        /// _lazyOwner - Keeps _lazyDocument alive, nullptr unless tables are deferred. See SetLazySource().
+        /// </summary>
+        std::shared_ptr<const void> _lazyOwner;
+
+        /// <summary>
+        /// _lazyDocument - Text whose nested tables are deferred.
+        /// </summary>
+        std::string_view _lazyDocument;
     };
 
     /// <summary>
     /// JsonTableParseHelper - ParseHelper containing the grammar necessary to parse a Json file into Scopes and Datums for use in the engine.
+    /// A table naming a registered "prefab" is an instance of it and needs no "class". The "prefab" key must come before the table's "value",
+    /// as the table is made when its value starts: Parse reads keys in sorted order, where it always does, and ParseStreaming in file order.
+    /// Numeric values can also be given as binary, { "base64": "..." } or { "file": "...", "offset": 0, "count": 0 }. A relative "file" is
+    /// resolved against the working directory rather than the directory of the scene naming it.
     /// </summary>
     class JsonTableParseHelper : public IJsonParseHelper
     {
         RTTI_DECLARATIONS(JsonTableParseHelper, IJsonParseHelper)
 
+        /// <summary>
+        /// KeywordToken - Tokens of the grammar's keywords. Every other key names an attribute.
+        /// </summary>
+        enum class KeywordToken : std::uint32_t
+        {
+            Value,
+            Type,
+            Class,
+            Prefab,
+            Base64,
+            File,
+            Offset,
+            Count,
+            Attribute
+        };
+
+        /// <summary>
+        /// _keywordTokens - The keywords and their tokens, for keys that reach StartHandler rather than KeywordStartHandler.
+        /// </summary>
+        static constexpr FrozenMap<std::string_view, KeywordToken, 8> _keywordTokens = MakeFrozenMap<std::string_view, KeywordToken>({
+            { "value", KeywordToken::Value },
+            { "type", KeywordToken::Type },
+            { "class", KeywordToken::Class },
+            { "prefab", KeywordToken::Prefab },
+            { "base64", KeywordToken::Base64 },
+            { "file", KeywordToken::File },
+            { "offset", KeywordToken::Offset },
+            { "count", KeywordToken::Count } });
+
         /// <summary>
         /// StackFrame - Represents a struct that is used to establish the correct hierarchy of data.
         /// </summary>
@@ -109,25 +189,65 @@ namespace FieaGameEngine
             Scope* _context;
 
             /// <summary>
-            /// _className - Name of the class to be instantiated at this context.
+            /// _factory - Factory of the class to be instantiated at this context, resolved when the "class" key is parsed. Empty if that class has no factory.
             /// </summary>
-            std::string _className;
+            FactoryHandle<Scope> _factory;
 
             /// <summary>
             /// _datum - Reference to the datum paired with the _attributeName at this context frame.
             /// </summary>
             Datum& _datum;
+
+            /// <summary>
+            /// _prefabName - Name of the registered prefab to instantiate at this context instead of creating from _factory. Empty for none.
+            /// </summary>
+            std::string _prefabName;
+
+            /// <summary>
+            /// _valueIndex - Index of the element whose "value" was last started at this context, NoValue if none was. A "prefab" after it is too late.
+            /// </summary>
+            size_t _valueIndex = NoValue;
+
+            /// <summary>
+            /// _signatures - Prescribed attributes of the Attributed object created at this context, nullptr unless its members are written directly.
+            /// </summary>
+            const Vector<Signature>* _signatures = nullptr;
+
+            /// <summary>
+            /// _object - Address of that Attributed object, which signature offsets are relative to.
+            /// </summary>
+            std::byte* _object = nullptr;
+
+            /// <summary>
+            /// _nextSignature - Index of the signature the next member is expected to name. Files list attributes in signature order.
+            /// </summary>
+            size_t _nextSignature = 0;
+
+            /// <summary>
+            /// _member - Address of the native member of the prescribed attribute at this context, nullptr for the generic path.
+            /// </summary>
+            std::byte* _member = nullptr;
+
+            /// <summary>
+            /// _signature - Signature of that prescribed attribute.
+            /// </summary>
+            const Signature* _signature = nullptr;
         };
 
     public:
 
         /// <summary>
-        /// Initialize - Doesn't do anything in this instance.
+        /// Destructor - Deletes any Scopes created for an array whose parse didn't finish.
+        /// </summary>
+        virtual ~JsonTableParseHelper() override;
+
+        /// <summary>
+        /// Initialize - Deletes any Scopes created for an array whose parse didn't finish.
         /// </summary>
         virtual void Initialize() override;
 
         /// <summary>
-        /// Cleanup - Doesn't do anything in this instance.
+        /// Cleanup - Deletes any Scopes created for an array whose parse didn't finish.
         /// </summary>
         virtual void CleanUp() override;
 
@@ -153,14 +273,86 @@ namespace FieaGameEngine
         /// <returns>True if the data was handled, false otherwise.</returns>
         virtual bool EndHandler(SharedData& data, const std::string& key) override;
 
+        /// <summary>
+        /// DeclareKeywords - Declares "value", "type", "class" and "prefab", and "base64", "file", "offset" and "count", which are the fields of binary values when their value is a scalar.
+        /// </summary>
+        /// <param name="keywords">Output parameter the keywords are pushed back into.</param>
+        virtual void DeclareKeywords(Vector<Keyword>& keywords) const override;
+
+        /// <summary>
+        /// OtherKeys - Any other key names an attribute, whose value is an object. Scalars only appear under "value" and the other keywords.
+        /// </summary>
+        /// <returns>ValueKinds::Object</returns>
+        virtual ValueKinds OtherKeys() const override;
+
+        /// <summary>
+        /// KeywordStartHandler - StartHandler for the declared keywords, switching on their token instead of comparing the key.
+        /// </summary>
+        /// <param name="data">SharedData Reference, should be a SharedTableData for a valid parse.</param>
+        /// <param name="token">A KeywordToken.</param>
+        /// <param name="key">The keyword.</param>
+        /// <param name="object">Json::Value containing the data associated with the keyword.</param>
+        /// <param name="isArray">Boolean indicating if the object is an array element. Not used in this helper.</param>
+        /// <param name="index">Index used for array parsing.</param>
+        /// <returns>True if the data was handled, elsewise false.</returns>
+        virtual bool KeywordStartHandler(SharedData& data, std::uint32_t token, const std::string& key, const Json::Value& object, bool isArray, size_t index) override;
+
+        /// <summary>
+        /// ArrayStartHandler - If the array is the value of a table whose elements all create the same class, creates all of the array's Scopes
+        /// with one CreateN call on its factory. The elements' value handlers then adopt them in order instead of creating their own.
+        /// The value array of any other Datum reserves room for all of its values up front.
+        /// </summary>
+        /// <param name="data">Reference to shared data. Must be SharedTableData to do anything.</param>
+        /// <param name="key">Key the array is stored under. Only "value" arrays are batched.</param>
+        /// <param name="array">The json array about to be parsed.</param>
+        virtual void ArrayStartHandler(SharedData& data, const std::string& key, const Json::Value& array) override;
+
+        /// <summary>
+        /// ArrayEndHandler - Deletes any of the array's Scopes that no element adopted.
+        /// </summary>
+        /// <exception cref="std::runtime_error">Throws if a native vector or matrix array ends part way through a value.</exception>
+        /// <param name="data">Reference to shared data.</param>
+        /// <param name="key">Key the array is stored under.</param>
+        virtual void ArrayEndHandler(SharedData& data, const std::string& key) override;
+
         /// <summary>
         /// Create - Emulates a virtual constructor. Used within the ParseMaster Clone method to make a clone of the helper.
         /// </summary>
         /// <returns>A pointer to a newly instantiated copy of this helper.</returns>
         virtual gsl::owner<JsonTableParseHelper*> Create() override;
 
+        /// <summary>
+        /// SetDirectWrites - Turns the direct writes of prescribed attributes on or off, see StartPrescribed(). On by default.
+        /// </summary>
+        /// <param name="isEnabled">False to have every attribute go through Scope::Append and the Datum.</param>
+        void SetDirectWrites(bool isEnabled);
+
     private:
 
+        /// <summary>
+        /// Start - The start handler proper, for a key whose token is known.
+        /// </summary>
+        bool Start(SharedData& data, KeywordToken token, const std::string& key, const Json::Value& object, size_t index);
+
+        /// <summary>
+        /// StartPrescribed - Starts a member of an Attributed object whose members are written directly. The key is matched against the signatures
+        /// from the one the previous member named onwards, so its Datum is reached by index rather than looked up with Append, and integer, float
+        /// and string values are then written straight into the native member at the signature's offset, see WritePrescribed().
+        /// </summary>
+        /// <param name="key">The member's key.</param>
+        /// <returns>True if the key names a prescribed attribute, false to take the generic path: auxiliary attributes and keys out of order.</returns>
+        bool StartPrescribed(const std::string& key);
+
+        /// <summary>
+        /// WritePrescribed - Writes a value into the native member of the prescribed attribute at the top frame.
+        /// </summary>
+        /// <param name="frame">Frame of a prescribed attribute started by StartPrescribed().</param>
+        /// <param name="value">The value.</param>
+        /// <param name="index">Index of the value within the attribute.</param>
+        /// <returns>True if the value was written, false for the types written through the Datum.</returns>
+        /// <exception cref="std::runtime_error">Throws if the index is beyond the attribute's size.</exception>
+        static bool WritePrescribed(const StackFrame& frame, const Json::Value& value, size_t index);
+
         /// <summary>
         /// SetDatumValue - checks if the datum owns the data it contains and calls either Pushback (if it does) or Set (if it doesnt)
         /// </summary>
@@ -169,10 +361,196 @@ namespace FieaGameEngine
         /// <param name="index">Index to set the data at (if data isn't owned by the datum).</param>
         void SetDatumValue(Datum& datum, const Json::Value& value, size_t index);
 
+        /// <summary>
+        /// BeginValueArray - Reserves room in datum for the values of the array about to be parsed, and starts collecting the components of native
+        /// vector and matrix arrays. Only the outermost of nested arrays does anything.
+        /// </summary>
+        /// <param name="datum">Datum the array's values go into.</param>
+        /// <param name="array">The json array, empty when streaming.</param>
+        void BeginValueArray(Datum& datum, const Json::Value& array);
+
+        /// <summary>
+        /// AppendComponent - Collects one number of a vector or matrix given as a native Json array, in the order of its text form, and sets the
+        /// value once it is complete.
+        /// </summary>
+        /// <param name="datum">Vector or matrix Datum the value goes into.</param>
+        /// <param name="component">The number.</param>
+        /// <exception cref="std::runtime_error">Throws if the number isn't in an array.</exception>
+        void AppendComponent(Datum& datum, float component);
+
+        /// <summary>
+        /// ReadBinaryField - Handles a member of a binary value object, { "base64": "..." } or { "file": "...", "offset": 0, "count": 0 }.
+        /// Base64 text is decoded straight away, and only added to the Datum once all of it decoded. The file is read once the object ends.
+        /// </summary>
+        /// <param name="token">Base64, File, Offset or Count.</param>
+        /// <param name="object">The member's value.</param>
+        /// <returns>True if a binary value object is being parsed, false if the key is an ordinary one.</returns>
+        bool ReadBinaryField(KeywordToken token, const Json::Value& object);
+
+        /// <summary>
+        /// ReadBinaryFile - Copies the values named by the binary value object's "file", "offset" and "count" from a mapped file into the Datum.
+        /// A relative "file" is opened relative to the working directory, like the names given to ParseFromFile, not to the scene's directory.
+        /// </summary>
+        /// <param name="datum">Datum the values go into.</param>
+        /// <exception cref="std::runtime_error">Throws if the file can't be opened or doesn't hold the values.</exception>
+        void ReadBinaryFile(Datum& datum);
+
+        /// <summary>
+        /// PrepareBinaryValues - Returns where count raw values of datum's type can be written: after its values for a Datum that owns its
+        /// array, which grows to take them, or over the first count values of external storage.
+        /// </summary>
+        /// <param name="datum">A float, integer, vector or matrix Datum.</param>
+        /// <param name="count">Number of values.</param>
+        /// <returns>Address of the first byte to write.</returns>
+        /// <exception cref="std::runtime_error">Throws for other types, or if external storage is too small.</exception>
+        static std::byte* PrepareBinaryValues(Datum& datum, size_t count);
+
+        /// <summary>
+        /// BinaryValueSize - Size of one raw value of datum's type.
+        /// </summary>
+        /// <exception cref="std::runtime_error">Throws for types other than float, integer, vector and matrix.</exception>
+        static size_t BinaryValueSize(const Datum& datum);
+
+        /// <summary>
+        /// TakeBatchedScope - Returns the next Scope created by ArrayStartHandler if it was made for the current frame and factory.
+        /// </summary>
+        /// <param name="factory">Factory the caller is about to create from.</param>
+        /// <returns>Address of the Scope, now owned by the caller - nullptr if there is none.</returns>
+        Scope* TakeBatchedScope(const FactoryHandle<Scope>& factory);
+
+        /// <summary>
+        /// DeferTable - Skips the members of the table being parsed, leaving scope a placeholder for their text. See SharedTableData::SetLazySource().
+        /// </summary>
+        /// <param name="data">Shared data with a lazy source.</param>
+        /// <param name="scope">The table's plain, empty Scope.</param>
+        static void DeferTable(SharedTableData& data, Scope& scope);
+
+        /// <summary>
+        /// ReleaseBatch - Deletes the batched Scopes that weren't taken and forgets the batch.
+        /// </summary>
+        void ReleaseBatch();
+
+        /// <summary>
+        /// InitialStackDepth - Frames reserved up front. Every attribute and every nested table takes a frame, deeper files grow the stack once.
+        /// </summary>
+        static constexpr size_t InitialStackDepth = 32;
+
         /// <summary>
         /// _stack - Necessary to maintain proper hierarchy in terms of correctly associating nested scopes and their data members.
         /// </summary>
-        Stack<StackFrame> _contextStack;
+        Stack<StackFrame> _contextStack{ InitialStackDepth };
+
+        /// <summary>
+        /// _isDirectWriteEnabled - See SetDirectWrites().
+        /// </summary>
+        bool _isDirectWriteEnabled = true;
+
+        /// <summary>
+        /// _batch - Scopes created up front for the elements of a homogeneous table array. Entries before _batchNext are owned by their parents.
+        /// </summary>
+        Vector<Scope*> _batch;
+
+        /// <summary>
+        /// _batchNext - Index of the next Scope of _batch to hand out.
+        /// </summary>
+        size_t _batchNext = 0;
+
+        /// <summary>
+        /// _batchDepth - Size of the context stack when the batch was made. Elements' values are parsed at this depth.
+        /// </summary>
+        size_t _batchDepth = 0;
+
+        /// <summary>
+        /// _batchFactory - Factory the batched Scopes were created from.
+        /// </summary>
+        FactoryHandle<Scope> _batchFactory;
+
+        /// <summary>
+        /// _valueArrayDepth - Nesting of the value arrays of a Datum other than a table being parsed. Native vector and matrix arrays nest.
+        /// </summary>
+        size_t _valueArrayDepth = 0;
+
+        /// <summary>
+        /// _components - Numbers of the vector or matrix being collected from a native array.
+        /// </summary>
+        float _components[16] = {};
+
+        /// <summary>
+        /// _componentCount - Numbers collected into _components so far.
+        /// </summary>
+        size_t _componentCount = 0;
+
+        /// <summary>
+        /// _valueIndex - Index of the next vector or matrix of a native array, for Datums with external storage.
+        /// </summary>
+        size_t _valueIndex = 0;
+
+        /// <summary>
+        /// _binaryKey - Key of the binary value object being parsed, nullptr when there is none. Its EndHandler reads the file.
+        /// </summary>
+        const std::string* _binaryKey = nullptr;
+
+        /// <summary>
+        /// _binaryFile - "file" of the binary value object being parsed, empty for none.
+        /// </summary>
+        std::string _binaryFile;
+
+        /// <summary>
+        /// _binaryOffset - "offset" of the binary value object being parsed, in bytes.
+        /// </summary>
+        size_t _binaryOffset = 0;
+
+        /// <summary>
+        /// NoValue - StackFrame::_valueIndex of a context whose "value" hasn't started.
+        /// </summary>
+        static constexpr size_t NoValue = std::numeric_limits<size_t>::max();
+
+        /// <summary>
+        /// AllValues - _binaryCount of a binary value object without a "count".
+        /// </summary>
+        static constexpr size_t AllValues = std::numeric_limits<size_t>::max();
+
+        /// <summary>
+        /// _binaryCount - "count" of the binary value object being parsed, AllValues to read to the end of the file.
+        /// </summary>
+        size_t _binaryCount = AllValues;
+    };
+
+    /// <summary>
+    /// JsonLazyContent - Content of a placeholder Scope left by a lazy parse: the text of the table's "value" object, parsed into the placeholder
+    /// with JsonTableParseHelper when it is first accessed. Its own nested tables are deferred in turn.
+    /// </summary>
+    class JsonLazyContent final : public LazyContent
+    {
+    public:
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="owner">Keeps text alive.</param>
+        /// <param name="text">A Json object of attributes.</param>
+        JsonLazyContent(std::shared_ptr<const void> owner, std::string_view text);
+
+        /// <summary>
+        /// Materialize - Streams the text into scope.
+        /// </summary>
+        /// <param name="scope">The placeholder.</param>
+        virtual void Materialize(Scope& scope) const override;
+
+        /// <summary>
+        /// ByteSize - Returns the length of the text.
+        /// </summary>
+        virtual std::size_t ByteSize() const override;
+
+    private:
+        /// <summary>
+        /// _owner - Keeps _text alive.
+        /// </summary>
+        std::shared_ptr<const void> _owner;
+
+        /// <summary>
+        /// _text - The object's text.
+        /// </summary>
+        std::string_view _text;
     };
 
 }
\ No newline at end of file
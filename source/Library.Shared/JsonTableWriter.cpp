@@ -0,0 +1,271 @@
+#include "pch.h"
+#include "JsonTableWriter.h"
+#include "ScopeTraversal.h"
+#include "json/json.h"
+#include <cstdio>
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		const char* const DatumTypeNames[static_cast<int>(Datum::DatumType::Unknown)] =
+		{
+			"float",	//	DatumType::Float
+			"integer",	//	DatumType::Integer
+			"matrix",	//	DatumType::Matrix
+			nullptr,	//	DatumType::Pointer - not serialized
+			"string",	//	DatumType::String
+			"vector",	//	DatumType::Vector
+			"table"		//	DatumType::Table
+		};
+
+		bool IsWritable(const Datum& datum)
+		{
+			return datum.Type() != Datum::DatumType::Unknown && datum.Type() != Datum::DatumType::Pointer;
+		}
+
+		void WriteValue(const Datum& datum, size_t index, std::string& out)
+		{
+			char buffer[512];
+
+			switch (datum.Type())
+			{
+			case Datum::DatumType::Float:
+				out += Json::valueToString(static_cast<double>(datum.Get<float>(index)));
+				break;
+
+			case Datum::DatumType::Integer:
+				out += std::to_string(datum.Get<int>(index));
+				break;
+
+			case Datum::DatumType::String:
+				out += Json::valueToQuotedString(datum.Get<std::string>(index).c_str());
+				break;
+
+			//	Same layouts Datum::ParsePushBackVectorString/ParsePushBackMatrixString read back.
+			case Datum::DatumType::Vector:
+			{
+				const vec4& v = datum.Get<vec4>(index);
+				snprintf(buffer, sizeof(buffer), "\"vec4(%.9g, %.9g, %.9g, %.9g)\"", v.x, v.y, v.z, v.w);
+				out += buffer;
+				break;
+			}
+
+			case Datum::DatumType::Matrix:
+			{
+				const mat4x4& m = datum.Get<mat4x4>(index);
+				snprintf(buffer, sizeof(buffer), "\"mat4x4((%.9g, %.9g, %.9g, %.9g), (%.9g, %.9g, %.9g, %.9g), (%.9g, %.9g, %.9g, %.9g), (%.9g, %.9g, %.9g, %.9g))\"",
+					m[0][0], m[1][0], m[2][0], m[3][0],
+					m[0][1], m[1][1], m[2][1], m[3][1],
+					m[0][2], m[1][2], m[2][2], m[3][2],
+					m[0][3], m[1][3], m[2][3], m[3][3]);
+				out += buffer;
+				break;
+			}
+
+			default:
+				assert(false);
+				break;
+			}
+		}
+	}
+
+	std::string JsonTableWriter::Write(const Scope& scope)
+	{
+		std::string out;
+		WriteFull(scope, out);
+		return out;
+	}
+
+	void JsonTableWriter::WriteFull(const Scope& scope, std::string& out)
+	{
+		WriteScope(scope, out, [](const Scope& child, std::string& text) { WriteFull(child, text); });
+	}
+
+	const std::string& JsonTableWriter::Save(Scope& root)
+	{
+		_rewritten = 0;
+		_reused = 0;
+
+		//	Dirty bits are only trustworthy if tracking has been on, uninterrupted, since the cache was built.
+		bool force = (ChangeJournal::IsEnabled() == false || ChangeJournal::Epoch() != _epoch);
+		if (force)
+		{
+			_cache.Clear();
+			_epoch = ChangeJournal::Epoch();
+		}
+
+		_document = SaveScope(root, force);
+
+		//	Removed scopes are never visited again, so their text is swept out once it could make up half the cache.
+		if (force)
+		{
+			_liveCount = _cache.Size();
+		}
+		else if (_cache.Size() > 2 * _liveCount)
+		{
+			Prune(root);
+		}
+
+		return _document;
+	}
+
+	void JsonTableWriter::SaveToFile(Scope& root, const std::string& fileName)
+	{
+		std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw std::runtime_error("Unable to open file for writing. JsonTableWriter::SaveToFile()");
+		}
+
+		const std::string& text = Save(root);
+		file.write(text.data(), static_cast<std::streamsize>(text.size()));
+	}
+
+	void JsonTableWriter::Reset()
+	{
+		_cache.Clear();
+		_document.clear();
+		_document.shrink_to_fit();
+		_epoch = 0;
+		_liveCount = 0;
+	}
+
+	size_t JsonTableWriter::RewrittenCount() const
+	{
+		return _rewritten;
+	}
+
+	size_t JsonTableWriter::ReusedCount() const
+	{
+		return _reused;
+	}
+
+	size_t JsonTableWriter::CachedCount() const
+	{
+		return _cache.Size();
+	}
+
+	const std::string& JsonTableWriter::SaveScope(Scope& scope, bool force)
+	{
+		auto [it, wasInserted] = _cache.Insert(std::make_pair(scope.Serial(), std::string()));
+
+		if (!force && !wasInserted && !scope.IsDirty())
+		{
+			++_reused;
+			return it->second;
+		}
+
+		++_rewritten;
+
+		std::string text;
+		text.reserve(it->second.size());
+
+		//	Children are reached through the non-const root handed to Save(), so dropping const here is safe.
+		WriteScope(scope, text, [this, force](const Scope& child, std::string& out)
+		{
+			out += SaveScope(const_cast<Scope&>(child), force);
+		});
+
+		//	Every child was either reused clean or just written and cleared, so this only clears scope's own bits.
+		scope.ClearDirty();
+
+		it->second = std::move(text);
+		return it->second;
+	}
+
+	void JsonTableWriter::Prune(Scope& root)
+	{
+		HashMap<std::uint64_t, std::string> live(_cache.Size());
+
+		ScopeTraversal::ForEachScope(root, [this, &live](Scope& scope, size_t)
+		{
+			auto it = _cache.Find(scope.Serial());
+			if (it != _cache.end())
+			{
+				live.Insert(std::make_pair(it->first, std::move(it->second)));
+			}
+		});
+
+		_cache = std::move(live);
+		_liveCount = _cache.Size();
+	}
+
+	template <typename ChildWriter>
+	void JsonTableWriter::WriteScope(const Scope& scope, std::string& out, ChildWriter writeChild)
+	{
+		out += '{';
+		bool first = true;
+
+		for (size_t i = 0; i < scope.Size(); ++i)
+		{
+			const auto& [key, datum] = scope.GetPair(i);
+			if (!IsWritable(datum))
+			{
+				continue;
+			}
+
+			if (!first)
+			{
+				out += ',';
+			}
+			first = false;
+
+			out += Json::valueToQuotedString(key.c_str());
+			out += ':';
+
+			if (datum.Type() != Datum::DatumType::Table)
+			{
+				WriteDatum(datum, out);
+				continue;
+			}
+
+			//	{"type":"table","value":[{"type":"table","class":"X","value":{...}}, ...]} - each child carries its own class.
+			out += "{\"type\":\"table\",\"value\":[";
+			for (size_t j = 0; j < datum.Size(); ++j)
+			{
+				const Scope& child = *datum.Get<Scope*>(j);
+				if (j > 0)
+				{
+					out += ',';
+				}
+
+				out += "{\"type\":\"table\",\"class\":";
+				out += Json::valueToQuotedString(child.TypeNameInstance().c_str());
+				out += ",\"value\":";
+				writeChild(child, out);
+				out += '}';
+			}
+			out += "]}";
+		}
+
+		out += '}';
+	}
+
+	void JsonTableWriter::WriteDatum(const Datum& datum, std::string& out)
+	{
+		out += "{\"type\":\"";
+		out += DatumTypeNames[static_cast<int>(datum.Type())];
+		out += "\",\"value\":";
+
+		if (datum.Size() == 1)
+		{
+			WriteValue(datum, 0, out);
+		}
+		else
+		{
+			out += '[';
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				if (i > 0)
+				{
+					out += ',';
+				}
+				WriteValue(datum, i, out);
+			}
+			out += ']';
+		}
+
+		out += '}';
+	}
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "Scope.h"
+#include "HashMap.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// JsonTableWriter - Serializes Scope trees into the table grammar read by JsonTableParseHelper ("type", "class", "value").
+	/// Write() always serializes the whole tree. Save() is the incremental saver: it keeps the text of every Scope it has written and,
+	/// while the ChangeJournal is enabled, only re-serializes Scopes that are dirty. Clean subtrees are reused from the cache in O(1).
+	/// Pointer Datums (including Attributed's "this") and Datums of unknown type are not written.
+	/// Nested Scopes are written with TypeNameInstance() as their class, so their types need RTTI_DECLARATIONS and a registered factory to load back.
+	/// </summary>
+	class JsonTableWriter final
+	{
+	public:
+
+		/// <summary>
+		/// Defaulted constructor.
+		/// </summary>
+		JsonTableWriter() = default;
+
+		/// <summary>
+		/// Copy constructor - deleted, the cache is only meaningful to the writer that built it.
+		/// </summary>
+		JsonTableWriter(const JsonTableWriter& other) = delete;
+
+		/// <summary>
+		/// Defaulted move constructor.
+		/// </summary>
+		JsonTableWriter(JsonTableWriter&& other) noexcept = default;
+
+		/// <summary>
+		/// Copy assignment - deleted, the cache is only meaningful to the writer that built it.
+		/// </summary>
+		JsonTableWriter& operator=(const JsonTableWriter& other) = delete;
+
+		/// <summary>
+		/// Defaulted move assignment.
+		/// </summary>
+		JsonTableWriter& operator=(JsonTableWriter&& other) noexcept = default;
+
+		/// <summary>
+		/// Defaulted destructor.
+		/// </summary>
+		~JsonTableWriter() = default;
+
+		/// <summary>
+		/// Write - Serializes the full scope tree. Does not touch dirty bits.
+		/// </summary>
+		/// <param name="scope">The root scope to serialize. Its entries become the top level members of the document.</param>
+		/// <returns>The Json document text.</returns>
+		static std::string Write(const Scope& scope);
+
+		/// <summary>
+		/// Save - Incrementally serializes the scope tree, re-writing only dirty subtrees, then clears the dirty bits of everything it wrote.
+		/// Falls back to a full write if tracking is disabled or has been re-enabled since the last Save (dirty bits can't be trusted then).
+		/// </summary>
+		/// <param name="root">The root scope to serialize.</param>
+		/// <returns>The Json document text. Valid until the next call to Save or Reset.</returns>
+		const std::string& Save(Scope& root);
+
+		/// <summary>
+		/// SaveToFile - Calls Save() and writes the result to the given file.
+		/// </summary>
+		/// <param name="root">The root scope to serialize.</param>
+		/// <param name="fileName">Path of the file to (over)write.</param>
+		/// <exception cref="std::runtime_error">Throws if the file can't be opened.</exception>
+		void SaveToFile(Scope& root, const std::string& fileName);
+
+		/// <summary>
+		/// Reset - Drops the cached text so the next Save() is a full write.
+		/// </summary>
+		void Reset();
+
+		/// <summary>
+		/// RewrittenCount - Number of scopes that were serialized by the last Save().
+		/// </summary>
+		/// <returns>Scopes written during the last Save.</returns>
+		size_t RewrittenCount() const;
+
+		/// <summary>
+		/// ReusedCount - Number of clean subtrees taken from the cache by the last Save().
+		/// </summary>
+		/// <returns>Subtrees reused during the last Save.</returns>
+		size_t ReusedCount() const;
+
+		/// <summary>
+		/// CachedCount - Number of scopes whose text is cached. Save() drops the text of scopes that have left the tree once the cache has
+		/// grown to twice the size of the tree, so this stays within twice the number of scopes in the last saved tree.
+		/// </summary>
+		/// <returns>Entries in the cache.</returns>
+		size_t CachedCount() const;
+
+	private:
+
+		/// <summary>
+		/// WriteFull - Appends the body of the scope and all of its descendants to out.
+		/// </summary>
+		static void WriteFull(const Scope& scope, std::string& out);
+
+		/// <summary>
+		/// WriteScope - Appends the body ({ "key": {...}, ... }) of the scope to out. Nested scopes are written by calling writeChild.
+		/// </summary>
+		template <typename ChildWriter>
+		static void WriteScope(const Scope& scope, std::string& out, ChildWriter writeChild);
+
+		/// <summary>
+		/// WriteDatum - Appends the "type"/"value" object for a non-table Datum to out.
+		/// </summary>
+		static void WriteDatum(const Datum& datum, std::string& out);
+
+		/// <summary>
+		/// SaveScope - Returns the cached body of the scope, re-serializing it first if it is dirty, forced, or missing from the cache.
+		/// </summary>
+		const std::string& SaveScope(Scope& scope, bool force);
+
+		/// <summary>
+		/// Prune - Drops the cached text of every scope that is no longer in the tree below root.
+		/// </summary>
+		void Prune(Scope& root);
+
+		/// <summary>
+		/// Serialized body of every scope written by Save(), keyed by Scope::Serial(). Not by address: a Scope made at the address of a
+		/// destroyed one could be clean, and would be given the destroyed one's text.
+		/// </summary>
+		HashMap<std::uint64_t, std::string> _cache;
+
+		/// <summary>
+		/// Tracking epoch the cache was built under.
+		/// </summary>
+		size_t _epoch = 0;
+
+		/// <summary>
+		/// Size of the cache after it was last built or pruned, when every entry belonged to a scope in the tree.
+		/// </summary>
+		size_t _liveCount = 0;
+
+		/// <summary>
+		/// Text of the last document produced by Save().
+		/// </summary>
+		std::string _document;
+
+		/// <summary>
+		/// Statistics for the last Save().
+		/// </summary>
+		size_t _rewritten = 0;
+		size_t _reused = 0;
+	};
+}
@@ -0,0 +1,438 @@
+#include "pch.h"
+#include "JsonTokenizer.h"
+#include <algorithm>
+
+namespace FieaGameEngine
+{
+	JsonTokenizer::JsonTokenizer(std::string_view json) :
+		_json(json)
+	{
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Next()
+	{
+		SkipWhitespace();
+		_offset = _position;
+
+		switch (_expectation)
+		{
+		case Expectation::RootValue:
+		case Expectation::Value:
+			_type = ReadValue();
+			break;
+
+		case Expectation::FirstValueOrEnd:
+			_type = (_position < _json.size() && _json[_position] == ']') ? Close(TokenType::EndArray) : ReadValue();
+			break;
+
+		case Expectation::FirstKeyOrEnd:
+			_type = (_position < _json.size() && _json[_position] == '}') ? Close(TokenType::EndObject) : ReadKey();
+			break;
+
+		case Expectation::Key:
+			_type = ReadKey();
+			break;
+
+		case Expectation::SeparatorOrEnd:
+		{
+			const bool isObject = _isObject.Back();
+			const char c = (_position < _json.size() ? _json[_position] : '\0');
+			if (c == ',')
+			{
+				++_position;
+				SkipWhitespace();
+				_offset = _position;
+				_type = (isObject ? ReadKey() : ReadValue());
+			}
+			else if (c == (isObject ? '}' : ']'))
+			{
+				_type = Close(isObject ? TokenType::EndObject : TokenType::EndArray);
+			}
+			else
+			{
+				Fail(isObject ? "Expected ',' or '}' after an object member." : "Expected ',' or ']' after an array element.");
+			}
+			break;
+		}
+
+		case Expectation::Done:
+			if (_position < _json.size())
+			{
+				Fail("Unexpected text after the end of the document.");
+			}
+			_type = TokenType::End;
+			_text = std::string_view();
+			break;
+		}
+
+		return _type;
+	}
+
+	void JsonTokenizer::Skip()
+	{
+		if (_type != TokenType::BeginObject && _type != TokenType::BeginArray)
+		{
+			return;
+		}
+
+		const std::size_t depth = _isObject.Size();
+		while (_isObject.Size() >= depth)
+		{
+			Next();
+		}
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Type() const
+	{
+		return _type;
+	}
+
+	std::string_view JsonTokenizer::Text() const
+	{
+		return _text;
+	}
+
+	std::size_t JsonTokenizer::Offset() const
+	{
+		return _offset;
+	}
+
+	std::size_t JsonTokenizer::Depth() const
+	{
+		return _isObject.Size();
+	}
+
+	std::string_view JsonTokenizer::Document() const
+	{
+		return _json;
+	}
+
+	void JsonTokenizer::SkipWhitespace()
+	{
+		while (_position < _json.size())
+		{
+			const char c = _json[_position];
+			if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+			{
+				++_position;
+			}
+			else if (c == '/' && _position + 1 < _json.size() && _json[_position + 1] == '/')
+			{
+				const std::size_t lineEnd = _json.find('\n', _position);
+				_position = (lineEnd == std::string_view::npos ? _json.size() : lineEnd + 1);
+			}
+			else if (c == '/' && _position + 1 < _json.size() && _json[_position + 1] == '*')
+			{
+				const std::size_t commentEnd = _json.find("*/", _position + 2);
+				if (commentEnd == std::string_view::npos)
+				{
+					Fail("Unterminated comment.");
+				}
+				_position = commentEnd + 2;
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::ReadKey()
+	{
+		if (_position >= _json.size() || _json[_position] != '"')
+		{
+			Fail("Expected a member name.");
+		}
+
+		ReadString();
+		SkipWhitespace();
+		if (_position >= _json.size() || _json[_position] != ':')
+		{
+			Fail("Expected ':' after a member name.");
+		}
+
+		++_position;
+		_expectation = Expectation::Value;
+		return TokenType::Key;
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::ReadValue()
+	{
+		if (_position >= _json.size())
+		{
+			Fail("Unexpected end of the document.");
+		}
+
+		const char c = _json[_position];
+		switch (c)
+		{
+		case '{':
+			++_position;
+			_isObject.PushBack(true);
+			_expectation = Expectation::FirstKeyOrEnd;
+			_text = std::string_view();
+			return TokenType::BeginObject;
+
+		case '[':
+			++_position;
+			_isObject.PushBack(false);
+			_expectation = Expectation::FirstValueOrEnd;
+			_text = std::string_view();
+			return TokenType::BeginArray;
+
+		case '"':
+			ReadString();
+			FinishValue();
+			return TokenType::String;
+
+		case 't':
+			return ReadLiteral("true", TokenType::Boolean);
+
+		case 'f':
+			return ReadLiteral("false", TokenType::Boolean);
+
+		case 'n':
+			return ReadLiteral("null", TokenType::Null);
+
+		default:
+			if (c == '-' || (c >= '0' && c <= '9'))
+			{
+				const TokenType type = ReadNumber();
+				FinishValue();
+				return type;
+			}
+			Fail("Expected a value.");
+		}
+	}
+
+	void JsonTokenizer::ReadString()
+	{
+		const std::size_t start = ++_position;
+
+		//	Strings without escapes are handed out in place
+		while (_position < _json.size() && _json[_position] != '"' && _json[_position] != '\\')
+		{
+			++_position;
+		}
+
+		if (_position >= _json.size())
+		{
+			Fail("Unterminated string.");
+		}
+
+		if (_json[_position] == '"')
+		{
+			_text = _json.substr(start, _position - start);
+			++_position;
+			return;
+		}
+
+		_unescaped.assign(_json.data() + start, _position - start);
+		while (true)
+		{
+			if (_position >= _json.size())
+			{
+				Fail("Unterminated string.");
+			}
+
+			const char c = _json[_position++];
+			if (c == '"')
+			{
+				break;
+			}
+
+			if (c != '\\')
+			{
+				_unescaped.push_back(c);
+				continue;
+			}
+
+			if (_position >= _json.size())
+			{
+				Fail("Unterminated string.");
+			}
+
+			const char escape = _json[_position++];
+			switch (escape)
+			{
+			case '"': _unescaped.push_back('"'); break;
+			case '\\': _unescaped.push_back('\\'); break;
+			case '/': _unescaped.push_back('/'); break;
+			case 'b': _unescaped.push_back('\b'); break;
+			case 'f': _unescaped.push_back('\f'); break;
+			case 'n': _unescaped.push_back('\n'); break;
+			case 'r': _unescaped.push_back('\r'); break;
+			case 't': _unescaped.push_back('\t'); break;
+			case 'u':
+			{
+				unsigned int codePoint = ReadHexQuad();
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					//	A high surrogate must be followed by the low half of the pair
+					if (_position + 1 >= _json.size() || _json[_position] != '\\' || _json[_position + 1] != 'u')
+					{
+						Fail("Expected the second half of a surrogate pair.");
+					}
+					_position += 2;
+					const unsigned int low = ReadHexQuad();
+					if (low < 0xDC00 || low > 0xDFFF)
+					{
+						Fail("Invalid second half of a surrogate pair.");
+					}
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+
+				//	UTF-8 encode
+				if (codePoint < 0x80)
+				{
+					_unescaped.push_back(static_cast<char>(codePoint));
+				}
+				else if (codePoint < 0x800)
+				{
+					_unescaped.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+					_unescaped.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else if (codePoint < 0x10000)
+				{
+					_unescaped.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+					_unescaped.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					_unescaped.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else
+				{
+					_unescaped.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+					_unescaped.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+					_unescaped.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					_unescaped.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				break;
+			}
+			default:
+				Fail("Invalid escape sequence in a string.");
+			}
+		}
+
+		_text = _unescaped;
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::ReadNumber()
+	{
+		const std::size_t start = _position;
+		const auto isDigit = [this] { return _position < _json.size() && _json[_position] >= '0' && _json[_position] <= '9'; };
+		const auto readDigits = [this, &isDigit]
+		{
+			if (isDigit() == false)
+			{
+				Fail("Expected a digit.");
+			}
+			while (isDigit())
+			{
+				++_position;
+			}
+		};
+
+		if (_json[_position] == '-')
+		{
+			++_position;
+		}
+
+		//	No leading zeros
+		if (_position < _json.size() && _json[_position] == '0')
+		{
+			++_position;
+		}
+		else
+		{
+			readDigits();
+		}
+
+		TokenType type = TokenType::Integer;
+		if (_position < _json.size() && _json[_position] == '.')
+		{
+			++_position;
+			readDigits();
+			type = TokenType::Real;
+		}
+
+		if (_position < _json.size() && (_json[_position] == 'e' || _json[_position] == 'E'))
+		{
+			++_position;
+			if (_position < _json.size() && (_json[_position] == '+' || _json[_position] == '-'))
+			{
+				++_position;
+			}
+			readDigits();
+			type = TokenType::Real;
+		}
+
+		_text = _json.substr(start, _position - start);
+		return type;
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::ReadLiteral(std::string_view literal, TokenType type)
+	{
+		if (_json.compare(_position, literal.size(), literal) != 0)
+		{
+			Fail("Expected a value.");
+		}
+
+		_text = _json.substr(_position, literal.size());
+		_position += literal.size();
+		FinishValue();
+		return type;
+	}
+
+	unsigned int JsonTokenizer::ReadHexQuad()
+	{
+		if (_position + 4 > _json.size())
+		{
+			Fail("Unterminated \\u escape.");
+		}
+
+		unsigned int value = 0;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			const char c = _json[_position++];
+			value <<= 4;
+			if (c >= '0' && c <= '9')
+			{
+				value |= static_cast<unsigned int>(c - '0');
+			}
+			else if (c >= 'a' && c <= 'f')
+			{
+				value |= static_cast<unsigned int>(c - 'a' + 10);
+			}
+			else if (c >= 'A' && c <= 'F')
+			{
+				value |= static_cast<unsigned int>(c - 'A' + 10);
+			}
+			else
+			{
+				Fail("Invalid hex digit in a \\u escape.");
+			}
+		}
+
+		return value;
+	}
+
+	JsonTokenizer::TokenType JsonTokenizer::Close(TokenType type)
+	{
+		++_position;
+		_isObject.PopBack();
+		_text = std::string_view();
+		FinishValue();
+		return type;
+	}
+
+	void JsonTokenizer::FinishValue()
+	{
+		_expectation = (_isObject.IsEmpty() ? Expectation::Done : Expectation::SeparatorOrEnd);
+	}
+
+	void JsonTokenizer::Fail(const char* message) const
+	{
+		const std::size_t end = std::min(_position, _json.size());
+		const std::size_t line = 1 + static_cast<std::size_t>(std::count(_json.begin(), _json.begin() + end, '\n'));
+		throw std::runtime_error("Json parse error on line " + std::to_string(line) + ": " + message);
+	}
+}
@@ -0,0 +1,192 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// JsonTokenizer - Pull tokenizer over Json text held in memory, such as a MappedFile. Each call to Next reads one token in document order and
+	/// checks it against the grammar, so a document is validated as it is consumed and nothing but the current token and the nesting of the
+	/// open containers is kept. Accepts the same documents as JsonCpp's default reader, including // and /* */ comments.
+	/// </summary>
+	class JsonTokenizer final
+	{
+	public:
+		/// <summary>
+		/// TokenType - Kinds of tokens. Key is an object member's name, the members of an object are always Key followed by the member's value.
+		/// </summary>
+		enum class TokenType
+		{
+			BeginObject,
+			EndObject,
+			BeginArray,
+			EndArray,
+			Key,
+			String,
+			Integer,
+			Real,
+			Boolean,
+			Null,
+			End
+		};
+
+		/// <summary>
+		/// Constructor - Tokenizes a Json document. The text isn't copied and must outlive the tokenizer.
+		/// </summary>
+		/// <param name="json">The Json document.</param>
+		explicit JsonTokenizer(std::string_view json);
+
+		JsonTokenizer(const JsonTokenizer&) = delete;
+		JsonTokenizer& operator=(const JsonTokenizer&) = delete;
+		JsonTokenizer(JsonTokenizer&&) = default;
+		JsonTokenizer& operator=(JsonTokenizer&&) = default;
+		~JsonTokenizer() = default;
+
+		/// <summary>
+		/// Next - Reads the next token. Returns End, again and again, once the document is complete.
+		/// </summary>
+		/// <returns>Type of the token read.</returns>
+		/// <exception cref="std::runtime_error">Throws if the document is malformed, with the line of the error.</exception>
+		TokenType Next();
+
+		/// <summary>
+		/// Skip - Skips the rest of the value the current token began. Does nothing unless the current token is BeginObject or BeginArray.
+		/// Afterwards the current token is the matching EndObject or EndArray.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Throws if the skipped text is malformed.</exception>
+		void Skip();
+
+		/// <summary>
+		/// Type - Returns the type of the current token.
+		/// </summary>
+		TokenType Type() const;
+
+		/// <summary>
+		/// Text - Returns the current token's text: the unescaped characters of a Key or String, the literal of an Integer, Real or Boolean.
+		/// Valid until the next call to Next.
+		/// </summary>
+		std::string_view Text() const;
+
+		/// <summary>
+		/// Offset - Returns the byte offset of the current token in the document.
+		/// </summary>
+		std::size_t Offset() const;
+
+		/// <summary>
+		/// Depth - Returns the number of open objects and arrays.
+		/// </summary>
+		std::size_t Depth() const;
+
+		/// <summary>
+		/// Document - Returns the whole document being read.
+		/// </summary>
+		std::string_view Document() const;
+
+	private:
+		/// <summary>
+		/// Expectation - What the grammar allows next.
+		/// </summary>
+		enum class Expectation
+		{
+			RootValue,
+			Value,
+			FirstValueOrEnd,
+			FirstKeyOrEnd,
+			Key,
+			SeparatorOrEnd,
+			Done
+		};
+
+		/// <summary>
+		/// Skips whitespace and comments.
+		/// </summary>
+		void SkipWhitespace();
+
+		/// <summary>
+		/// Reads a Key token and the colon after it.
+		/// </summary>
+		TokenType ReadKey();
+
+		/// <summary>
+		/// Reads the token a value starts with.
+		/// </summary>
+		TokenType ReadValue();
+
+		/// <summary>
+		/// Reads a string, leaving its unescaped characters in _text.
+		/// </summary>
+		void ReadString();
+
+		/// <summary>
+		/// Reads a number, returning Integer or Real.
+		/// </summary>
+		TokenType ReadNumber();
+
+		/// <summary>
+		/// Reads true, false or null.
+		/// </summary>
+		TokenType ReadLiteral(std::string_view literal, TokenType type);
+
+		/// <summary>
+		/// Reads four hex digits of a \u escape.
+		/// </summary>
+		unsigned int ReadHexQuad();
+
+		/// <summary>
+		/// Pops the innermost container for its closing token.
+		/// </summary>
+		TokenType Close(TokenType type);
+
+		/// <summary>
+		/// Sets what may follow a complete value.
+		/// </summary>
+		void FinishValue();
+
+		/// <summary>
+		/// Throws a runtime_error naming the line of the current position.
+		/// </summary>
+		[[noreturn]] void Fail(const char* message) const;
+
+		/// <summary>
+		/// _json - The document.
+		/// </summary>
+		std::string_view _json;
+
+		/// <summary>
+		/// _position - Offset of the next character to read.
+		/// </summary>
+		std::size_t _position = 0;
+
+		/// <summary>
+		/// _offset - Offset of the current token.
+		/// </summary>
+		std::size_t _offset = 0;
+
+		/// <summary>
+		/// _type - Type of the current token.
+		/// </summary>
+		TokenType _type = TokenType::End;
+
+		/// <summary>
+		/// _expectation - What the grammar allows next.
+		/// </summary>
+		Expectation _expectation = Expectation::RootValue;
+
+		/// <summary>
+		/// _text - Text of the current token. Points into the document unless the token had escapes.
+		/// </summary>
+		std::string_view _text;
+
+		/// <summary>
+		/// _unescaped - Characters of the last string that had escapes.
+		/// </summary>
+		std::string _unescaped;
+
+		/// <summary>
+		/// _isObject - One entry per open container, true for objects and false for arrays.
+		/// </summary>
+		Vector<bool> _isObject;
+	};
+}
@@ -0,0 +1,27 @@
+#include "pch.h"
+#include "LazyContent.h"
+
+namespace FieaGameEngine
+{
+	std::size_t LazyContent::Stats::PendingBytes() const
+	{
+		return _deferredBytes - _materializedBytes + _evictedBytes;
+	}
+
+	LazyContent::Stats LazyContent::GetStats()
+	{
+		return Stats{ _deferred.load(), _deferredBytes.load(), _materialized.load(), _materializedBytes.load(), _evicted.load(), _evictedBytes.load(),
+			std::chrono::nanoseconds(_materializeTime.load()) };
+	}
+
+	void LazyContent::ResetStats()
+	{
+		_deferred = 0;
+		_deferredBytes = 0;
+		_materialized = 0;
+		_materializedBytes = 0;
+		_evicted = 0;
+		_evictedBytes = 0;
+		_materializeTime = 0;
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace FieaGameEngine
+{
+	class Scope;
+
+	/// <summary>
+	/// LazyContent Class - What a placeholder Scope is filled with the first time it is accessed, see Scope::SetLazyContent(). Placeholders stand in
+	/// for the parts of a level that may never be touched: until then they hold only this, rather than every Scope and Datum of their subtree.
+	/// Counts what was deferred, materialized and evicted across every placeholder, so the memory and load time saved can be measured.
+	/// </summary>
+	class LazyContent
+	{
+		friend class Scope;
+
+	public:
+		/// <summary>
+		/// Stats - Totals since the last ResetStats(). Bytes are those of the content's source, a stand in for the subtree built from it.
+		/// </summary>
+		struct Stats final
+		{
+			/// <summary>
+			/// _deferred - Placeholders given content.
+			/// </summary>
+			std::size_t _deferred;
+
+			/// <summary>
+			/// _deferredBytes - Size of the content given to placeholders.
+			/// </summary>
+			std::size_t _deferredBytes;
+
+			/// <summary>
+			/// _materialized - Placeholders filled from their content.
+			/// </summary>
+			std::size_t _materialized;
+
+			/// <summary>
+			/// _materializedBytes - Size of the content placeholders were filled from.
+			/// </summary>
+			std::size_t _materializedBytes;
+
+			/// <summary>
+			/// _evicted - Materialized Scopes turned back into placeholders.
+			/// </summary>
+			std::size_t _evicted;
+
+			/// <summary>
+			/// _evictedBytes - Size of the content of the evicted Scopes.
+			/// </summary>
+			std::size_t _evictedBytes;
+
+			/// <summary>
+			/// _materializeTime - Time spent filling placeholders.
+			/// </summary>
+			std::chrono::nanoseconds _materializeTime;
+
+			/// <summary>
+			/// PendingBytes - Size of the content deferred and not materialized, or evicted since.
+			/// </summary>
+			/// <returns>_deferredBytes - _materializedBytes + _evictedBytes.</returns>
+			std::size_t PendingBytes() const;
+		};
+
+		/// <summary>
+		/// Defaulted constructor.
+		/// </summary>
+		LazyContent() = default;
+
+		LazyContent(const LazyContent&) = delete;
+		LazyContent& operator=(const LazyContent&) = delete;
+		LazyContent(LazyContent&&) = delete;
+		LazyContent& operator=(LazyContent&&) = delete;
+
+		/// <summary>
+		/// Virtual Destructor
+		/// </summary>
+		virtual ~LazyContent() = default;
+
+		/// <summary>
+		/// Materialize - Fills an empty Scope with the subtree this content stands for. Called at most once per placeholder, unless it is evicted.
+		/// </summary>
+		/// <param name="scope">The placeholder.</param>
+		virtual void Materialize(Scope& scope) const = 0;
+
+		/// <summary>
+		/// ByteSize - Returns the size of the content's source.
+		/// </summary>
+		virtual std::size_t ByteSize() const = 0;
+
+		/// <summary>
+		/// GetStats - Returns the totals since the last ResetStats().
+		/// </summary>
+		static Stats GetStats();
+
+		/// <summary>
+		/// ResetStats - Zeroes the totals.
+		/// </summary>
+		static void ResetStats();
+
+	private:
+		/// <summary>
+		/// Totals, atomic as placeholders can be made by parses on other threads.
+		/// </summary>
+		inline static std::atomic<std::size_t> _deferred{ 0 };
+		inline static std::atomic<std::size_t> _deferredBytes{ 0 };
+		inline static std::atomic<std::size_t> _materialized{ 0 };
+		inline static std::atomic<std::size_t> _materializedBytes{ 0 };
+		inline static std::atomic<std::size_t> _evicted{ 0 };
+		inline static std::atomic<std::size_t> _evictedBytes{ 0 };
+		inline static std::atomic<std::chrono::nanoseconds::rep> _materializeTime{ 0 };
+	};
+}
@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "MappedFile.h"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FieaGameEngine
+{
+	MappedFile::MappedFile(const std::string& fileName, Access access)
+	{
+		Open(fileName, access);
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept :
+		_data(other._data), _size(other._size), _isOpen(other._isOpen), _access(other._access)
+	{
+		other._data = nullptr;
+		other._size = 0;
+		other._isOpen = false;
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			_data = other._data;
+			_size = other._size;
+			_isOpen = other._isOpen;
+			_access = other._access;
+
+			other._data = nullptr;
+			other._size = 0;
+			other._isOpen = false;
+		}
+
+		return *this;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+#ifdef _WIN32
+	bool MappedFile::Open(const std::string& fileName, Access access)
+	{
+		Close();
+
+		HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if (GetFileSizeEx(file, &size) == FALSE)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		//	Empty files can't be mapped, but are valid files all the same
+		if (size.QuadPart > 0)
+		{
+			//	The view keeps the mapping and the file alive, so neither handle is kept
+			HANDLE mapping = CreateFileMappingA(file, nullptr, (access == Access::CopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY), 0, 0, nullptr);
+			CloseHandle(file);
+			if (mapping == nullptr)
+			{
+				return false;
+			}
+
+			_data = static_cast<char*>(MapViewOfFile(mapping, (access == Access::CopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ), 0, 0, 0));
+			CloseHandle(mapping);
+			if (_data == nullptr)
+			{
+				return false;
+			}
+			_size = static_cast<std::size_t>(size.QuadPart);
+		}
+		else
+		{
+			CloseHandle(file);
+		}
+
+		_isOpen = true;
+		_access = access;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (_data != nullptr)
+		{
+			UnmapViewOfFile(_data);
+		}
+
+		_data = nullptr;
+		_size = 0;
+		_isOpen = false;
+	}
+#else
+	bool MappedFile::Open(const std::string& fileName, Access access)
+	{
+		Close();
+
+		const int file = open(fileName.c_str(), O_RDONLY);
+		if (file < 0)
+		{
+			return false;
+		}
+
+		struct stat status;
+		if (fstat(file, &status) != 0 || S_ISREG(status.st_mode) == false)
+		{
+			close(file);
+			return false;
+		}
+
+		//	Empty files can't be mapped, but are valid files all the same
+		if (status.st_size > 0)
+		{
+			//	MAP_PRIVATE is copy on write already, writes only need the protection to allow them
+			const int protection = (access == Access::CopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ);
+			void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size), protection, MAP_PRIVATE, file, 0);
+			close(file);
+			if (data == MAP_FAILED)
+			{
+				return false;
+			}
+
+			madvise(data, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+			_data = static_cast<char*>(data);
+			_size = static_cast<std::size_t>(status.st_size);
+		}
+		else
+		{
+			close(file);
+		}
+
+		_isOpen = true;
+		_access = access;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (_data != nullptr)
+		{
+			munmap(_data, _size);
+		}
+
+		_data = nullptr;
+		_size = 0;
+		_isOpen = false;
+	}
+#endif
+
+	bool MappedFile::IsOpen() const
+	{
+		return _isOpen;
+	}
+
+	const char* MappedFile::Data() const
+	{
+		return _data;
+	}
+
+	char* MappedFile::MutableData() const
+	{
+		return (_access == Access::CopyOnWrite ? _data : nullptr);
+	}
+
+	std::size_t MappedFile::Size() const
+	{
+		return _size;
+	}
+
+	std::string_view MappedFile::View() const
+	{
+		return std::string_view(_data, _size);
+	}
+}
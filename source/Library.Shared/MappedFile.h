@@ -0,0 +1,119 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// MappedFile Class - Memory mapping of a whole file. The file's bytes are paged in by the OS as they are first read and can be
+	/// dropped again under memory pressure, so reading a large file through a mapping doesn't keep a heap copy of it alive.
+	/// The file itself is never written: a copy on write mapping gives each page written through MutableData a private copy instead.
+	/// Like an ifstream, a file that can't be opened leaves the MappedFile closed instead of throwing.
+	/// </summary>
+	class MappedFile final
+	{
+	public:
+		/// <summary>
+		/// Access - What the mapping may be used for.
+		/// </summary>
+		enum class Access
+		{
+			ReadOnly,
+			CopyOnWrite
+		};
+
+		/// <summary>
+		/// Constructor - Creates a closed MappedFile.
+		/// </summary>
+		MappedFile() = default;
+
+		/// <summary>
+		/// Constructor - Maps a file.
+		/// </summary>
+		/// <param name="fileName">Path of the file to map.</param>
+		/// <param name="access">ReadOnly, or CopyOnWrite to be able to write to the mapped bytes.</param>
+		explicit MappedFile(const std::string& fileName, Access access = Access::ReadOnly);
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/// <summary>
+		/// Move constructor - Takes over other's mapping, leaving other closed.
+		/// </summary>
+		/// <param name="other">MappedFile being moved.</param>
+		MappedFile(MappedFile&& other) noexcept;
+
+		/// <summary>
+		/// Move assignment - Closes this file and takes over other's mapping, leaving other closed.
+		/// </summary>
+		/// <param name="other">MappedFile being moved.</param>
+		/// <returns>Reference to this MappedFile.</returns>
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/// <summary>
+		/// Destructor - Unmaps the file.
+		/// </summary>
+		~MappedFile();
+
+		/// <summary>
+		/// Open - Maps a file, closing the one mapped before.
+		/// </summary>
+		/// <param name="fileName">Path of the file to map.</param>
+		/// <param name="access">ReadOnly, or CopyOnWrite to be able to write to the mapped bytes.</param>
+		/// <returns>True if the file was mapped, false if it couldn't be opened.</returns>
+		bool Open(const std::string& fileName, Access access = Access::ReadOnly);
+
+		/// <summary>
+		/// Close - Unmaps the file. Views of it are dangling afterwards.
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// IsOpen - Tells you if a file is mapped. An empty file is open with a Size of 0.
+		/// </summary>
+		bool IsOpen() const;
+
+		/// <summary>
+		/// Data - Returns the first byte of the file, nullptr if no file is mapped or the file is empty.
+		/// </summary>
+		const char* Data() const;
+
+		/// <summary>
+		/// MutableData - Returns the first byte of a CopyOnWrite mapping. Writes stay private to this process and are dropped when the file is closed.
+		/// </summary>
+		/// <returns>The first byte of the file, nullptr if the mapping is ReadOnly, no file is mapped or the file is empty.</returns>
+		char* MutableData() const;
+
+		/// <summary>
+		/// Size - Returns the size of the file in bytes.
+		/// </summary>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// View - Returns the file's contents. Valid until the file is closed.
+		/// </summary>
+		std::string_view View() const;
+
+	private:
+		/// <summary>
+		/// _data - The mapped bytes.
+		/// </summary>
+		char* _data = nullptr;
+
+		/// <summary>
+		/// _size - Number of mapped bytes.
+		/// </summary>
+		std::size_t _size = 0;
+
+		/// <summary>
+		/// _isOpen - True while a file is mapped, including an empty one (which has no mapping).
+		/// </summary>
+		bool _isOpen = false;
+
+		/// <summary>
+		/// _access - Access the file was mapped with.
+		/// </summary>
+		Access _access = Access::ReadOnly;
+	};
+}
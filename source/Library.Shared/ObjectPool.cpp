@@ -0,0 +1,271 @@
+#include "pch.h"
+#include "ObjectPool.h"
+#include <algorithm>
+#include <mutex>
+
+namespace FieaGameEngine
+{
+	struct ObjectPool::Core final
+	{
+		Core(std::size_t stride, std::size_t blockCount) :
+			_stride(stride), _blockCount(blockCount)
+		{
+		}
+
+		Core(const Core&) = delete;
+		Core& operator=(const Core&) = delete;
+
+		~Core()
+		{
+			while (_blocks != nullptr)
+			{
+				void* next = *reinterpret_cast<void**>(_blocks);
+				::operator delete(_blocks);
+				_blocks = next;
+			}
+		}
+
+		//	Blocks are a link to the next block followed by count slots, each a header naming this Core and room for one object
+		void Grow(std::size_t count)
+		{
+			char* block = static_cast<char*>(::operator new(HeaderSize + count * _stride));
+			*reinterpret_cast<void**>(block) = _blocks;
+			_blocks = block;
+
+			for (std::size_t i = count; i-- > 0;)
+			{
+				char* slot = block + HeaderSize + i * _stride;
+				*reinterpret_cast<Core**>(slot) = this;
+				Push(slot + HeaderSize);
+			}
+			_capacity += count;
+		}
+
+		void Push(void* object)
+		{
+			*reinterpret_cast<void**>(object) = _freeList;
+			_freeList = object;
+		}
+
+		void Release(void* object)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			Push(object);
+			--_liveCount;
+
+			//	The pool is gone and this was its last object
+			if (_isOrphaned && _liveCount == 0)
+			{
+				lock.unlock();
+				delete this;
+			}
+		}
+
+		std::size_t _stride;
+		std::size_t _blockCount;
+		void* _blocks = nullptr;
+		void* _freeList = nullptr;
+		std::size_t _capacity = 0;
+		std::size_t _liveCount = 0;
+		std::size_t _highWaterMark = 0;
+		std::size_t _allocations = 0;
+		std::size_t _hits = 0;
+		bool _isOrphaned = false;
+		mutable std::mutex _mutex;
+	};
+
+	ObjectPool::ObjectPool(std::size_t objectSize, std::size_t blockCount) :
+		_objectSize(objectSize), _blockCount(blockCount)
+	{
+		if (_objectSize < sizeof(void*))
+		{
+			_objectSize = sizeof(void*);
+		}
+
+		if (_blockCount == 0)
+		{
+			throw std::runtime_error("ObjectPool block count must be greater than zero. ObjectPool::ObjectPool()");
+		}
+	}
+
+	ObjectPool::~ObjectPool()
+	{
+		Core* core = _core.load();
+		if (core != nullptr)
+		{
+			std::unique_lock<std::mutex> lock(core->_mutex);
+			if (core->_liveCount == 0)
+			{
+				lock.unlock();
+				delete core;
+			}
+			else
+			{
+				core->_isOrphaned = true;
+			}
+		}
+	}
+
+	void* ObjectPool::Allocate()
+	{
+		Core& core = GetCore();
+		std::lock_guard<std::mutex> lock(core._mutex);
+		++core._allocations;
+
+		if (core._freeList == nullptr)
+		{
+			core.Grow(core._blockCount);
+		}
+		else
+		{
+			++core._hits;
+		}
+
+		void* object = core._freeList;
+		core._freeList = *reinterpret_cast<void**>(object);
+
+		if (++core._liveCount > core._highWaterMark)
+		{
+			core._highWaterMark = core._liveCount;
+		}
+
+		return object;
+	}
+
+	void* ObjectPool::AllocateContiguous(std::size_t count)
+	{
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+		Core& core = GetCore();
+		std::lock_guard<std::mutex> lock(core._mutex);
+		core._allocations += count;
+
+		//	Grow pushes a block's slots so that they come off the free list first to last
+		core.Grow(std::max(count, core._blockCount));
+		void* first = core._freeList;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			core._freeList = *reinterpret_cast<void**>(core._freeList);
+		}
+
+		core._liveCount += count;
+		if (core._liveCount > core._highWaterMark)
+		{
+			core._highWaterMark = core._liveCount;
+		}
+
+		return first;
+	}
+
+	std::size_t ObjectPool::Stride() const
+	{
+		return HeaderSize + (_objectSize + HeaderSize - 1) / HeaderSize * HeaderSize;
+	}
+
+	void ObjectPool::Reserve(std::size_t count)
+	{
+		Core& core = GetCore();
+		std::lock_guard<std::mutex> lock(core._mutex);
+		if (count > core._capacity)
+		{
+			core.Grow(count - core._capacity);
+		}
+	}
+
+	std::size_t ObjectPool::ObjectSize() const
+	{
+		return _objectSize;
+	}
+
+	std::size_t ObjectPool::Capacity() const
+	{
+		return Read(&Core::_capacity);
+	}
+
+	std::size_t ObjectPool::LiveCount() const
+	{
+		return Read(&Core::_liveCount);
+	}
+
+	std::size_t ObjectPool::HighWaterMark() const
+	{
+		return Read(&Core::_highWaterMark);
+	}
+
+	std::size_t ObjectPool::Allocations() const
+	{
+		return Read(&Core::_allocations);
+	}
+
+	std::size_t ObjectPool::Hits() const
+	{
+		return Read(&Core::_hits);
+	}
+
+	float ObjectPool::HitRate() const
+	{
+		const std::size_t allocations = Allocations();
+		return (allocations == 0 ? 0.0f : static_cast<float>(Hits()) / allocations);
+	}
+
+	void* ObjectPool::AllocateUnpooled(std::size_t size)
+	{
+		char* slot = static_cast<char*>(::operator new(HeaderSize + size));
+		*reinterpret_cast<Core**>(slot) = nullptr;
+		return slot + HeaderSize;
+	}
+
+	void ObjectPool::Deallocate(void* object)
+	{
+		if (object == nullptr)
+		{
+			return;
+		}
+
+		char* slot = static_cast<char*>(object) - HeaderSize;
+		Core* owner = *reinterpret_cast<Core**>(slot);
+		if (owner == nullptr)
+		{
+			::operator delete(slot);
+		}
+		else
+		{
+			owner->Release(object);
+		}
+	}
+
+	ObjectPool::Core& ObjectPool::GetCore()
+	{
+		Core* core = _core.load(std::memory_order_acquire);
+		if (core == nullptr)
+		{
+			//	Threads racing to allocate first each make a Core, the one that loses deletes its own
+			gsl::owner<Core*> created = new Core(Stride(), _blockCount);
+			if (_core.compare_exchange_strong(core, created, std::memory_order_acq_rel))
+			{
+				core = created;
+			}
+			else
+			{
+				delete created;
+			}
+		}
+
+		return *core;
+	}
+
+	std::size_t ObjectPool::Read(std::size_t Core::* counter) const
+	{
+		const Core* core = _core.load(std::memory_order_acquire);
+		if (core == nullptr)
+		{
+			return 0;
+		}
+
+		std::lock_guard<std::mutex> lock(core->_mutex);
+		return core->*counter;
+	}
+}
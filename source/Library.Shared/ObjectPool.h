@@ -0,0 +1,189 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	class ObjectPool;
+
+	/// <summary>
+	/// IsPoolAllocated - True for classes that declare the operator new(size_t, ObjectPool&) and matching deletes that ConcreteFactory pools through.
+	/// </summary>
+	template <typename T, typename = void>
+	struct IsPoolAllocated : std::false_type
+	{
+	};
+
+	template <typename T>
+	struct IsPoolAllocated<T, std::void_t<decltype(T::operator new(std::size_t{}, std::declval<ObjectPool&>()))>> : std::true_type
+	{
+	};
+
+	/// <summary>
+	/// ObjectPool Class - Recycles the storage of one concrete type. Slots are carved out of blocks allocated BlockCount at a time and kept on a free
+	/// list once the object living in them is deleted, so spawn and despawn churn stops reaching the heap after the first wave.
+	/// Every slot starts with a header naming its pool, which is how a class level operator delete routes a plain delete back to it.
+	/// A pool is owned by its ConcreteFactory. If the factory goes away while pooled objects are still alive, the blocks are released with the last of them.
+	/// Allocation and deallocation lock the pool, so factories can create and objects can be deleted on any thread.
+	/// </summary>
+	class ObjectPool final
+	{
+	public:
+		/// <summary>
+		/// Bytes in front of every object allocated through AllocateUnpooled or a pool. Blocks come from the global operator new, so stepping past
+		/// the header by the default new alignment keeps the object at the alignment a plain new would have given it.
+		/// </summary>
+		static constexpr std::size_t HeaderSize = (__STDCPP_DEFAULT_NEW_ALIGNMENT__ < sizeof(void*) ? sizeof(void*) : __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+		static_assert(HeaderSize % __STDCPP_DEFAULT_NEW_ALIGNMENT__ == 0, "The header must keep objects at the default new alignment.");
+
+		/// <summary>
+		/// Number of slots allocated each time a pool runs dry, unless a pool is given its own.
+		/// </summary>
+		static constexpr std::size_t DefaultBlockCount = 32;
+
+		/// <summary>
+		/// Constructor - Creates an empty pool. Nothing is allocated until the first Allocate or Reserve.
+		/// </summary>
+		/// <param name="objectSize">Size of the objects kept in the pool.</param>
+		/// <param name="blockCount">Number of slots allocated each time the pool grows.</param>
+		explicit ObjectPool(std::size_t objectSize, std::size_t blockCount = DefaultBlockCount);
+
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool(ObjectPool&&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+		ObjectPool& operator=(ObjectPool&&) = delete;
+
+		/// <summary>
+		/// Destructor - Releases the pool's blocks, or hands them to the live objects if there are any left.
+		/// </summary>
+		~ObjectPool();
+
+		/// <summary>
+		/// Allocate - Takes a slot off the free list, growing the pool by a block if it is empty.
+		/// </summary>
+		/// <returns>Uninitialized storage for one object, to be freed with Deallocate.</returns>
+		void* Allocate();
+
+		/// <summary>
+		/// Create - Default constructs a T in the pool if T is pool allocated, on the heap otherwise. Either way it is freed with a plain delete.
+		/// </summary>
+		/// <typeparam name="T">Type to create. Its size must not exceed ObjectSize().</typeparam>
+		/// <returns>Address of the new object.</returns>
+		template <typename T>
+		T* Create();
+
+		/// <summary>
+		/// Create - Default constructs count Ts and appends them to products. Pool allocated Ts are taken from AllocateContiguous, so they sit
+		/// back to back in a fresh block whatever the free list holds.
+		/// </summary>
+		/// <typeparam name="T">Type to create. Its size must not exceed ObjectSize().</typeparam>
+		/// <typeparam name="TContainer">Container of T* (or of a base of T) with PushBack.</typeparam>
+		/// <param name="count">Number of objects to create.</param>
+		/// <param name="products">Container the objects are appended to.</param>
+		template <typename T, typename TContainer>
+		void Create(std::size_t count, TContainer& products);
+
+		/// <summary>
+		/// AllocateContiguous - Takes count slots that sit back to back, Stride() bytes apart, from a new block of at least count slots (and no
+		/// fewer than the pool's block count, the rest going on the free list). Slots already free are left for Allocate.
+		/// </summary>
+		/// <param name="count">Number of slots.</param>
+		/// <returns>The first slot, nullptr if count is 0. Each slot is freed on its own with Deallocate.</returns>
+		void* AllocateContiguous(std::size_t count);
+
+		/// <summary>
+		/// Stride - Returns the distance in bytes from one slot of a block to the next.
+		/// </summary>
+		std::size_t Stride() const;
+
+		/// <summary>
+		/// Reserve - Grows the pool until it has at least count slots, so the next count allocations are all hits.
+		/// </summary>
+		/// <param name="count">Number of slots wanted.</param>
+		void Reserve(std::size_t count);
+
+		/// <summary>
+		/// ObjectSize - Returns the size of the objects kept in the pool.
+		/// </summary>
+		std::size_t ObjectSize() const;
+
+		/// <summary>
+		/// Capacity - Returns the number of slots the pool owns, free or in use.
+		/// </summary>
+		std::size_t Capacity() const;
+
+		/// <summary>
+		/// LiveCount - Returns the number of slots currently holding an object.
+		/// </summary>
+		std::size_t LiveCount() const;
+
+		/// <summary>
+		/// HighWaterMark - Returns the largest LiveCount the pool has reached.
+		/// </summary>
+		std::size_t HighWaterMark() const;
+
+		/// <summary>
+		/// Allocations - Returns the number of Allocate calls made on the pool.
+		/// </summary>
+		std::size_t Allocations() const;
+
+		/// <summary>
+		/// Hits - Returns the number of allocations served from the free list without growing the pool.
+		/// </summary>
+		std::size_t Hits() const;
+
+		/// <summary>
+		/// HitRate - Returns Hits() / Allocations(), 0 before the first allocation.
+		/// </summary>
+		float HitRate() const;
+
+		/// <summary>
+		/// AllocateUnpooled - Allocates storage from the heap with a header that marks it as not pooled, for the plain new of a pool allocated class.
+		/// </summary>
+		/// <param name="size">Size of the object.</param>
+		/// <returns>Uninitialized storage for the object, to be freed with Deallocate.</returns>
+		static void* AllocateUnpooled(std::size_t size);
+
+		/// <summary>
+		/// Deallocate - Frees storage from Allocate or AllocateUnpooled, returning it to its pool if it has one.
+		/// </summary>
+		/// <param name="object">Address returned by Allocate or AllocateUnpooled. Null is ignored.</param>
+		static void Deallocate(void* object);
+
+	private:
+		/// <summary>
+		/// Core - The pool's blocks, free list and counters. Kept apart from the pool so it can outlive it.
+		/// </summary>
+		struct Core;
+
+		/// <summary>
+		/// Creates the Core on first use.
+		/// </summary>
+		Core& GetCore();
+
+		/// <summary>
+		/// Reads one of the Core's counters under its lock, 0 before the pool first allocates.
+		/// </summary>
+		std::size_t Read(std::size_t Core::* counter) const;
+
+		/// <summary>
+		/// Blocks, free list and counters. Null until the pool first allocates.
+		/// </summary>
+		std::atomic<Core*> _core{ nullptr };
+
+		/// <summary>
+		/// Size of the objects kept in the pool.
+		/// </summary>
+		std::size_t _objectSize;
+
+		/// <summary>
+		/// Number of slots allocated each time the pool grows.
+		/// </summary>
+		std::size_t _blockCount;
+	};
+}
+
+#include "ObjectPool.inl"
@@ -0,0 +1,64 @@
+#include "ObjectPool.h"
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline T* ObjectPool::Create()
+	{
+		if constexpr (IsPoolAllocated<T>::value)
+		{
+			assert(sizeof(T) <= _objectSize);
+			return new (*this) T();
+		}
+		else
+		{
+			return new T();
+		}
+	}
+
+	template <typename T, typename TContainer>
+	inline void ObjectPool::Create(std::size_t count, TContainer& products)
+	{
+		if constexpr (IsPoolAllocated<T>::value)
+		{
+			assert(sizeof(T) <= _objectSize);
+			char* slot = static_cast<char*>(AllocateContiguous(count));
+			const std::size_t stride = Stride();
+
+			std::size_t i = 0;
+			T* product = nullptr;
+			try
+			{
+				for (; i < count; ++i, slot += stride)
+				{
+					product = ::new (slot) T();
+					products.PushBack(product);
+					product = nullptr;
+				}
+			}
+			catch (...)
+			{
+				//	A product that was built but not handed over is deleted, the slots never built on go back to the pool
+				if (product != nullptr)
+				{
+					delete product;
+					++i;
+					slot += stride;
+				}
+
+				for (; i < count; ++i, slot += stride)
+				{
+					Deallocate(slot);
+				}
+				throw;
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				products.PushBack(Create<T>());
+			}
+		}
+	}
+}
@@ -0,0 +1,442 @@
+#pragma once
+#include "pch.h"
+#include "DefaultEquality.h"
+#include "DefaultHash.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// OrderedMap Class - Insertion ordered map where every <TKey,TData> Pair lives in a dense array, indexed by insertion order.
+	/// The array is split into segments that double in size, so growing never moves an entry: references and pointers to entries stay valid until Clear().
+	/// Lookups scan the entries linearly while there are at most LinearScanThreshold of them; past that an open addressing index of 32 bit
+	/// entry numbers is built over the array. Entries are never removed individually.
+	/// </summary>
+	/// <typeparam name="TKey">The Key values that are being hashed into the map. These are unique - inserting an existing key returns the existing entry.</typeparam>
+	/// <typeparam name="TData">The Data associated with the unique key values.</typeparam>
+	/// <typeparam name="HashFunctor">A Function Object that is used to hash TKey. See DefaultHash.inl for the default implementation.</typeparam>
+	/// <typeparam name="EqualityFunctor">A Function Object that is used to test TKey equality. See DefaultEquality.inl for the default implementation.</typeparam>
+	template <typename TKey, typename TData, typename HashFunctor = DefaultHash<TKey>, typename EqualityFunctor = DefaultEquality<TKey>>
+	class OrderedMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using value_type = PairType;
+		using mapped_type = TData;
+
+		/// <summary>
+		/// Number of entries that are found by scanning the array, before an index is built.
+		/// </summary>
+		inline static const size_t LinearScanThreshold = 8;
+
+		/// <summary>
+		/// Capacity of the first segment. Segment n holds FirstSegmentCapacity * 2^n entries.
+		/// </summary>
+		inline static const size_t FirstSegmentCapacity = 4;
+
+		/// <summary>
+		/// Forward Iterator Class for OrderedMap. Visits entries in insertion order.
+		/// </summary>
+		class Iterator final
+		{
+			friend OrderedMap;
+			friend class ConstIterator;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = PairType;
+			using reference = PairType&;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Defaulted Iterator Constructor
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Compares two Iterators for ! equality.
+			/// </summary>
+			/// <param name="other">Other Iterator to be compared</param>
+			/// <returns>True if any members are different. Elsewise false.</returns>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// Compares two Iterators for equality.
+			/// </summary>
+			/// <param name="other">Other Iterator to be compared</param>
+			/// <returns>True if all members are equivilant. Elsewise false.</returns>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// Increments the iterator to the next entry in insertion order.
+			/// </summary>
+			/// <returns>Iterator pointing to the next element, or end() if no elements left in the Map.</returns>
+			/// <exception cref="std::runtime_error">Calling operator++ on an unassociated iterator will throw a runtime error.</exception>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator to the next entry in insertion order, returning the unincremented Iterator.
+			/// </summary>
+			/// <returns>Copy of the original Iterator.</returns>
+			/// <exception cref="std::runtime_error">Calling operator++ on an unassociated iterator will throw a runtime error.</exception>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator - returns the pair that the iterator is pointing to.
+			/// </summary>
+			/// <returns>Reference to the pair.</returns>
+			/// <exception cref="std::runtime_error">Dereferencing an unassociated or end() iterator will throw a runtime error.</exception>
+			PairType& operator*() const;
+
+			/// <summary>
+			/// Arrow operator - returns the address of the pair that the iterator is pointing to.
+			/// </summary>
+			/// <returns>Address of the pair.</returns>
+			/// <exception cref="std::runtime_error">Dereferencing an unassociated or end() iterator will throw a runtime error.</exception>
+			PairType* operator->() const;
+
+			/// <summary>
+			/// Index - Returns the insertion index of the entry the iterator is pointing to.
+			/// </summary>
+			/// <returns>Position of the entry in insertion order.</returns>
+			size_t Index() const;
+
+		private:
+			/// <summary>
+			/// Private Iterator constructor used within the class to instantiate Iterators.
+			/// </summary>
+			/// <param name="owner">Reference to the OrderedMap that owns the Iterator</param>
+			/// <param name="index">Insertion index of the entry.</param>
+			Iterator(OrderedMap& owner, size_t index);
+
+			/// <summary>
+			/// Address of the owning container.
+			/// </summary>
+			OrderedMap* _owner = nullptr;
+
+			/// <summary>
+			/// Insertion index of the entry.
+			/// </summary>
+			size_t _index = 0;
+		};
+
+		/// <summary>
+		/// Constant Forward Iterator Class for OrderedMap. Visits entries in insertion order.
+		/// </summary>
+		class ConstIterator final
+		{
+			friend OrderedMap;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = PairType;
+			using reference = const PairType&;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Defaulted ConstIterator Constructor
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// Type cast constructor - Creates a ConstIterator from an Iterator.
+			/// </summary>
+			/// <param name="other">Iterator to convert.</param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// Compares two ConstIterators for ! equality.
+			/// </summary>
+			bool operator!=(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Compares two ConstIterators for equality.
+			/// </summary>
+			bool operator==(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Increments the iterator to the next entry in insertion order.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Calling operator++ on an unassociated iterator will throw a runtime error.</exception>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator to the next entry in insertion order, returning the unincremented ConstIterator.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Calling operator++ on an unassociated iterator will throw a runtime error.</exception>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator - returns the pair that the iterator is pointing to.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Dereferencing an unassociated or end() iterator will throw a runtime error.</exception>
+			const PairType& operator*() const;
+
+			/// <summary>
+			/// Arrow operator - returns the address of the pair that the iterator is pointing to.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Dereferencing an unassociated or end() iterator will throw a runtime error.</exception>
+			const PairType* operator->() const;
+
+			/// <summary>
+			/// Index - Returns the insertion index of the entry the iterator is pointing to.
+			/// </summary>
+			size_t Index() const;
+
+		private:
+			/// <summary>
+			/// Private ConstIterator constructor used within the class to instantiate ConstIterators.
+			/// </summary>
+			ConstIterator(const OrderedMap& owner, size_t index);
+
+			/// <summary>
+			/// Address of the owning container.
+			/// </summary>
+			const OrderedMap* _owner = nullptr;
+
+			/// <summary>
+			/// Insertion index of the entry.
+			/// </summary>
+			size_t _index = 0;
+		};
+
+		/// <summary>
+		/// InsertReturnPair - Iterator to the entry with the key, and whether it was inserted (true) or already present (false).
+		/// </summary>
+		using InsertReturnPair = std::pair<Iterator, bool>;
+
+#pragma region OrderedMap Rule Of 6
+
+		/// <summary>
+		/// Constructor - Creates an empty map. Allocates nothing until the first insertion.
+		/// </summary>
+		OrderedMap() = default;
+
+		/// <summary>
+		/// Copy Constructor - Copies every entry, in order.
+		/// </summary>
+		/// <param name="other">Reference to the OrderedMap being copied.</param>
+		OrderedMap(const OrderedMap& other);
+
+		/// <summary>
+		/// Move Constructor - Takes the other map's storage. Entries keep their addresses.
+		/// </summary>
+		/// <param name="other">R-Value Reference to the OrderedMap being moved.</param>
+		OrderedMap(OrderedMap&& other) noexcept;
+
+		/// <summary>
+		/// Copy Assignment - Clears this map and copies every entry, in order.
+		/// </summary>
+		/// <param name="other">Reference to the OrderedMap being copied.</param>
+		/// <returns>Reference to this map.</returns>
+		OrderedMap& operator=(const OrderedMap& other);
+
+		/// <summary>
+		/// Move Assignment - Clears this map and takes the other map's storage. Entries keep their addresses.
+		/// </summary>
+		/// <param name="other">R-Value Reference to the OrderedMap being moved.</param>
+		/// <returns>Reference to this map.</returns>
+		OrderedMap& operator=(OrderedMap&& other) noexcept;
+
+		/// <summary>
+		/// Destructor - Destroys every entry and releases all storage.
+		/// </summary>
+		~OrderedMap();
+
+#pragma endregion
+
+		/// <summary>
+		/// Insert - Appends the pair at the end of the insertion order, unless its key is already present.
+		/// </summary>
+		/// <param name="value">The pair to insert.</param>
+		/// <returns>Iterator to the entry with the key, and true if it was inserted.</returns>
+		InsertReturnPair Insert(const PairType& value);
+
+		/// <summary>
+		/// Insert - Appends the pair at the end of the insertion order, unless its key is already present.
+		/// </summary>
+		/// <param name="value">The pair to insert.</param>
+		/// <returns>Iterator to the entry with the key, and true if it was inserted.</returns>
+		InsertReturnPair Insert(PairType&& value);
+
+		/// <summary>
+		/// Find - Returns an iterator to the entry with the given key.
+		/// </summary>
+		/// <param name="key">The key to look for.</param>
+		/// <returns>Iterator to the entry, end() if the key is not present.</returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Find - Returns an iterator to the entry with the given key. Const version.
+		/// </summary>
+		/// <param name="key">The key to look for.</param>
+		/// <returns>ConstIterator to the entry, end() if the key is not present.</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// ContainsKey - Returns whether the key is present.
+		/// </summary>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// At - Returns the entry at the given insertion index.
+		/// </summary>
+		/// <param name="index">Insertion index of the entry.</param>
+		/// <returns>Reference to the pair.</returns>
+		/// <exception cref="std::runtime_error">Throws if index >= Size().</exception>
+		PairType& At(size_t index);
+
+		/// <summary>
+		/// At - Returns the entry at the given insertion index. Const version.
+		/// </summary>
+		/// <param name="index">Insertion index of the entry.</param>
+		/// <returns>Constant reference to the pair.</returns>
+		/// <exception cref="std::runtime_error">Throws if index >= Size().</exception>
+		const PairType& At(size_t index) const;
+
+		/// <summary>
+		/// Reserve - Allocates segments until at least capacity entries fit, and sizes the index for them if they will need one.
+		/// </summary>
+		/// <param name="capacity">The number of entries to make room for.</param>
+		void Reserve(size_t capacity);
+
+		/// <summary>
+		/// Clear - Destroys every entry and releases all storage.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Size - Returns the number of entries.
+		/// </summary>
+		size_t Size() const;
+
+		/// <summary>
+		/// IsEmpty - Returns whether there are no entries.
+		/// </summary>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Capacity - Returns the number of entries that fit in the allocated segments.
+		/// </summary>
+		size_t Capacity() const;
+
+		/// <summary>
+		/// IsIndexed - Returns whether lookups go through the hash index rather than a linear scan.
+		/// </summary>
+		bool IsIndexed() const;
+
+		/// <summary>
+		/// begin - Returns an iterator to the first inserted entry.
+		/// </summary>
+		Iterator begin();
+
+		/// <summary>
+		/// begin - Returns a const iterator to the first inserted entry.
+		/// </summary>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// cbegin - Returns a const iterator to the first inserted entry.
+		/// </summary>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// end - Returns an iterator one past the last inserted entry.
+		/// </summary>
+		Iterator end();
+
+		/// <summary>
+		/// end - Returns a const iterator one past the last inserted entry.
+		/// </summary>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// cend - Returns a const iterator one past the last inserted entry.
+		/// </summary>
+		ConstIterator cend() const;
+
+	private:
+
+		/// <summary>
+		/// Slot value of an unused index slot. Used slots hold the entry index + 1.
+		/// </summary>
+		inline static const uint32_t EmptySlot = 0;
+
+		/// <summary>
+		/// SegmentOf - Returns the segment holding the entry at index, and sets offset to its position within that segment.
+		/// </summary>
+		static size_t SegmentOf(size_t index, size_t& offset);
+
+		/// <summary>
+		/// SegmentCapacity - Returns the number of entries segment holds.
+		/// </summary>
+		static size_t SegmentCapacity(size_t segment);
+
+		/// <summary>
+		/// EntryAt - Returns the address of the entry at index, without bounds checking.
+		/// </summary>
+		PairType* EntryAt(size_t index) const;
+
+		/// <summary>
+		/// FindIndex - Returns the insertion index of key, Size() if it is not present.
+		/// </summary>
+		size_t FindIndex(const TKey& key, size_t hash) const;
+
+		/// <summary>
+		/// Emplace - Shared body of the Insert overloads.
+		/// </summary>
+		template <typename Pair>
+		InsertReturnPair Emplace(Pair&& value);
+
+		/// <summary>
+		/// SlotOf - Maps a hash to its home slot in the index.
+		/// </summary>
+		size_t SlotOf(size_t hash) const;
+
+		/// <summary>
+		/// AddToIndex - Records the entry at index in the index, which must have a free slot.
+		/// </summary>
+		void AddToIndex(size_t index, size_t hash);
+
+		/// <summary>
+		/// Rehash - Replaces the index with one of 2^slotBits slots holding every entry.
+		/// </summary>
+		void Rehash(size_t slotBits);
+
+		/// <summary>
+		/// IndexBitsFor - Returns the number of slot bits that keeps count entries at or below half load.
+		/// </summary>
+		static size_t IndexBitsFor(size_t count);
+
+		/// <summary>
+		/// CopyFrom - Copies other's entries into this empty map in one pass, along with a verbatim copy of its index.
+		/// If a copy throws, the entries copied so far are destroyed and the map is left empty, holding no memory.
+		/// </summary>
+		/// <param name="other">The map to copy.</param>
+		void CopyFrom(const OrderedMap& other);
+
+		/// <summary>
+		/// Segment base addresses. Segment n holds FirstSegmentCapacity * 2^n entries.
+		/// </summary>
+		Vector<PairType*> _segments;
+
+		/// <summary>
+		/// Number of entries.
+		/// </summary>
+		size_t _size = 0;
+
+		/// <summary>
+		/// Open addressing index of 2^_slotBits slots, each holding an entry index + 1 or EmptySlot. nullptr while unindexed.
+		/// </summary>
+		uint32_t* _slots = nullptr;
+
+		/// <summary>
+		/// log2 of the number of slots in _slots.
+		/// </summary>
+		size_t _slotBits = 0;
+	};
+}
+
+#include "OrderedMap.inl"
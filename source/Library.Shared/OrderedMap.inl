@@ -0,0 +1,572 @@
+#include "OrderedMap.h"
+#include <bit>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+namespace FieaGameEngine
+{
+#pragma region Iterator
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::Iterator(OrderedMap& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::operator!=(const Iterator& other) const
+	{
+		return !(operator==(other));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::operator==(const Iterator& other) const
+	{
+		return _owner == other._owner && _index == other._index;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Attempting to increment an unassociated iterator. OrderedMap::Iterator::operator++()");
+		}
+
+		if (_index < _owner->_size)
+		{
+			++_index;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		operator++();
+		return temp;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::operator*() const
+	{
+		if (_owner == nullptr || _index >= _owner->_size)
+		{
+			throw std::runtime_error("Attempting to dereference an unassociated or end iterator. OrderedMap::Iterator::operator*()");
+		}
+
+		return *_owner->EntryAt(_index);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType* OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator::Index() const
+	{
+		return _index;
+	}
+
+#pragma endregion
+
+#pragma region ConstIterator
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::ConstIterator(const OrderedMap& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::ConstIterator(const Iterator& other) :
+		_owner(other._owner), _index(other._index)
+	{
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return !(operator==(other));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return _owner == other._owner && _index == other._index;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Attempting to increment an unassociated iterator. OrderedMap::ConstIterator::operator++()");
+		}
+
+		if (_index < _owner->_size)
+		{
+			++_index;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp = *this;
+		operator++();
+		return temp;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline const typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::operator*() const
+	{
+		if (_owner == nullptr || _index >= _owner->_size)
+		{
+			throw std::runtime_error("Attempting to dereference an unassociated or end iterator. OrderedMap::ConstIterator::operator*()");
+		}
+
+		return *_owner->EntryAt(_index);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline const typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType* OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator::Index() const
+	{
+		return _index;
+	}
+
+#pragma endregion
+
+#pragma region OrderedMap Rule Of 6
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::OrderedMap(const OrderedMap& other)
+	{
+		CopyFrom(other);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::OrderedMap(OrderedMap&& other) noexcept :
+		_segments(std::move(other._segments)), _size(other._size), _slots(other._slots), _slotBits(other._slotBits)
+	{
+		other._size = 0;
+		other._slots = nullptr;
+		other._slotBits = 0;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::operator=(const OrderedMap& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			CopyFrom(other);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::operator=(OrderedMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+
+			_segments = std::move(other._segments);
+			_size = other._size;
+			_slots = other._slots;
+			_slotBits = other._slotBits;
+
+			other._size = 0;
+			other._slots = nullptr;
+			other._slotBits = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::~OrderedMap()
+	{
+		Clear();
+	}
+
+#pragma endregion
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::InsertReturnPair OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Insert(const PairType& value)
+	{
+		return Emplace(value);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::InsertReturnPair OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Insert(PairType&& value)
+	{
+		return Emplace(std::move(value));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	template<typename Pair>
+	typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::InsertReturnPair OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Emplace(Pair&& value)
+	{
+		//	Small maps never hash - the hash is only computed once there is an index to use it with.
+		size_t hash = (_slots != nullptr) ? HashFunctor()(value.first) : 0;
+		size_t index = FindIndex(value.first, hash);
+		if (index < _size)
+		{
+			return InsertReturnPair(Iterator(*this, index), false);
+		}
+
+		if (_size == static_cast<size_t>(std::numeric_limits<uint32_t>::max() - 1))
+		{
+			throw std::runtime_error("OrderedMap can't hold more entries than fit in its 32 bit index.");
+		}
+
+		if (_size == Capacity())
+		{
+			size_t capacity = SegmentCapacity(_segments.Size());
+			PairType* segment = static_cast<PairType*>(malloc(sizeof(PairType) * capacity));
+			if (segment == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			_segments.PushBack(segment);
+		}
+
+		//	The index grows before the entry is added, so running out of memory for it leaves the map as it was.
+		if (_slots != nullptr)
+		{
+			//	Keep the index at most half full so probe sequences stay short.
+			if ((_size + 1) * 2 > (1_z << _slotBits))
+			{
+				Rehash(_slotBits + 1);
+			}
+		}
+		else if (_size + 1 > LinearScanThreshold)
+		{
+			Rehash(IndexBitsFor(_size + 1));
+			hash = HashFunctor()(value.first);
+		}
+
+		new(EntryAt(_size))PairType(std::forward<Pair>(value));
+		++_size;
+
+		if (_slots != nullptr)
+		{
+			AddToIndex(_size - 1, hash);
+		}
+
+		return InsertReturnPair(Iterator(*this, _size - 1), true);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Find(const TKey& key)
+	{
+		size_t hash = (_slots != nullptr) ? HashFunctor()(key) : 0;
+		return Iterator(*this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Find(const TKey& key) const
+	{
+		size_t hash = (_slots != nullptr) ? HashFunctor()(key) : 0;
+		return ConstIterator(*this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ContainsKey(const TKey& key) const
+	{
+		return Find(key) != end();
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::At(size_t index)
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Attempting to access an index greater than size. OrderedMap::At()");
+		}
+
+		return *EntryAt(index);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline const typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType& OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::At(size_t index) const
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Attempting to access an index greater than size. OrderedMap::At()");
+		}
+
+		return *EntryAt(index);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	void OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Reserve(size_t capacity)
+	{
+		while (Capacity() < capacity)
+		{
+			size_t segmentCapacity = SegmentCapacity(_segments.Size());
+			PairType* segment = static_cast<PairType*>(malloc(sizeof(PairType) * segmentCapacity));
+			if (segment == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			_segments.PushBack(segment);
+		}
+
+		if (capacity > LinearScanThreshold && IndexBitsFor(capacity) > _slotBits)
+		{
+			Rehash(IndexBitsFor(capacity));
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	void OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Clear()
+	{
+		for (size_t i = 0; i < _size; ++i)
+		{
+			EntryAt(i)->~PairType();
+		}
+		_size = 0;
+
+		for (size_t i = 0; i < _segments.Size(); ++i)
+		{
+			free(_segments[i]);
+		}
+		_segments.Clear();
+		_segments.ShrinkToFit();
+
+		free(_slots);
+		_slots = nullptr;
+		_slotBits = 0;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::IsEmpty() const
+	{
+		return _size == 0;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Capacity() const
+	{
+		//	Segments 0..n-1 hold FirstSegmentCapacity * (2^n - 1) entries between them.
+		return FirstSegmentCapacity * ((1_z << _segments.Size()) - 1);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline bool OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::IsIndexed() const
+	{
+		return _slots != nullptr;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::begin()
+	{
+		return Iterator(*this, 0);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::begin() const
+	{
+		return ConstIterator(*this, 0);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::cbegin() const
+	{
+		return ConstIterator(*this, 0);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Iterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::end()
+	{
+		return Iterator(*this, _size);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::end() const
+	{
+		return ConstIterator(*this, _size);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::ConstIterator OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::cend() const
+	{
+		return ConstIterator(*this, _size);
+	}
+
+#pragma region Private Helpers
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::SegmentOf(size_t index, size_t& offset)
+	{
+		//	Segment n starts at FirstSegmentCapacity * (2^n - 1), so n is the position of the top bit of index / FirstSegmentCapacity + 1.
+		size_t segment = static_cast<size_t>(std::bit_width(index / FirstSegmentCapacity + 1)) - 1;
+		offset = index - FirstSegmentCapacity * ((1_z << segment) - 1);
+		return segment;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::SegmentCapacity(size_t segment)
+	{
+		return FirstSegmentCapacity << segment;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline typename OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::PairType* OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::EntryAt(size_t index) const
+	{
+		size_t offset;
+		size_t segment = SegmentOf(index, offset);
+		return _segments[segment] + offset;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::FindIndex(const TKey& key, size_t hash) const
+	{
+		EqualityFunctor equal;
+
+		if (_slots == nullptr)
+		{
+			for (size_t i = 0; i < _size; ++i)
+			{
+				if (equal(EntryAt(i)->first, key))
+				{
+					return i;
+				}
+			}
+			return _size;
+		}
+
+		const size_t mask = (1_z << _slotBits) - 1;
+		for (size_t slot = SlotOf(hash); _slots[slot] != EmptySlot; slot = (slot + 1) & mask)
+		{
+			size_t index = _slots[slot] - 1;
+			if (equal(EntryAt(index)->first, key))
+			{
+				return index;
+			}
+		}
+
+		return _size;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::SlotOf(size_t hash) const
+	{
+		//	Fibonacci hashing - spreads weak hashes (such as AdditiveHash) over the whole table before taking the top bits.
+		return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> (64 - _slotBits));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline void OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::AddToIndex(size_t index, size_t hash)
+	{
+		const size_t mask = (1_z << _slotBits) - 1;
+		size_t slot = SlotOf(hash);
+		while (_slots[slot] != EmptySlot)
+		{
+			slot = (slot + 1) & mask;
+		}
+		_slots[slot] = static_cast<uint32_t>(index + 1);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	void OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::Rehash(size_t slotBits)
+	{
+		uint32_t* slots = static_cast<uint32_t*>(calloc(1_z << slotBits, sizeof(uint32_t)));
+		if (slots == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		free(_slots);
+		_slots = slots;
+		_slotBits = slotBits;
+
+		HashFunctor hash;
+		for (size_t i = 0; i < _size; ++i)
+		{
+			AddToIndex(i, hash(EntryAt(i)->first));
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	void OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::CopyFrom(const OrderedMap& other)
+	{
+		assert(_size == 0 && _slots == nullptr);
+
+		//	_size only counts entries that were built, so on a throw Clear() destroys exactly those and frees the segments
+		try
+		{
+			while (Capacity() < other._size)
+			{
+				//	The slot is pushed before the malloc, so a segment is never held only by a local
+				_segments.PushBack(nullptr);
+				_segments.Back() = static_cast<PairType*>(malloc(sizeof(PairType) * SegmentCapacity(_segments.Size() - 1)));
+				if (_segments.Back() == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+			}
+
+			//	Keys are already unique, so entries are copied without lookups
+			for (size_t i = 0; i < other._size; ++i)
+			{
+				new(EntryAt(i))PairType(*other.EntryAt(i));
+				++_size;
+			}
+
+			//	The same keys at the same indices hash to the same slots - the index is copied rather than rebuilt
+			if (other._slots != nullptr)
+			{
+				size_t slotCount = 1_z << other._slotBits;
+				_slots = static_cast<uint32_t*>(malloc(slotCount * sizeof(uint32_t)));
+				if (_slots == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+				memcpy(_slots, other._slots, slotCount * sizeof(uint32_t));
+				_slotBits = other._slotBits;
+			}
+		}
+		catch (...)
+		{
+			Clear();
+			throw;
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor, typename EqualityFunctor>
+	inline size_t OrderedMap<TKey, TData, HashFunctor, EqualityFunctor>::IndexBitsFor(size_t count)
+	{
+		size_t bits = 4;
+		while ((1_z << bits) < count * 2)
+		{
+			++bits;
+		}
+		return bits;
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "PrefabRegistry.h"
+#include "ScopeTraversal.h"
+
+namespace FieaGameEngine
+{
+	const Scope& PrefabRegistry::Register(const string& name, gsl::owner<Scope*> prototype)
+	{
+		if (prototype == nullptr || prototype->GetParent() != nullptr)
+		{
+			throw runtime_error("Prefab prototypes must be root Scopes. PrefabRegistry::Register()");
+		}
+
+		if (_prefabs.ContainsKey(name))
+		{
+			throw runtime_error("A prefab is already registered under this name. PrefabRegistry::Register()");
+		}
+
+		ScopeTraversal::ForEachScope(*prototype, [](Scope& scope, size_t)
+		{
+			scope._isPrototype = true;
+		});
+
+		_prefabs.Insert(make_pair(name, prototype));
+		return *prototype;
+	}
+
+	bool PrefabRegistry::Unregister(const string& name)
+	{
+		auto it = _prefabs.Find(name);
+		if (it == _prefabs.end())
+		{
+			return false;
+		}
+
+		delete it->second;
+		_prefabs.Remove(name);
+		return true;
+	}
+
+	const Scope* PrefabRegistry::Find(const string& name)
+	{
+		auto it = _prefabs.Find(name);
+		return it != _prefabs.end() ? it->second : nullptr;
+	}
+
+	gsl::owner<Scope*> PrefabRegistry::Instantiate(const string& name)
+	{
+		const Scope* prototype = Find(name);
+		if (prototype == nullptr)
+		{
+			throw runtime_error("No prefab is registered under this name. PrefabRegistry::Instantiate()");
+		}
+
+		//	Clone() keeps the prototype's most derived type; its copy constructor shares every Datum it can
+		return prototype->Clone();
+	}
+
+	void PrefabRegistry::Clear()
+	{
+		for (auto& [name, prototype] : _prefabs)
+		{
+			delete prototype;
+		}
+
+		_prefabs.Clear();
+	}
+
+	size_t PrefabRegistry::Size()
+	{
+		return _prefabs.Size();
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "Scope.h"
+#include "HashMap.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Singleton PrefabRegistry class - Owns named prototype Scopes (prefabs) and spawns instances of them.
+	/// Instances are ordinary Scopes of the prototype's type, but their Datums start out as copy on write views of the prototype's data,
+	/// so spawning costs the tables and nested Scopes only. An instance copies a Datum into its own storage the first time it is written.
+	/// Prototypes are read only once registered, and must outlive every instance spawned from them - Unregister() and Clear() are for teardown.
+	/// </summary>
+	class PrefabRegistry final
+	{
+	public:
+		/// <summary>
+		/// Constructor - deleted to prevent instantiation.
+		/// </summary>
+		PrefabRegistry() = delete;
+
+		/// <summary>
+		/// Copy constructor - deleted to prevent instantiation.
+		/// </summary>
+		PrefabRegistry(const PrefabRegistry& other) = delete;
+
+		/// <summary>
+		/// Move constructor - deleted to prevent instantiation.
+		/// </summary>
+		PrefabRegistry(PrefabRegistry&& other) = delete;
+
+		/// <summary>
+		/// Copy Assignment operator - deleted to prevent instantiation.
+		/// </summary>
+		PrefabRegistry& operator=(const PrefabRegistry& other) = delete;
+
+		/// <summary>
+		/// Move Assignment operator - deleted to prevent instantiation.
+		/// </summary>
+		PrefabRegistry& operator=(PrefabRegistry&& other) = delete;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~PrefabRegistry() = default;
+
+		/// <summary>
+		/// Register - Takes ownership of a root Scope (typically freshly parsed) and registers it as the prototype for the given name.
+		/// Marks every Scope in the prototype's tree read only.
+		/// </summary>
+		/// <param name="name">Name instances are spawned by, and the value of a "prefab" key in Json.</param>
+		/// <param name="prototype">Heap allocated root Scope to take ownership of.</param>
+		/// <returns>Reference to the registered prototype.</returns>
+		/// <exception cref="std::runtime_error">Throws if the name is already registered, or the prototype is nested in another Scope.</exception>
+		static const Scope& Register(const string& name, gsl::owner<Scope*> prototype);
+
+		/// <summary>
+		/// Unregister - Removes and deletes the prototype registered under name. No instance of it may still be alive.
+		/// </summary>
+		/// <param name="name">Name of the prefab to remove.</param>
+		/// <returns>True if a prefab was removed.</returns>
+		static bool Unregister(const string& name);
+
+		/// <summary>
+		/// Find - Returns the prototype registered under name.
+		/// </summary>
+		/// <param name="name">Name of the prefab.</param>
+		/// <returns>Address of the prototype, nullptr if there isn't one.</returns>
+		static const Scope* Find(const string& name);
+
+		/// <summary>
+		/// Instantiate - Spawns a new root instance of the named prefab. The caller owns the result.
+		/// </summary>
+		/// <param name="name">Name of the prefab.</param>
+		/// <returns>Heap allocated instance, of the same type as the prototype.</returns>
+		/// <exception cref="std::runtime_error">Throws if no prefab is registered under name.</exception>
+		static gsl::owner<Scope*> Instantiate(const string& name);
+
+		/// <summary>
+		/// Clear - Deletes every registered prototype.
+		/// </summary>
+		static void Clear();
+
+		/// <summary>
+		/// Size - Returns the number of registered prefabs.
+		/// </summary>
+		/// <returns>The number of registered prefabs.</returns>
+		static size_t Size();
+
+	private:
+
+		/// <summary>
+		/// A Hashmap storing (name, owned prototype) pairs.
+		/// </summary>
+		static inline HashMap<string, Scope*> _prefabs;
+	};
+}
@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "RTTI.h"
+
+namespace FieaGameEngine
+{
+	std::atomic<const TypeInfo*> TypeInfo::_head{ nullptr };
+
+	TypeInfo::TypeInfo(std::string_view name, const TypeInfo* parent) :
+		_name(name), _nameHash(AdditiveHash(name)), _depth(parent == nullptr ? 0 : parent->_depth + 1)
+	{
+		if (_depth >= MaxDepth)
+		{
+			throw std::runtime_error("Type hierarchy is deeper than TypeInfo::MaxDepth. TypeInfo::TypeInfo()");
+		}
+
+		for (std::size_t i = 0; i < _depth; ++i)
+		{
+			_ancestors[i] = parent->_ancestors[i];
+		}
+		_ancestors[_depth] = this;
+
+		//	Types may be created concurrently by the first callers of their TypeInfoClass()
+		const TypeInfo* head = _head.load(std::memory_order_relaxed);
+		do
+		{
+			_next = head;
+		} while (!_head.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	bool TypeInfo::IsA(std::string_view name) const
+	{
+		const std::size_t nameHash = AdditiveHash(name);
+
+		for (std::size_t i = _depth + 1; i-- > 0;)
+		{
+			const TypeInfo& type = *_ancestors[i];
+			if (type._nameHash == nameHash && type._name == name)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool TypeInfo::IsA(IdType id) const
+	{
+		for (std::size_t i = _depth + 1; i-- > 0;)
+		{
+			if (_ancestors[i]->Id() == id)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	const TypeInfo* TypeInfo::Find(std::string_view name)
+	{
+		const std::size_t nameHash = AdditiveHash(name);
+
+		for (const TypeInfo* type = _head.load(std::memory_order_acquire); type != nullptr; type = type->_next)
+		{
+			if (type->_nameHash == nameHash && type->_name == name)
+			{
+				return type;
+			}
+		}
+
+		return nullptr;
+	}
+}
@@ -1,45 +1,190 @@
 #pragma once
 #include "pch.h"
 #include <string>
+#include <string_view>
 #include <cstddef>
+#include <atomic>
+#include "DefaultHash.h"
 
 namespace FieaGameEngine
 {
-	class RTTI
+	/// <summary>
+	/// TypeInfo Class - One per RTTI type, created the first time the type's TypeInfoClass() is called. Stores the type's depth in the hierarchy
+	/// and the full chain of its ancestors indexed by depth, so "is this type derived from that one" is a single array compare instead of a
+	/// virtual walk up the parents. Names are hashed once here, so name checks compare integers and only compare characters on a hash match.
+	/// </summary>
+	class TypeInfo final
 	{
 	public:
 		using IdType = std::size_t;
-		static IdType TypeIdClass() { return 0; }
+
+		/// <summary>
+		/// Deepest supported inheritance chain, counting RTTI itself.
+		/// </summary>
+		static constexpr std::size_t MaxDepth = 16;
+
+		/// <summary>
+		/// Constructor - Describes a type and links it into the list of known types.
+		/// </summary>
+		/// <param name="name">Name of the type. Must have static storage duration - the macros pass a string literal.</param>
+		/// <param name="parent">TypeInfo of the parent type, nullptr for the root.</param>
+		/// <exception cref="std::runtime_error">Throws if the hierarchy is deeper than MaxDepth.</exception>
+		TypeInfo(std::string_view name, const TypeInfo* parent);
+
+		TypeInfo(const TypeInfo&) = delete;
+		TypeInfo(TypeInfo&&) = delete;
+		TypeInfo& operator=(const TypeInfo&) = delete;
+		TypeInfo& operator=(TypeInfo&&) = delete;
+		~TypeInfo() = default;
+
+		/// <summary>
+		/// Id - Returns the type's id. Ids are the address of the type's TypeInfo, so they are unique and map straight back to it.
+		/// </summary>
+		IdType Id() const { return reinterpret_cast<IdType>(this); }
+
+		/// <summary>
+		/// Name - Returns the type's name.
+		/// </summary>
+		std::string_view Name() const { return _name; }
+
+		/// <summary>
+		/// NameHash - Returns the hash of the type's name.
+		/// </summary>
+		std::size_t NameHash() const { return _nameHash; }
+
+		/// <summary>
+		/// Depth - Returns the number of ancestors between the type and the root.
+		/// </summary>
+		std::size_t Depth() const { return _depth; }
+
+		/// <summary>
+		/// Parent - Returns the TypeInfo of the parent type, nullptr for the root.
+		/// </summary>
+		const TypeInfo* Parent() const { return _depth == 0 ? nullptr : _ancestors[_depth - 1]; }
+
+		/// <summary>
+		/// IsA - Checks if this type is other or derives from it. A single compare, as the ancestor slots past this type's depth are null.
+		/// </summary>
+		/// <param name="other">Type to check against.</param>
+		/// <returns>True if other is this type or one of its ancestors.</returns>
+		bool IsA(const TypeInfo& other) const { return _ancestors[other._depth] == &other; }
+
+		/// <summary>
+		/// IsA - Checks if this type, or one of its ancestors, is named name.
+		/// </summary>
+		/// <param name="name">Type name to check against.</param>
+		/// <returns>True if the name belongs to this type or one of its ancestors.</returns>
+		bool IsA(std::string_view name) const;
+
+		/// <summary>
+		/// IsA - Checks if this type, or one of its ancestors, has the id id. Only this type's own ancestors are read, so any id,
+		/// including 0 or one no type was made from, is safe to pass.
+		/// </summary>
+		/// <param name="id">Type id to check against.</param>
+		/// <returns>True if id belongs to this type or one of its ancestors.</returns>
+		bool IsA(IdType id) const;
+
+		/// <summary>
+		/// FromId - Returns the TypeInfo a type id was made from.
+		/// </summary>
+		/// <param name="id">Id returned by a type's TypeIdClass(). Must not be 0.</param>
+		static const TypeInfo& FromId(IdType id) { return *reinterpret_cast<const TypeInfo*>(id); }
+
+		/// <summary>
+		/// Find - Looks a type up by name, so a name can be resolved once and checked with Is(IdType) afterwards.
+		/// Types with an RTTI_DEFINITIONS in a translation unit are known from static initialization, class templates once they are first used.
+		/// </summary>
+		/// <param name="name">Type name to look up.</param>
+		/// <returns>The type's TypeInfo, nullptr if no type of that name is known.</returns>
+		static const TypeInfo* Find(std::string_view name);
+
+	private:
+		/// <summary>
+		/// Name of the type.
+		/// </summary>
+		std::string_view _name;
+
+		/// <summary>
+		/// Hash of the name, same as AdditiveHash(_name).
+		/// </summary>
+		std::size_t _nameHash;
+
+		/// <summary>
+		/// Number of ancestors.
+		/// </summary>
+		std::size_t _depth;
+
+		/// <summary>
+		/// Ancestors by depth, the root first and this type at _depth. Entries past _depth are null.
+		/// </summary>
+		const TypeInfo* _ancestors[MaxDepth]{};
+
+		/// <summary>
+		/// Next known type, in reverse order of creation.
+		/// </summary>
+		const TypeInfo* _next = nullptr;
+
+		/// <summary>
+		/// Most recently created type. Constant initialized, so types can register during static initialization.
+		/// </summary>
+		static std::atomic<const TypeInfo*> _head;
+	};
+
+	class RTTI
+	{
+	public:
+		using IdType = TypeInfo::IdType;
+
+		static const TypeInfo& TypeInfoClass()
+		{
+			static const TypeInfo sTypeInfo("RTTI", nullptr);
+			return sTypeInfo;
+		}
+
+		static IdType TypeIdClass() { return TypeInfoClass().Id(); }
 
 		virtual ~RTTI() = default;
 
-		virtual FieaGameEngine::RTTI::IdType TypeIdInstance() const = 0;
+		/// <summary>
+		/// TypeInfoInstance - Returns the TypeInfo of the most derived type. The only virtual call behind the type queries below.
+		/// </summary>
+		virtual const TypeInfo& TypeInfoInstance() const = 0;
 
-		virtual RTTI* QueryInterface(const IdType)
+		IdType TypeIdInstance() const
 		{
-			return nullptr;
+			return TypeInfoInstance().Id();
 		}
 
-		virtual bool Is(IdType) const
+		std::string TypeNameInstance() const
 		{
-			return false;
+			return std::string(TypeInfoInstance().Name());
 		}
 
-		virtual bool Is(const std::string&) const
+		RTTI* QueryInterface(const IdType id)
 		{
-			return false;
+			return (Is(id) ? this : nullptr);
+		}
+
+		bool Is(IdType id) const
+		{
+			return TypeInfoInstance().IsA(id);
+		}
+
+		bool Is(std::string_view name) const
+		{
+			return TypeInfoInstance().IsA(name);
 		}
 
 		template <typename T>
 		const T* As() const
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<const T*>(this) : nullptr);
+			return (TypeInfoInstance().IsA(T::TypeInfoClass()) ? reinterpret_cast<const T*>(this) : nullptr);
 		}
 
 		template <typename T>
 		T* As()
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
+			return (TypeInfoInstance().IsA(T::TypeInfoClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
 		}
 
 		virtual std::string ToString() const
@@ -56,22 +201,15 @@ namespace FieaGameEngine
 #define RTTI_DECLARATIONS(Type, ParentType)																						\
 		public:																													\
 			static std::string TypeName() { return std::string(#Type); }														\
-			static FieaGameEngine::RTTI::IdType TypeIdClass() { return sRunTimeTypeId; }																\
-			FieaGameEngine::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }											\
-			FieaGameEngine::RTTI* QueryInterface(const RTTI::IdType id) override												\
-            {																													\
-				return (id == sRunTimeTypeId ? reinterpret_cast<FieaGameEngine::RTTI*>(this) : ParentType::QueryInterface(id)); \
-            }																													\
-			bool Is(FieaGameEngine::RTTI::IdType id) const override																			\
-			{																													\
-				return (id == sRunTimeTypeId ? true : ParentType::Is(id));														\
-			}																													\
-			bool Is(const std::string& name) const override																\
+			static const FieaGameEngine::TypeInfo& TypeInfoClass()																\
 			{																													\
-				return (name == TypeName() ? true : ParentType::Is(name));														\
+				static const FieaGameEngine::TypeInfo sTypeInfo(#Type, &ParentType::TypeInfoClass());							\
+				return sTypeInfo;																								\
 			}																													\
+			static FieaGameEngine::RTTI::IdType TypeIdClass() { return TypeInfoClass().Id(); }									\
+			const FieaGameEngine::TypeInfo& TypeInfoInstance() const override { return TypeInfoClass(); }						\
 			private:																											\
 				static const FieaGameEngine::RTTI::IdType sRunTimeTypeId;
 
-#define RTTI_DEFINITIONS(Type) const FieaGameEngine::RTTI::IdType Type::sRunTimeTypeId = reinterpret_cast<FieaGameEngine::RTTI::IdType>(&Type::sRunTimeTypeId);
-}
\ No newline at end of file
+#define RTTI_DEFINITIONS(Type) const FieaGameEngine::RTTI::IdType Type::sRunTimeTypeId = Type::TypeIdClass();
+}
@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "Rcu.h"
+
+namespace FieaGameEngine
+{
+	struct Rcu::Retired final
+	{
+		const void* _object;
+		void (*_destroy)(const void*);
+		std::uint64_t _epoch;
+		Retired* _next;
+	};
+
+	Rcu::ReaderSlot Rcu::_slots[Rcu::MaxThreads];
+	std::atomic<std::size_t> Rcu::_slotCount{ 0 };
+	std::atomic<std::uint64_t> Rcu::_epoch{ 1 };
+	Rcu::Retired* Rcu::_retired = nullptr;
+	std::mutex Rcu::_retiredMutex;
+	std::atomic<std::size_t> Rcu::_pendingCount{ 0 };
+	thread_local Rcu::ThreadState Rcu::_threadState;
+
+	Rcu::ReadGuard::ReadGuard()
+	{
+		ThreadState& state = _threadState;
+		if (state._depth == 0)
+		{
+			if (state._slot == nullptr)
+			{
+				state._slot = &ClaimSlot();
+			}
+
+			//	A stale epoch only makes this reader hold retired objects longer, never shorter
+			state._slot->_epoch.store(_epoch.load());
+		}
+		++state._depth;
+	}
+
+	Rcu::ReadGuard::~ReadGuard()
+	{
+		ThreadState& state = _threadState;
+		assert(state._depth > 0);
+		if (--state._depth == 0)
+		{
+			state._slot->_epoch.store(0, std::memory_order_release);
+
+			//	Readers never wait on a writer - if one is busy it reclaims on its own
+			if (_pendingCount.load(std::memory_order_relaxed) != 0)
+			{
+				std::unique_lock<std::mutex> lock(_retiredMutex, std::try_to_lock);
+				if (lock.owns_lock())
+				{
+					Retired* reclaimable = CollectReclaimable();
+					lock.unlock();
+					Destroy(reclaimable);
+				}
+			}
+		}
+	}
+
+	Rcu::ThreadState::~ThreadState()
+	{
+		if (_slot != nullptr)
+		{
+			_slot->_epoch.store(0, std::memory_order_release);
+			_slot->_isClaimed.store(false, std::memory_order_release);
+		}
+	}
+
+	void Rcu::Reclaim()
+	{
+		std::unique_lock<std::mutex> lock(_retiredMutex);
+		Retired* reclaimable = CollectReclaimable();
+		lock.unlock();
+		Destroy(reclaimable);
+	}
+
+	std::size_t Rcu::PendingCount()
+	{
+		return _pendingCount.load();
+	}
+
+	void Rcu::Retire(const void* object, void (*destroy)(const void*))
+	{
+		gsl::owner<Retired*> retired = new Retired{ object, destroy, 0, nullptr };
+
+		//	Readers entering from here on can't have seen the object, it was unpublished before the epoch moved
+		retired->_epoch = _epoch.fetch_add(1);
+
+		std::unique_lock<std::mutex> lock(_retiredMutex);
+		retired->_next = _retired;
+		_retired = retired;
+		_pendingCount.fetch_add(1);
+		Retired* reclaimable = CollectReclaimable();
+		lock.unlock();
+		Destroy(reclaimable);
+	}
+
+	Rcu::ReaderSlot& Rcu::ClaimSlot()
+	{
+		for (std::size_t i = 0; i < MaxThreads; ++i)
+		{
+			bool isClaimed = false;
+			if (_slots[i]._isClaimed.load(std::memory_order_relaxed) == false && _slots[i]._isClaimed.compare_exchange_strong(isClaimed, true))
+			{
+				std::size_t count = _slotCount.load();
+				while (count <= i && _slotCount.compare_exchange_weak(count, i + 1) == false)
+				{
+				}
+				return _slots[i];
+			}
+		}
+
+		throw std::runtime_error("More threads are reading than Rcu has slots for. Rcu::ReadGuard::ReadGuard()");
+	}
+
+	Rcu::Retired* Rcu::CollectReclaimable()
+	{
+		//	Everything retired before the oldest epoch a reader is still in is unreachable
+		std::uint64_t oldest = _epoch.load();
+		const std::size_t slotCount = _slotCount.load();
+		for (std::size_t i = 0; i < slotCount; ++i)
+		{
+			const std::uint64_t epoch = _slots[i]._epoch.load();
+			if (epoch != 0 && epoch < oldest)
+			{
+				oldest = epoch;
+			}
+		}
+
+		Retired* reclaimable = nullptr;
+		Retired** link = &_retired;
+		while (*link != nullptr)
+		{
+			Retired* retired = *link;
+			if (retired->_epoch < oldest)
+			{
+				*link = retired->_next;
+				retired->_next = reclaimable;
+				reclaimable = retired;
+				_pendingCount.fetch_sub(1);
+			}
+			else
+			{
+				link = &retired->_next;
+			}
+		}
+
+		return reclaimable;
+	}
+
+	void Rcu::Destroy(Retired* retired)
+	{
+		while (retired != nullptr)
+		{
+			Retired* next = retired->_next;
+			retired->_destroy(retired->_object);
+			delete retired;
+			retired = next;
+		}
+	}
+}
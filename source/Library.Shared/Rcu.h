@@ -0,0 +1,202 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Rcu Class - Process wide read-copy-update domain for read-mostly shared data. Readers enter a ReadGuard and read whatever version of the data
+	/// is published, without taking a lock. Writers publish a new version and Retire the old one, which is deleted once every reader that could still
+	/// be looking at it has left its guard. Grace periods are tracked with a global epoch that each reader records in a slot of its own.
+	/// </summary>
+	class Rcu final
+	{
+	public:
+		/// <summary>
+		/// Number of threads that can be inside a ReadGuard at once. A thread holds its slot from its first guard until it exits.
+		/// </summary>
+		static constexpr std::size_t MaxThreads = 128;
+
+		/// <summary>
+		/// ReadGuard - Marks the calling thread as reading for the guard's lifetime. Anything loaded from an RcuPointer inside the guard stays alive
+		/// until the guard is destroyed. Guards nest, and retiring from inside one is allowed - the retired object simply outlives the guard.
+		/// </summary>
+		class ReadGuard final
+		{
+		public:
+			/// <summary>
+			/// Constructor - Enters a read section.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Throws if more than MaxThreads threads are reading.</exception>
+			ReadGuard();
+
+			ReadGuard(const ReadGuard&) = delete;
+			ReadGuard(ReadGuard&&) = delete;
+			ReadGuard& operator=(const ReadGuard&) = delete;
+			ReadGuard& operator=(ReadGuard&&) = delete;
+
+			/// <summary>
+			/// Destructor - Leaves the read section, deleting retired objects if this was the last reader holding them.
+			/// </summary>
+			~ReadGuard();
+		};
+
+		Rcu() = delete;
+
+		/// <summary>
+		/// Retire - Deletes an object once no reader can be using it. Call after the object has been unpublished.
+		/// </summary>
+		/// <typeparam name="T">Type of the object.</typeparam>
+		/// <param name="object">Object to delete. Null is ignored.</param>
+		template <typename T>
+		static void Retire(gsl::owner<const T*> object);
+
+		/// <summary>
+		/// Reclaim - Deletes every retired object that no reader can still be using.
+		/// </summary>
+		static void Reclaim();
+
+		/// <summary>
+		/// PendingCount - Returns the number of retired objects still waiting for their readers.
+		/// </summary>
+		static std::size_t PendingCount();
+
+	private:
+		/// <summary>
+		/// ReaderSlot - Epoch a thread entered its outermost ReadGuard at, 0 while it isn't reading. Padded to a cache line so readers don't contend.
+		/// </summary>
+#pragma warning(push)
+#pragma warning(disable: 4324) // The padding is the point
+		struct alignas(64) ReaderSlot final
+		{
+			std::atomic<std::uint64_t> _epoch{ 0 };
+			std::atomic<bool> _isClaimed{ false };
+		};
+#pragma warning(pop)
+
+		/// <summary>
+		/// ThreadState - The calling thread's slot and ReadGuard nesting depth. Gives the slot back when the thread exits.
+		/// </summary>
+		struct ThreadState final
+		{
+			~ThreadState();
+
+			ReaderSlot* _slot = nullptr;
+			std::size_t _depth = 0;
+		};
+
+		/// <summary>
+		/// Retired - An object waiting for the readers of its epoch to leave.
+		/// </summary>
+		struct Retired;
+
+		/// <summary>
+		/// Retire - Queues object, tagged with the current epoch, to be destroyed with destroy.
+		/// </summary>
+		static void Retire(const void* object, void (*destroy)(const void*));
+
+		/// <summary>
+		/// Claims a free reader slot for the calling thread.
+		/// </summary>
+		static ReaderSlot& ClaimSlot();
+
+		/// <summary>
+		/// Unlinks the retired objects no reader can be using. The caller holds _retiredMutex and destroys them after releasing it.
+		/// </summary>
+		static Retired* CollectReclaimable();
+
+		/// <summary>
+		/// Destroys a list returned by CollectReclaimable.
+		/// </summary>
+		static void Destroy(Retired* retired);
+
+		/// <summary>
+		/// _slots - One slot per reading thread.
+		/// </summary>
+		static ReaderSlot _slots[MaxThreads];
+
+		/// <summary>
+		/// _slotCount - One past the highest slot ever claimed, so writers only scan slots that may be in use.
+		/// </summary>
+		static std::atomic<std::size_t> _slotCount;
+
+		/// <summary>
+		/// _epoch - Advanced by every Retire. Objects retired at an epoch are safe to delete once every reader entered after it.
+		/// </summary>
+		static std::atomic<std::uint64_t> _epoch;
+
+		/// <summary>
+		/// _retired - Objects waiting to be deleted, newest first. Guarded by _retiredMutex.
+		/// </summary>
+		static Retired* _retired;
+
+		/// <summary>
+		/// _retiredMutex - Serializes Retire and Reclaim.
+		/// </summary>
+		static std::mutex _retiredMutex;
+
+		/// <summary>
+		/// _pendingCount - Length of _retired, read without the lock by readers leaving their guard.
+		/// </summary>
+		static std::atomic<std::size_t> _pendingCount;
+
+		/// <summary>
+		/// _threadState - The calling thread's reader state.
+		/// </summary>
+		static thread_local ThreadState _threadState;
+	};
+
+	/// <summary>
+	/// RcuPointer Class - A published version of T. Readers Load it inside an Rcu::ReadGuard, writers Store a replacement and the previous version
+	/// is retired. Writers are not serialized here - owners that update from several threads guard their Stores with a lock of their own.
+	/// </summary>
+	/// <typeparam name="T">Type of the published data.</typeparam>
+	template <typename T>
+	class RcuPointer final
+	{
+	public:
+		/// <summary>
+		/// Constructor - Creates a pointer publishing nothing. Constant initialized, so it can be a static used during static initialization.
+		/// </summary>
+		constexpr RcuPointer() = default;
+
+		RcuPointer(const RcuPointer&) = delete;
+		RcuPointer(RcuPointer&&) = delete;
+		RcuPointer& operator=(const RcuPointer&) = delete;
+		RcuPointer& operator=(RcuPointer&&) = delete;
+
+		/// <summary>
+		/// Destructor - Deletes the published version. No reader may be using it anymore.
+		/// </summary>
+		~RcuPointer();
+
+		/// <summary>
+		/// Load - Returns the published version. The caller must be inside a ReadGuard, or be the writer.
+		/// </summary>
+		/// <returns>Address of the published version, nullptr if there is none.</returns>
+		const T* Load() const;
+
+		/// <summary>
+		/// Store - Publishes a new version and retires the previous one.
+		/// </summary>
+		/// <param name="value">Version to publish, owned by the pointer from now on. May be nullptr.</param>
+		void Store(gsl::owner<const T*> value);
+
+		/// <summary>
+		/// Exchange - Publishes a new version and hands the previous one to the caller, who must Retire it once done with it.
+		/// </summary>
+		/// <param name="value">Version to publish, owned by the pointer from now on. May be nullptr.</param>
+		/// <returns>The previous version, nullptr if there was none.</returns>
+		gsl::owner<const T*> Exchange(gsl::owner<const T*> value);
+
+	private:
+		/// <summary>
+		/// _value - The published version.
+		/// </summary>
+		std::atomic<const T*> _value{ nullptr };
+	};
+}
+
+#include "Rcu.inl"
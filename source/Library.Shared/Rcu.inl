@@ -0,0 +1,38 @@
+#include "pch.h"
+#include "Rcu.h"
+
+namespace FieaGameEngine
+{
+	template<typename T>
+	inline void Rcu::Retire(gsl::owner<const T*> object)
+	{
+		if (object != nullptr)
+		{
+			Retire(object, [](const void* retired) { delete static_cast<const T*>(retired); });
+		}
+	}
+
+	template<typename T>
+	inline RcuPointer<T>::~RcuPointer()
+	{
+		delete _value.load(std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	inline const T* RcuPointer<T>::Load() const
+	{
+		return _value.load(std::memory_order_acquire);
+	}
+
+	template<typename T>
+	inline void RcuPointer<T>::Store(gsl::owner<const T*> value)
+	{
+		Rcu::Retire(Exchange(value));
+	}
+
+	template<typename T>
+	inline gsl::owner<const T*> RcuPointer<T>::Exchange(gsl::owner<const T*> value)
+	{
+		return _value.exchange(value);
+	}
+}
@@ -3,14 +3,20 @@
 
 namespace FieaGameEngine
 {
-	const Vector<Signature> ReactionAttributed::Signatures()
+	StaticSignatureList ReactionAttributed::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Subtype", Datum::DatumType::String, 1, offsetof(ReactionAttributed, _subtype)}
+			REFLECT_FIELD("Subtype", ReactionAttributed, _subtype)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of ReactionAttributed share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> ReactionAttributed::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	ReactionAttributed::ReactionAttributed()
@@ -34,27 +40,21 @@ namespace FieaGameEngine
 
 	void ReactionAttributed::Notify(const EventPublisher& publisher)
 	{
-		assert(publisher.Is(EventMessageAttributed::TypeIdClass()));
-		auto eventReference = reinterpret_cast<const EventMessageAttributed&>(publisher);
-		if (eventReference.GetSubType() == _subtype)
+		assert(publisher.Is(Event<EventMessageAttributed>::TypeIdClass()));
+		const EventMessageAttributed& message = static_cast<const Event<EventMessageAttributed>&>(publisher).Message();
+		if (message.GetSubType() == _subtype)
 		{
-			for (auto attribute : AuxiliaryAttributes())
-			{
-				Datum& d = eventReference.Append(attribute.name);
-				d.SetType(attribute.type);
-			}
-
-			for (size_t i = 0; i < Size(); ++i)
+			//	Copy the event's arguments into this reaction, where its actions can Search() for them. Index 0 is the message's "this".
+			for (const auto& entry : message.AuxiliaryEntries())
 			{
-				auto& [key, datum] = *(_orderList[i]);
-				if (!eventReference.IsPrescribedAttribute(key))
+				if (entry.index != 0 && !IsPrescribedAttribute(entry.key))
 				{
-					eventReference[key] = datum;
+					(*this)[entry.key] = entry.datum;
 				}
 			}
 
 			GameState state;
-			state.SetCurrentGameObject(*(eventReference.GetGameObject()));
+			state.SetCurrentGameObject(*(message.GetGameObject()));
 			ActionList::Update(state);
 		}
 	}
@@ -53,7 +53,8 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Notify - Accepts Attributed events, if the event subtype matches the reaction's subtype then it copies the attribute arguments
-		/// to this instance of ReactionAttribute and then executes ActionList::Update().
+		/// from the event's message to this instance of ReactionAttribute and then executes ActionList::Update(). The message isn't changed,
+		/// and this reaction keeps its own "this" and prescribed attributes.
 		/// </summary>
 		/// <param name="publisher">Event to check for subtypes. Should always be Attributed events.</param>
 		void Notify(const EventPublisher& publisher) override;
@@ -62,7 +63,13 @@ namespace FieaGameEngine
 		/// Signatures - Returns the static signature vector for all prescribed attributes. Required for Attributed.
 		/// </summary>
 		/// <returns>Returns the static signature vector for all prescribed attributes.</returns>
-		const Vector<Signature> Signatures();
+		static const Vector<Signature> Signatures();
+
+		/// <summary>
+		/// StaticSignatures - Returns the compile time signatures of the prescribed attributes, declared with REFLECT_FIELD. Register with TypeManager::AddType&lt;ReactionAttributed&gt;().
+		/// </summary>
+		/// <returns>View of the static signature array.</returns>
+		static StaticSignatureList StaticSignatures();
 
 		/// <summary>
 		/// SubscribeToAttributedEvent - Subscribes this reaction to an attributed event.
@@ -0,0 +1,206 @@
+#include "pch.h"
+#include "SceneLoader.h"
+#include "JsonTableParseHelper.h"
+#include "MappedFile.h"
+#include "ChangeJournal.h"
+
+namespace FieaGameEngine
+{
+#pragma region SceneLoad
+
+	SceneLoad::SceneLoad(const std::string& fileName, Scope& parent, const std::string& key) :
+		_fileName(fileName), _parent(&parent), _key(key)
+	{
+	}
+
+	SceneLoad::~SceneLoad()
+	{
+		assert(_thread.joinable() == false);
+		if (_status.load(std::memory_order_acquire) != Status::Adopted)
+		{
+			delete _root;
+		}
+	}
+
+	SceneLoad::Status SceneLoad::GetStatus() const
+	{
+		return _status.load(std::memory_order_acquire);
+	}
+
+	float SceneLoad::Progress() const
+	{
+		const Status status = GetStatus();
+		if (status == Status::Loaded || status == Status::Adopted)
+		{
+			return 1.0f;
+		}
+
+		const size_t total = _progress._bytesTotal.load(std::memory_order_relaxed);
+		return (total == 0 ? 0.0f : static_cast<float>(_progress._bytesParsed.load(std::memory_order_relaxed)) / static_cast<float>(total));
+	}
+
+	void SceneLoad::Cancel()
+	{
+		_progress._isCancelled.store(true, std::memory_order_relaxed);
+	}
+
+	Scope* SceneLoad::Root() const
+	{
+		return (GetStatus() == Status::Adopted ? _root : nullptr);
+	}
+
+	std::exception_ptr SceneLoad::Error() const
+	{
+		return (GetStatus() == Status::Failed ? _error : nullptr);
+	}
+
+	const std::string& SceneLoad::FileName() const
+	{
+		return _fileName;
+	}
+
+	void SceneLoad::Run()
+	{
+		//	The root is detached until Update adopts it, and the journal can only be written from one thread
+		ChangeJournal::Suppression suppression;
+
+		gsl::owner<Scope*> root = nullptr;
+		try
+		{
+			const MappedFile file(_fileName);
+			if (file.IsOpen() == false)
+			{
+				throw std::runtime_error("Unable to open " + _fileName + ". SceneLoader::Load()");
+			}
+
+			root = new Scope();
+			SharedTableData data(*root);
+			JsonParseCoordinator parser(data);
+			JsonTableParseHelper helper;
+			parser.AddHelper(helper);
+			parser.SetProgress(&_progress);
+			parser.ParseStreaming(file.View());
+
+			_root = root;
+			_status.store(Status::Loaded, std::memory_order_release);
+		}
+		catch (...)
+		{
+			delete root;
+			if (_progress._isCancelled.load(std::memory_order_relaxed))
+			{
+				_status.store(Status::Cancelled, std::memory_order_release);
+			}
+			else
+			{
+				_error = std::current_exception();
+				_status.store(Status::Failed, std::memory_order_release);
+			}
+		}
+	}
+
+#pragma endregion
+
+#pragma region SceneLoader
+
+	SceneLoader::~SceneLoader()
+	{
+		Clear();
+	}
+
+	std::shared_ptr<SceneLoad> SceneLoader::Load(const std::string& fileName, Scope& parent, const std::string& key)
+	{
+		auto load = std::make_shared<SceneLoad>(fileName, parent, key);
+		_loads.PushBack(load);
+		load->_thread = std::thread(&SceneLoad::Run, load.get());
+		return load;
+	}
+
+	size_t SceneLoader::Update()
+	{
+		size_t adopted = 0;
+		size_t loading = 0;
+		for (size_t i = 0; i < _loads.Size(); ++i)
+		{
+			SceneLoad& load = *_loads[i];
+			SceneLoad::Status status = load.GetStatus();
+
+			//	Roots are adopted in the order their loads were started, so a loaded one waits for the loads before it
+			if (status == SceneLoad::Status::Loading || (status == SceneLoad::Status::Loaded && loading > 0))
+			{
+				//	Kept in the order they were started
+				if (loading != i)
+				{
+					_loads[loading] = std::move(_loads[i]);
+				}
+				++loading;
+				continue;
+			}
+
+			load._thread.join();
+			if (status == SceneLoad::Status::Loaded)
+			{
+				if (load._progress._isCancelled.load(std::memory_order_relaxed))
+				{
+					status = SceneLoad::Status::Cancelled;
+				}
+				else
+				{
+					try
+					{
+						load._parent->Adopt(*load._root, load._key);
+						status = SceneLoad::Status::Adopted;
+						++adopted;
+					}
+					catch (...)
+					{
+						load._error = std::current_exception();
+						status = SceneLoad::Status::Failed;
+					}
+				}
+
+				if (status != SceneLoad::Status::Adopted)
+				{
+					delete load._root;
+					load._root = nullptr;
+				}
+				load._status.store(status, std::memory_order_release);
+			}
+		}
+
+		while (_loads.Size() > loading)
+		{
+			_loads.PopBack();
+		}
+
+		return adopted;
+	}
+
+	size_t SceneLoader::Size() const
+	{
+		return _loads.Size();
+	}
+
+	void SceneLoader::Clear()
+	{
+		for (auto& load : _loads)
+		{
+			load->Cancel();
+		}
+
+		for (auto& load : _loads)
+		{
+			load->_thread.join();
+			if (load->GetStatus() == SceneLoad::Status::Loaded)
+			{
+				delete load->_root;
+				load->_root = nullptr;
+				load->_status.store(SceneLoad::Status::Cancelled, std::memory_order_release);
+			}
+		}
+
+		_loads.Clear();
+	}
+
+#pragma endregion
+}
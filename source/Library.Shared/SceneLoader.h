@@ -0,0 +1,207 @@
+#pragma once
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include "JsonParseCoordinator.h"
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// SceneLoad Class - Handle to a scene being loaded by a SceneLoader. Shared between the loader and whoever asked for the load, so it can be
+	/// polled and cancelled from the main thread while the load runs, and outlives the loader.
+	/// </summary>
+	class SceneLoad final
+	{
+		friend class SceneLoader;
+
+	public:
+		/// <summary>
+		/// Status - Where the load is at. Only Loading ever changes on its own, the rest change in SceneLoader::Update().
+		/// </summary>
+		enum class Status
+		{
+			/// <summary>
+			/// The file is being parsed on the load's thread.
+			/// </summary>
+			Loading,
+
+			/// <summary>
+			/// The file is parsed, its root waits for the next SceneLoader::Update() to be adopted.
+			/// </summary>
+			Loaded,
+
+			/// <summary>
+			/// The root was adopted into its parent. Root() returns it.
+			/// </summary>
+			Adopted,
+
+			/// <summary>
+			/// The file couldn't be opened, parsed or adopted. Error() says why.
+			/// </summary>
+			Failed,
+
+			/// <summary>
+			/// Cancel() was called before the root was adopted. Whatever was loaded is deleted.
+			/// </summary>
+			Cancelled
+		};
+
+		/// <summary>
+		/// Constructor - Used by SceneLoader::Load().
+		/// </summary>
+		/// <param name="fileName">Path of the Json scene.</param>
+		/// <param name="parent">Scope the root is adopted into.</param>
+		/// <param name="key">Key the root is adopted under.</param>
+		SceneLoad(const std::string& fileName, Scope& parent, const std::string& key);
+
+		SceneLoad(const SceneLoad&) = delete;
+		SceneLoad& operator=(const SceneLoad&) = delete;
+		SceneLoad(SceneLoad&&) = delete;
+		SceneLoad& operator=(SceneLoad&&) = delete;
+
+		/// <summary>
+		/// Destructor - Deletes a root that was loaded but never adopted. Its thread has been joined by then.
+		/// </summary>
+		~SceneLoad();
+
+		/// <summary>
+		/// GetStatus - Returns where the load is at.
+		/// </summary>
+		Status GetStatus() const;
+
+		/// <summary>
+		/// Progress - Returns how much of the file has been parsed, from 0 to 1.
+		/// </summary>
+		float Progress() const;
+
+		/// <summary>
+		/// Cancel - Stops the parse at its next member, or keeps a root that is already loaded from being adopted. Does nothing once adopted.
+		/// </summary>
+		void Cancel();
+
+		/// <summary>
+		/// Root - Returns the loaded root once it was adopted, nullptr until then.
+		/// </summary>
+		Scope* Root() const;
+
+		/// <summary>
+		/// Error - Returns the exception the load failed with, nullptr unless the Status is Failed.
+		/// </summary>
+		std::exception_ptr Error() const;
+
+		/// <summary>
+		/// FileName - Returns the path of the Json scene.
+		/// </summary>
+		const std::string& FileName() const;
+
+	private:
+		/// <summary>
+		/// Run - Body of the load's thread: parses the file into a new root Scope, then publishes it by setting the Status to Loaded.
+		/// </summary>
+		void Run();
+
+		/// <summary>
+		/// Path of the Json scene.
+		/// </summary>
+		std::string _fileName;
+
+		/// <summary>
+		/// Scope the root is adopted into.
+		/// </summary>
+		Scope* _parent;
+
+		/// <summary>
+		/// Key the root is adopted under.
+		/// </summary>
+		std::string _key;
+
+		/// <summary>
+		/// The loaded root. Written by the load's thread before it publishes Loaded, owned by the load until adopted.
+		/// </summary>
+		Scope* _root = nullptr;
+
+		/// <summary>
+		/// Why the load failed. Written before Failed is published.
+		/// </summary>
+		std::exception_ptr _error;
+
+		/// <summary>
+		/// Progress the parse reports into, and the flag Cancel() sets.
+		/// </summary>
+		JsonParseCoordinator::ParseProgress _progress;
+
+		/// <summary>
+		/// Where the load is at. Released by the writer, acquired by the reader, so _root and _error are seen once it is.
+		/// </summary>
+		std::atomic<Status> _status{ Status::Loading };
+
+		/// <summary>
+		/// The load's thread, joined by SceneLoader.
+		/// </summary>
+		std::thread _thread;
+	};
+
+	/// <summary>
+	/// SceneLoader Class - Loads Json scenes in the background. Each load parses its file with JsonTableParseHelper on a thread of its own, into a
+	/// root Scope nothing else can see, creating every Scope of the scene there. Update(), called on the main thread at a frame boundary (next to
+	/// EventQueue::Update), adopts the roots that are done into the Scopes they were asked for - so the main thread pays for one Adopt per scene
+	/// and never waits on a parse.
+	/// Factories and their pools, prefabs and the type manager are only read by the loads, so prefabs must not be registered or unregistered while
+	/// loads are running. Loads parse with the ChangeJournal suppressed on their threads: the journal sees each scene once, when Update adopts it.
+	/// </summary>
+	class SceneLoader final
+	{
+	public:
+		/// <summary>
+		/// Defaulted constructor - Creates a loader with no loads.
+		/// </summary>
+		SceneLoader() = default;
+
+		SceneLoader(const SceneLoader&) = delete;
+		SceneLoader& operator=(const SceneLoader&) = delete;
+		SceneLoader(SceneLoader&&) = delete;
+		SceneLoader& operator=(SceneLoader&&) = delete;
+
+		/// <summary>
+		/// Destructor - Cancels the loads that haven't been adopted and waits for their threads.
+		/// </summary>
+		~SceneLoader();
+
+		/// <summary>
+		/// Load - Starts loading a Json scene on a new thread.
+		/// </summary>
+		/// <param name="fileName">Path of the Json scene.</param>
+		/// <param name="parent">Scope the scene's root is adopted into. Must outlive the load, or the load must be cancelled first.</param>
+		/// <param name="key">Key the scene's root is adopted under.</param>
+		/// <returns>Handle to the load.</returns>
+		std::shared_ptr<SceneLoad> Load(const std::string& fileName, Scope& parent, const std::string& key);
+
+		/// <summary>
+		/// Update - Finishes the loads whose threads are done: adopts the loaded roots, deletes the ones that were cancelled, and stops tracking them.
+		/// Roots are adopted in the order their loads were started, a root loaded behind a load still running waits for a later Update.
+		/// Loads that failed are dropped as well, their handles keep the error.
+		/// </summary>
+		/// <returns>The number of roots adopted.</returns>
+		size_t Update();
+
+		/// <summary>
+		/// Size - Returns the number of loads Update() hasn't finished yet.
+		/// </summary>
+		size_t Size() const;
+
+		/// <summary>
+		/// Clear - Cancels every load Update() hasn't finished yet, and waits for their threads.
+		/// </summary>
+		void Clear();
+
+	private:
+		/// <summary>
+		/// Loads Update() hasn't finished yet, in the order they were started.
+		/// </summary>
+		Vector<std::shared_ptr<SceneLoad>> _loads;
+	};
+}
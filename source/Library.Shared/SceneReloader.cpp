@@ -0,0 +1,296 @@
+#include "pch.h"
+#include "SceneReloader.h"
+#include "CookedScene.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include "MappedFile.h"
+#include "Vector.h"
+#include <algorithm>
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Puts next's values from first on into live at position, ahead of the values live already has there.
+		/// </summary>
+		template <typename T>
+		size_t InsertValues(Datum& live, size_t position, const Datum& next, size_t first)
+		{
+			//	Datums only push back, so the values after position are taken off and put back behind the new ones
+			Vector<T> after;
+			after.Reserve(live.Size() - position);
+			while (live.Size() > position)
+			{
+				after.PushBack(live.Get<T>(live.Size() - 1));
+				live.RemoveAt(live.Size() - 1);
+			}
+
+			for (size_t i = first; i < next.Size(); ++i)
+			{
+				live.PushBack(next.Get<T>(i));
+			}
+
+			while (after.IsEmpty() == false)
+			{
+				live.PushBack(after.Back());
+				after.PopBack();
+			}
+
+			return next.Size() - first;
+		}
+
+		/// <summary>
+		/// Writes the values next changed since base into live. The file's values are the first base->Size() of live, anything after them was
+		/// added at runtime: values unchanged in the file keep whatever live holds now, values the file added go in behind the file's and values
+		/// the file removed are removed, the runtime ones staying in order after them. All positions of external storage are the file's.
+		/// </summary>
+		template <typename T>
+		size_t ApplyValues(Datum& live, const Datum* base, const Datum& next)
+		{
+			const size_t removedEnd = (base != nullptr ? std::min(base->Size(), live.Size()) : 0_z);
+			const size_t fileSize = (live.OwnsData() ? removedEnd : live.Size());
+
+			size_t edits = 0;
+			for (size_t i = 0; i < std::min(next.Size(), fileSize); ++i)
+			{
+				const T& value = next.Get<T>(i);
+				if (base != nullptr && i < base->Size() && base->Get<T>(i) == value)
+				{
+					continue;
+				}
+
+				if (live.Get<T>(i) != value)
+				{
+					live.Set(value, i);
+					++edits;
+				}
+			}
+
+			if (next.Size() > fileSize)
+			{
+				edits += InsertValues<T>(live, fileSize, next, fileSize);
+			}
+
+			for (size_t i = next.Size(); i < removedEnd; ++i)
+			{
+				live.RemoveAt(next.Size());
+				++edits;
+			}
+
+			return edits;
+		}
+	}
+
+	SceneReloader::SceneReloader(Scope& live) :
+		_live(&live)
+	{
+	}
+
+	size_t SceneReloader::Reload(std::string_view json)
+	{
+		const std::uint64_t hash = CookedScene::Hash(json);
+		if (hash == _sourceHash)
+		{
+			return 0;
+		}
+
+		//	Parsed on its own first, so a scene that doesn't parse never touches the live tree
+		Scope next;
+		{
+			SharedTableData data(next);
+			JsonParseCoordinator parser(data);
+			JsonTableParseHelper helper;
+			parser.AddHelper(helper);
+			parser.ParseStreaming(json);
+		}
+
+		const size_t edits = Apply(*_live, &_source, next);
+
+		_source.Clear();
+		_source.Merge(next);
+		_sourceHash = hash;
+		return edits;
+	}
+
+	size_t SceneReloader::ReloadFromFile(const std::string& fileName)
+	{
+		const MappedFile file(fileName);
+		if (file.IsOpen() == false)
+		{
+			throw std::runtime_error("Unable to open " + fileName + ". SceneReloader::ReloadFromFile()");
+		}
+
+		return Reload(file.View());
+	}
+
+	const Scope& SceneReloader::Source() const
+	{
+		return _source;
+	}
+
+	size_t SceneReloader::Apply(Scope& live, const Scope* base, const Scope& next)
+	{
+		size_t edits = 0;
+		for (size_t i = 0; i < next.Size(); ++i)
+		{
+			const auto& [key, datum] = next.GetPair(i);
+			edits += ApplyDatum(live, key, (base != nullptr ? base->Find(key) : nullptr), datum);
+		}
+
+		//	Keys the file removed: as if next had them with no values
+		if (base != nullptr)
+		{
+			for (size_t i = 0; i < base->Size(); ++i)
+			{
+				const auto& [key, datum] = base->GetPair(i);
+				if (next.Find(key) == nullptr && live.Find(key) != nullptr)
+				{
+					edits += ApplyDatum(live, key, &datum, Datum(datum.Type()));
+				}
+			}
+		}
+
+		return edits;
+	}
+
+	size_t SceneReloader::ApplyDatum(Scope& live, const std::string& key, const Datum* base, const Datum& next)
+	{
+		//	Pointers into the scratch tree mean nothing in the live one
+		if (next.Type() == Datum::DatumType::Pointer || next.Type() == Datum::DatumType::Unknown)
+		{
+			return 0;
+		}
+
+		Datum* datum = live.Find(key);
+		if (datum == nullptr)
+		{
+			datum = &live.Append(key);
+		}
+
+		//	A key whose type changed in the file has no values to diff against
+		if (base != nullptr && base->Type() != next.Type())
+		{
+			base = nullptr;
+		}
+
+		if (datum->Type() == Datum::DatumType::Unknown)
+		{
+			datum->SetType(next.Type());
+		}
+		else if (datum->Type() != next.Type())
+		{
+			if (datum->Type() == Datum::DatumType::Table || next.Type() == Datum::DatumType::Table || datum->OwnsData() == false)
+			{
+				throw std::runtime_error("Attempting to reload " + key + " into a Datum of a different type. SceneReloader::Reload()");
+			}
+
+			*datum = next;
+			return 1;
+		}
+
+		switch (next.Type())
+		{
+		case Datum::DatumType::Table:
+			return ApplyTable(live, key, *datum, base, next);
+		case Datum::DatumType::Float:
+			return ApplyValues<float>(*datum, base, next);
+		case Datum::DatumType::Integer:
+			return ApplyValues<int>(*datum, base, next);
+		case Datum::DatumType::Matrix:
+			return ApplyValues<mat4x4>(*datum, base, next);
+		case Datum::DatumType::String:
+			return ApplyValues<std::string>(*datum, base, next);
+		case Datum::DatumType::Vector:
+			return ApplyValues<vec4>(*datum, base, next);
+		default:
+			return 0;
+		}
+	}
+
+	size_t SceneReloader::ApplyTable(Scope& live, const std::string& key, Datum& datum, const Datum* base, const Datum& next)
+	{
+		//	The file's children come first, the ones spawned at runtime after them
+		const size_t fileSize = (base != nullptr ? std::min(base->Size(), datum.Size()) : 0_z);
+
+		size_t edits = 0;
+		for (size_t i = 0; i < std::min(next.Size(), fileSize); ++i)
+		{
+			const Scope& nextChild = *next.Get<Scope*>(i);
+			if (datum[i].TypeIdInstance() == nextChild.TypeIdInstance())
+			{
+				edits += Apply(datum[i], base->Get<Scope*>(i), nextChild);
+			}
+			else
+			{
+				edits += ReplaceChild(live, key, datum, i, nextChild);
+			}
+		}
+
+		if (next.Size() > fileSize)
+		{
+			edits += InsertChildren(live, key, datum, fileSize, next, fileSize);
+		}
+
+		//	From the back, so the positions still to go don't move
+		for (size_t i = fileSize; i > next.Size(); --i)
+		{
+			Scope& child = datum[i - 1];
+			child.Orphan();
+			delete &child;
+			++edits;
+		}
+
+		return edits;
+	}
+
+	size_t SceneReloader::ReplaceChild(Scope& live, const std::string& key, Datum& datum, size_t index, const Scope& next)
+	{
+		gsl::owner<Scope*> copy = next.Clone();
+
+		//	Adopt only appends, so the children after index are taken out and put back behind the copy
+		Vector<Scope*> after = OrphanFrom(datum, index + 1);
+		Scope& replaced = datum[index];
+		replaced.Orphan();
+		delete &replaced;
+
+		live.Adopt(*copy, key);
+		AdoptBack(live, key, after);
+		return 1;
+	}
+
+	size_t SceneReloader::InsertChildren(Scope& live, const std::string& key, Datum& datum, size_t position, const Datum& next, size_t first)
+	{
+		Vector<Scope*> after = OrphanFrom(datum, position);
+		for (size_t i = first; i < next.Size(); ++i)
+		{
+			live.Adopt(*next.Get<Scope*>(i)->Clone(), key);
+		}
+
+		AdoptBack(live, key, after);
+		return next.Size() - first;
+	}
+
+	Vector<Scope*> SceneReloader::OrphanFrom(Datum& datum, size_t index)
+	{
+		Vector<Scope*> children;
+		children.Reserve(datum.Size() - std::min(index, datum.Size()));
+		while (datum.Size() > index)
+		{
+			Scope& child = datum[datum.Size() - 1];
+			child.Orphan();
+			children.PushBack(&child);
+		}
+
+		return children;
+	}
+
+	void SceneReloader::AdoptBack(Scope& live, const std::string& key, Vector<Scope*>& children)
+	{
+		while (children.IsEmpty() == false)
+		{
+			live.Adopt(*children.Back(), key);
+			children.PopBack();
+		}
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// SceneReloader Class - Hot reloads a Json scene into a live tree without rebuilding it. Every Reload parses the new text into a scratch tree
+	/// and diffs it against the tree of the previous Reload - the source - so only what the file changed is written into the live tree.
+	/// Scopes and Datums of the live tree are kept and edited in place, so pointers into it stay valid, and anything the file didn't change keeps
+	/// the value it has at runtime: attributes added at runtime, values written at runtime and children spawned at runtime are left alone.
+	/// In every Datum the file's values and children are taken to come first, as the file put them there, and whatever follows them to have been
+	/// added at runtime. Nested Scopes are matched by their position among the file's, a child whose class changed is replaced by a copy of the new one.
+	/// </summary>
+	class SceneReloader final
+	{
+	public:
+		/// <summary>
+		/// Constructor - Creates a reloader for a live tree, with an empty source. The first Reload writes the whole scene into live.
+		/// </summary>
+		/// <param name="live">Root of the tree to reload into. Must outlive the reloader.</param>
+		explicit SceneReloader(Scope& live);
+
+		SceneReloader(const SceneReloader&) = delete;
+		SceneReloader& operator=(const SceneReloader&) = delete;
+		SceneReloader(SceneReloader&&) = delete;
+		SceneReloader& operator=(SceneReloader&&) = delete;
+
+		/// <summary>
+		/// Defaulted destructor - Deletes the source tree. The live tree is the caller's.
+		/// </summary>
+		~SceneReloader() = default;
+
+		/// <summary>
+		/// Reload - Parses a Json scene with JsonTableParseHelper, members in document order as with ParseStreaming, and applies what changed since
+		/// the previous Reload to the live tree. Text identical to the previous Reload's isn't parsed at all.
+		/// Per key of the new scene, only the values and children that differ from the source are written: values are set in place, values and
+		/// children the file added go in behind the ones the file had, ahead of those added at runtime, values and children the file removed are
+		/// removed, and keys the file removed lose the values and children the file gave them. Pointer Datums (including Attributed's "this") only mean something in the tree they were parsed into,
+		/// so they are never written. The factories of the scene's classes have to be registered.
+		/// </summary>
+		/// <param name="json">The Json text of the scene.</param>
+		/// <returns>The number of values and children written, added or removed - 0 if the live tree was already up to date.</returns>
+		/// <exception cref="std::runtime_error">Throws if the scene fails to parse, which leaves the live tree as it was, or if a key changed
+		/// to or from a table, or changed type in a Datum with external storage. Keys applied before that one keep their edits.</exception>
+		size_t Reload(std::string_view json);
+
+		/// <summary>
+		/// ReloadFromFile - Memory maps a Json scene and passes its contents into Reload.
+		/// </summary>
+		/// <param name="fileName">Path of the Json scene.</param>
+		/// <returns>The number of values and children written, added or removed.</returns>
+		/// <exception cref="std::runtime_error">Throws if the file can't be opened, or for the reasons Reload does.</exception>
+		size_t ReloadFromFile(const std::string& fileName);
+
+		/// <summary>
+		/// Source - Returns the tree parsed by the last Reload, the scene as the file last had it.
+		/// </summary>
+		const Scope& Source() const;
+
+	private:
+		/// <summary>
+		/// Apply - Writes the changes from base to next into live, key by key, then removes what the file gave the keys next no longer has.
+		/// </summary>
+		/// <param name="live">Scope of the live tree to edit.</param>
+		/// <param name="base">Matching Scope of the source, nullptr if next is new.</param>
+		/// <param name="next">Matching Scope of the new scene.</param>
+		/// <returns>The number of edits.</returns>
+		size_t Apply(Scope& live, const Scope* base, const Scope& next);
+
+		/// <summary>
+		/// ApplyDatum - Writes the changes from base to next into the Datum of live paired with key, appending it if live hasn't got it.
+		/// </summary>
+		size_t ApplyDatum(Scope& live, const std::string& key, const Datum* base, const Datum& next);
+
+		/// <summary>
+		/// ApplyTable - Applies each child of next to the live child at its position among base's, replacing live children of another class,
+		/// inserts the children next added behind base's, then deletes the live children whose positions base had and next hasn't.
+		/// Children after base's positions were spawned at runtime and are left alone.
+		/// </summary>
+		size_t ApplyTable(Scope& live, const std::string& key, Datum& datum, const Datum* base, const Datum& next);
+
+		/// <summary>
+		/// ReplaceChild - Adopts a copy of next into live under key, at position index of datum, deleting the child that was there.
+		/// </summary>
+		size_t ReplaceChild(Scope& live, const std::string& key, Datum& datum, size_t index, const Scope& next);
+
+		/// <summary>
+		/// InsertChildren - Adopts copies of the children of next from first on into live under key, at position of datum, ahead of the children
+		/// already there.
+		/// </summary>
+		size_t InsertChildren(Scope& live, const std::string& key, Datum& datum, size_t position, const Datum& next, size_t first);
+
+		/// <summary>
+		/// OrphanFrom - Orphans the children of datum from index on and returns them, last first, for AdoptBack.
+		/// </summary>
+		static Vector<Scope*> OrphanFrom(Datum& datum, size_t index);
+
+		/// <summary>
+		/// AdoptBack - Adopts children taken by OrphanFrom back into live under key, in their original order.
+		/// </summary>
+		static void AdoptBack(Scope& live, const std::string& key, Vector<Scope*>& children);
+
+		/// <summary>
+		/// The live tree.
+		/// </summary>
+		Scope* _live;
+
+		/// <summary>
+		/// The tree parsed by the last Reload.
+		/// </summary>
+		Scope _source;
+
+		/// <summary>
+		/// CookedScene::Hash of the text of the last Reload, 0 before the first.
+		/// </summary>
+		std::uint64_t _sourceHash = 0;
+	};
+}
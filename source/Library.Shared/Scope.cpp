@@ -1,24 +1,54 @@
 #include "pch.h"
 #include "Scope.h"
+#include "ScopeTraversal.h"
 
 using namespace std;
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Appends source's values to target, or writes them over target's external storage.
+		/// </summary>
+		template <typename T>
+		void MergeValues(Datum& target, const Datum& source)
+		{
+			for (size_t i = 0; i < source.Size(); ++i)
+			{
+				if (target.OwnsData())
+				{
+					target.PushBack(source.Get<T>(i));
+				}
+				else
+				{
+					target.Set(source.Get<T>(i), i);
+				}
+			}
+		}
+	}
+
 	RTTI_DEFINITIONS(Scope)
 
 	Scope::Scope(size_t capacity)
 	{
-		_orderList.Reserve(capacity);
+		_table.Reserve(capacity);
 	}
 
-	Scope::Scope(const Scope& other)
+	Scope::Scope(const Scope& other) :
+		_lazy(other._lazy), _isLazyPending(other._isLazyPending)
 	{
-		_orderList.Reserve(other._orderList.Capacity());
+		//	A placeholder's copy shares its content and stays a placeholder
+		if (_isLazyPending)
+		{
+			return;
+		}
+
+		_table.Reserve(other.Size());
 		
 		for (size_t i = 0; i < other.Size(); ++i)
 		{
-			auto [key, existingDatum] = *other._orderList[i];
+			const auto& [key, existingDatum] = other._table.At(i);
 			Datum& newDatum = Append(key);
 
 			if (existingDatum.Type() != Datum::DatumType::Table)
@@ -32,7 +62,7 @@ namespace FieaGameEngine
 
 				for (size_t j = 0; j < existingDatum.Size(); ++j)
 				{
-					Scope* s = (existingDatum[j]).Clone();
+					Scope* s = existingDatum.Get<Scope*>(j)->Clone();
 					s->_parent = this;
 					newDatum.PushBack(*s);
 				}
@@ -50,13 +80,13 @@ namespace FieaGameEngine
 			d[index] = *this;
 		}
 
-		_orderList = std::move(other._orderList);
 		_table = std::move(other._table);
 		_parent = other._parent;
 
 		for (size_t i = 0; i < Size(); ++i)
 		{
-			Datum& d = _orderList[i]->second;
+			Datum& d = _table.At(i).second;
+			d._owner = this;
 			if (d.Type() == Datum::DatumType::Table)
 			{
 				for (size_t j = 0; j < d.Size(); ++j)
@@ -66,9 +96,10 @@ namespace FieaGameEngine
 			}
 		}
 
+		_lazy = std::move(other._lazy);
+		_isLazyPending = std::exchange(other._isLazyPending, false);
+
 		other._table.Clear();
-		other._orderList.Clear();
-		other._orderList.ShrinkToFit();
 		other._parent = nullptr;
 	}
 
@@ -77,8 +108,6 @@ namespace FieaGameEngine
 		if (this != &other)
 		{
 			Clear();
-			_orderList.Clear();
-			_orderList.ShrinkToFit();
 
 			//	Update the Parent's pointer to it's new child.
 			if (other._parent != nullptr)
@@ -88,13 +117,13 @@ namespace FieaGameEngine
 				d[index] = *this;
 			}
 
-			_orderList = std::move(other._orderList);
 			_table = std::move(other._table);
 			_parent = other._parent;
 
 			for (size_t i = 0; i < Size(); ++i)
 			{
-				Datum& d = _orderList[i]->second;
+				Datum& d = _table.At(i).second;
+				d._owner = this;
 				if (d.Type() == Datum::DatumType::Table)
 				{
 					for (size_t j = 0; j < d.Size(); ++j)
@@ -104,9 +133,10 @@ namespace FieaGameEngine
 				}
 			}
 
+			_lazy = std::move(other._lazy);
+			_isLazyPending = std::exchange(other._isLazyPending, false);
+
 			other._table.Clear();
-			other._orderList.Clear();
-			other._orderList.ShrinkToFit();
 			other._parent = nullptr;
 		}
 		return *this;
@@ -117,14 +147,18 @@ namespace FieaGameEngine
 		if (this != &other)
 		{
 			Clear();
+			_lazy = other._lazy;
+			if (other._isLazyPending)
+			{
+				_isLazyPending = true;
+				return *this;
+			}
 
-			_orderList.Clear();
-			_orderList.ShrinkToFit();
-			_orderList.Reserve(other._orderList.Capacity());
+			_table.Reserve(other.Size());
 
 			for (size_t i = 0; i < other.Size(); ++i)
 			{
-				auto [key, existingDatum] = *other._orderList[i];
+				const auto& [key, existingDatum] = other._table.At(i);
 				Datum& newDatum = Append(key);
 
 				if (existingDatum.Type() != Datum::DatumType::Table)
@@ -138,7 +172,7 @@ namespace FieaGameEngine
 
 					for (size_t j = 0; j < existingDatum.Size(); ++j)
 					{
-						Scope* s = (existingDatum[j]).Clone();
+						Scope* s = existingDatum.Get<Scope*>(j)->Clone();
 						s->_parent = this;
 						newDatum.PushBack(*s);
 					}
@@ -176,7 +210,81 @@ namespace FieaGameEngine
 		child._parent = this;
 
 		//	Pushback the child into the datum
-		dp.PushBack(child);
+		size_t index = dp.PushBack(child);
+
+		if (ChangeJournal::IsEnabled())
+		{
+			ChangeJournal::Record(this, name, index, ChangeJournal::ChangeType::Adopt);
+		}
+	}
+
+	void Scope::Merge(Scope& other)
+	{
+		assert(&other != this);
+
+		for (size_t i = 0; i < other.Size(); ++i)
+		{
+			auto& [key, source] = other._table.At(i);
+			Datum& target = Append(key);
+
+			//	Same as parsing a value for an attribute of a prefab instance: it replaces the prefab's
+			if (target.IsShared())
+			{
+				target.Clear();
+			}
+
+			if (target.Type() == Datum::DatumType::Unknown)
+			{
+				target.SetType(source.Type());
+			}
+
+			if (source.Type() != Datum::DatumType::Unknown && target.Type() != source.Type())
+			{
+				throw runtime_error("Attempting to merge a key into a Datum of a different type. Scope::Merge()");
+			}
+
+			switch (source.Type())
+			{
+			case Datum::DatumType::Table:
+				target.Reserve(target.Size() + source.Size());
+				for (size_t j = 0; j < source.Size(); ++j)
+				{
+					//	Relinked directly, other's Datum is emptied in one go below instead of one Orphan at a time
+					Scope& child = source[j];
+					child._parent = this;
+					size_t index = target.PushBack(child);
+
+					if (ChangeJournal::IsEnabled())
+					{
+						ChangeJournal::Record(this, key, index, ChangeJournal::ChangeType::Adopt);
+					}
+				}
+				source.Clear();
+				break;
+			case Datum::DatumType::Float:
+				MergeValues<float>(target, source);
+				break;
+			case Datum::DatumType::Integer:
+				MergeValues<int>(target, source);
+				break;
+			case Datum::DatumType::Matrix:
+				MergeValues<mat4x4>(target, source);
+				break;
+			case Datum::DatumType::Pointer:
+				MergeValues<RTTI*>(target, source);
+				break;
+			case Datum::DatumType::String:
+				MergeValues<string>(target, source);
+				break;
+			case Datum::DatumType::Vector:
+				MergeValues<vec4>(target, source);
+				break;
+			default:
+				break;
+			}
+		}
+
+		other.Clear();
 	}
 
 	Datum& Scope::Append(const string& keyString)
@@ -186,11 +294,18 @@ namespace FieaGameEngine
 			throw invalid_argument("Cant append an empty keystring to Scope");
 		}
 		
+		EnsureMaterialized();
 		auto [it, wasInserted] = _table.Insert(make_pair(keyString, Datum()));
 
 		if (wasInserted)
 		{
-			_orderList.PushBack(&(*it));
+			it->second._owner = this;
+
+			if (ChangeJournal::IsEnabled())
+			{
+				MarkDirty();
+				ChangeJournal::Record(this, keyString, it.Index(), ChangeJournal::ChangeType::Append);
+			}
 		}
 		
 		return it->second;
@@ -220,33 +335,28 @@ namespace FieaGameEngine
 	void Scope::Clear()
 	{
 		Orphan();
+		DeleteChildren();
 
-		for (OrderListType::Iterator it = _orderList.begin(); it != _orderList.end(); ++it)
+		_table.Clear();
+		_lazy.reset();
+		_isLazyPending = false;
+
+		if (ChangeJournal::IsEnabled())
 		{
-			Datum& d = (*it)->second;
-			if (d.Type() == Datum::DatumType::Table)
-			{
-				for (size_t i = 0; i < d.Size(); ++i)
-				{
-					Scope& s = (d[i]);
-					s._parent = nullptr; // Short Circuit the orphan call
-					delete &s;
-					//return;
-				}
-			}
+			MarkDirty();
 		}
-		_table.Clear();
-		_orderList.Clear();
 	}
 
 	Datum* Scope::Find(const string& keyString)
 	{
+		EnsureMaterialized();
 		auto it = _table.Find(keyString);
 		return it != _table.end() ? &it->second : nullptr;
 	}
 
 	const Datum* Scope::Find(const string& keyString) const
 	{
+		EnsureMaterialized();
 		auto it = _table.Find(keyString);
 		return it != _table.end() ? &it->second : nullptr;
 	}
@@ -255,7 +365,7 @@ namespace FieaGameEngine
 	{
 		for (size_t i = 0; i < Size(); ++i)
 		{
-			Datum* d = &(_orderList[i]->second);
+			Datum* d = &(_table.At(i).second);
 			if (d->Type() == Datum::DatumType::Table)
 			{
 				for (size_t j = 0; j < d->Size(); ++j)
@@ -276,12 +386,12 @@ namespace FieaGameEngine
 	{
 		for (size_t i = 0; i < Size(); ++i)
 		{
-			Datum* d = &(_orderList[i]->second);
+			const Datum* d = &(_table.At(i).second);
 			if (d->Type() == Datum::DatumType::Table)
 			{
 				for (size_t j = 0; j < d->Size(); ++j)
 				{
-					if (((*d)[j]) == *sp)
+					if (*(d->Get<Scope*>(j)) == *sp)
 					{
 						index = j;
 						return d;
@@ -310,7 +420,29 @@ namespace FieaGameEngine
 			throw runtime_error("Attempting to dereference at an index greater than size. Scope::operator[].");
 		}
 
-		return _orderList[index]->second;
+		return _table.At(index).second;
+	}
+
+	const Scope::PairType& Scope::GetPair(size_t index) const
+	{
+		if (index >= Size())
+		{
+			throw runtime_error("Attempting to dereference at an index greater than size. Scope::GetPair().");
+		}
+
+		return _table.At(index);
+	}
+
+	AttributeView<Datum> Scope::Entries()
+	{
+		EnsureMaterialized();
+		return AttributeView<Datum>(_table, 0, Size());
+	}
+
+	AttributeView<const Datum> Scope::Entries() const
+	{
+		EnsureMaterialized();
+		return AttributeView<const Datum>(_table, 0, Size());
 	}
 
 	bool Scope::operator==(const Scope& other) const
@@ -324,7 +456,9 @@ namespace FieaGameEngine
 		for (size_t i = 0; i < Size(); ++i)
 		{
 			//	Compare keys in insertion order, then compare Datums. Datums of type table will recursively call this operator==()
-			if (_orderList[i]->first != other._orderList[i]->first || _orderList[i]->second != other._orderList[i]->second)
+			const PairType& lhs = _table.At(i);
+			const PairType& rhs = other._table.At(i);
+			if (lhs.first != rhs.first || lhs.second != rhs.second)
 			{
 				return false;
 			}
@@ -345,11 +479,199 @@ namespace FieaGameEngine
 			size_t index;
 			Datum* d = _parent->FindContainedScope(this, index);
 			assert(d != nullptr);
-			d->RemoveAt(index);
+
+			if (ChangeJournal::IsEnabled())
+			{
+				const string* key = _parent->FindKey(*d);
+				assert(key != nullptr);
+				ChangeJournal::Record(_parent, *key, index, ChangeJournal::ChangeType::Orphan);
+				d->_dirty = true;
+				_parent->MarkDirty();
+			}
+
+			{
+				//	The Orphan entry stands for the removal, which would otherwise be journaled again as a RemoveAt
+				ChangeJournal::Suppression suppression;
+				d->RemoveAt(index);
+			}
 			_parent = nullptr;
 		}
 	}
 
+	bool Scope::IsPrototype() const
+	{
+		return _isPrototype;
+	}
+
+	void Scope::SetLazyContent(std::shared_ptr<const LazyContent> content)
+	{
+		assert(content != nullptr);
+		if (TypeIdInstance() != Scope::TypeIdClass())
+		{
+			throw runtime_error("Only plain Scopes can be filled lazily. Scope::SetLazyContent()");
+		}
+
+		if (_isLazyPending || _table.IsEmpty() == false)
+		{
+			throw runtime_error("Attempting to make a Scope that isn't empty a placeholder. Scope::SetLazyContent()");
+		}
+
+		LazyContent::_deferred.fetch_add(1, memory_order_relaxed);
+		LazyContent::_deferredBytes.fetch_add(content->ByteSize(), memory_order_relaxed);
+		_lazy = std::move(content);
+		_isLazyPending = true;
+	}
+
+	bool Scope::IsLazy() const
+	{
+		return _isLazyPending;
+	}
+
+	void Scope::Materialize()
+	{
+		if (_isLazyPending == false)
+		{
+			return;
+		}
+
+		//	Cleared first, so the content's own writes into this Scope don't materialize it again
+		_isLazyPending = false;
+		const auto start = chrono::steady_clock::now();
+		try
+		{
+			//	Reading what the placeholder already stood for changes nothing the journal or a save should see
+			ChangeJournal::Suppression suppression;
+			_lazy->Materialize(*this);
+		}
+		catch (...)
+		{
+			DeleteChildren();
+			_table.Clear();
+			_isLazyPending = true;
+			throw;
+		}
+
+		LazyContent::_materializeTime.fetch_add((chrono::steady_clock::now() - start).count(), memory_order_relaxed);
+		LazyContent::_materialized.fetch_add(1, memory_order_relaxed);
+		LazyContent::_materializedBytes.fetch_add(_lazy->ByteSize(), memory_order_relaxed);
+	}
+
+	bool Scope::Evict()
+	{
+		if (_lazy == nullptr || _isLazyPending)
+		{
+			return false;
+		}
+
+		DeleteChildren();
+		_table.Clear();
+		_isLazyPending = true;
+
+		if (ChangeJournal::IsEnabled())
+		{
+			MarkDirty();
+		}
+
+		LazyContent::_evicted.fetch_add(1, memory_order_relaxed);
+		LazyContent::_evictedBytes.fetch_add(_lazy->ByteSize(), memory_order_relaxed);
+		return true;
+	}
+
+	void Scope::EnsureMaterialized() const
+	{
+		if (_isLazyPending)
+		{
+			const_cast<Scope*>(this)->Materialize();
+		}
+	}
+
+	void Scope::DeleteChildren()
+	{
+		for (TableType::Iterator it = _table.begin(); it != _table.end(); ++it)
+		{
+			Datum& d = it->second;
+			if (d.Type() == Datum::DatumType::Table)
+			{
+				for (size_t i = 0; i < d.Size(); ++i)
+				{
+					Scope& s = (d[i]);
+					s._parent = nullptr; // Short Circuit the orphan call
+					delete &s;
+				}
+			}
+		}
+	}
+
+	bool Scope::IsDirty() const
+	{
+		return _dirty;
+	}
+
+	void Scope::MarkDirty()
+	{
+		//	Dirty children always have dirty parents, so the walk can stop at the first dirty ancestor.
+		for (Scope* s = this; s != nullptr && s->_dirty == false; s = s->_parent)
+		{
+			s->_dirty = true;
+		}
+	}
+
+	void Scope::ClearDirty()
+	{
+		//	Dirty children always have dirty parents, so clean subtrees below this one can be pruned.
+		ScopeTraversal::ForEachScope(*this, [this](Scope& scope, size_t)
+		{
+			if (&scope != this && scope._dirty == false)
+			{
+				return false;
+			}
+
+			//	A placeholder has nothing to clear, and isn't filled just to clear it
+			scope._dirty = false;
+			if (scope._isLazyPending)
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < scope.Size(); ++i)
+			{
+				scope._table.At(i).second.ClearDirty();
+			}
+
+			return true;
+		});
+	}
+
+	std::uint64_t Scope::Serial() const
+	{
+		return _serial;
+	}
+
+	void Scope::RecordChange(const Datum& datum, size_t index, ChangeJournal::ChangeType type)
+	{
+		MarkDirty();
+
+		const string* key = FindKey(datum);
+		if (key != nullptr)
+		{
+			ChangeJournal::Record(this, *key, index, type);
+		}
+	}
+
+	const string* Scope::FindKey(const Datum& datum) const
+	{
+		for (size_t i = 0; i < Size(); ++i)
+		{
+			const PairType& pair = _table.At(i);
+			if (&pair.second == &datum)
+			{
+				return &pair.first;
+			}
+		}
+
+		return nullptr;
+	}
+
 	Datum* Scope::Search(const string& keyString, Scope*& scope)
 	{
 		Datum* retVal = Find(keyString);
@@ -402,7 +724,39 @@ namespace FieaGameEngine
 
 	size_t Scope::Size() const
 	{
-		return _orderList.Size();
+		EnsureMaterialized();
+		return _table.Size();
+	}
+
+	void* Scope::operator new(size_t size)
+	{
+		return ObjectPool::AllocateUnpooled(size);
+	}
+
+	void* Scope::operator new(size_t size, ObjectPool& pool)
+	{
+		assert(size <= pool.ObjectSize());
+		UNREFERENCED_LOCAL(size);
+		return pool.Allocate();
+	}
+
+	void* Scope::operator new(size_t, void* place) noexcept
+	{
+		return place;
+	}
+
+	void Scope::operator delete(void* object)
+	{
+		ObjectPool::Deallocate(object);
+	}
+
+	void Scope::operator delete(void* object, ObjectPool&)
+	{
+		ObjectPool::Deallocate(object);
+	}
+
+	void Scope::operator delete(void*, void*) noexcept
+	{
 	}
 
 	gsl::owner<Scope*> Scope::Clone() const
@@ -410,6 +764,26 @@ namespace FieaGameEngine
 		return new Scope(*this);
 	}
 
+	void Scope::AssignLayout(const TableType& layout)
+	{
+		assert(_table.IsEmpty());
+		_table = layout;
+
+		for (size_t i = 0; i < Size(); ++i)
+		{
+			_table.At(i).second._owner = this;
+		}
+
+		if (ChangeJournal::IsEnabled())
+		{
+			MarkDirty();
+			for (size_t i = 0; i < Size(); ++i)
+			{
+				ChangeJournal::Record(this, _table.At(i).first, i, ChangeJournal::ChangeType::Append);
+			}
+		}
+	}
+
 	bool Scope::Equals(const RTTI* rhs) const
 	{
 		const Scope* other = rhs->As<Scope>();
@@ -1,8 +1,14 @@
 #pragma once
 #include "Datum.h"
-#include "HashMap.h"
+#include "OrderedMap.h"
+#include "AttributeView.h"
 #include "Vector.h"
 #include "IFactory.h"
+#include "ObjectPool.h"
+#include "LazyContent.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 namespace FieaGameEngine
 {
@@ -17,23 +23,27 @@ namespace FieaGameEngine
 		/// </summary>
 		RTTI_DECLARATIONS(Scope, RTTI)
 
+		friend Datum;
+		friend class PrefabRegistry;
+		friend class SceneReloader;
+
 	public:
 		/// <summary>
-		/// PairType - Typedef for pair<const string, Datum>, used for HashMap as Tkey, TData
+		/// PairType - Typedef for pair<const string, Datum>, the entries of the _table.
 		/// </summary>
 		using PairType = pair<const string, Datum>;
 
 		/// <summary>
-		/// OrderListType - Typedef for Vector<PairType*>, used for the definition of the order list vector that maintains the order of insertion
-		/// for the Hashmap entries.
+		/// TableType - Typedef for the insertion ordered map that stores the pairs. Entries live contiguously in insertion order and never move,
+		/// so Datum references stay valid for the lifetime of the Scope.
 		/// </summary>
-		using OrderListType = Vector<PairType*>;
+		using TableType = OrderedMap<string, Datum>;
 
 		/// <summary>
-		/// TableIteratorType - Typedef for HashMap<string, Datum>::Iterator, the return type for the iterators returned when inserting in to the hashmap, dereferenced
-		/// to provide the PairType address that gets inserted into the order vector (to maintain order of entry).
+		/// SmallMapThreshold - Scopes with at most this many entries have no hash index and find keys by scanning their entries.
+		/// Most Actions and event messages stay below it and never allocate one.
 		/// </summary>
-		using TableIteratorType = HashMap<const string, Datum>::Iterator;
+		inline static const size_t SmallMapThreshold = TableType::LinearScanThreshold;
 
 #pragma region Scope Rule of 6
 
@@ -74,6 +84,46 @@ namespace FieaGameEngine
 		/// </summary>
 		virtual ~Scope();
 
+#pragma endregion
+
+#pragma region Pooled Allocation
+
+		/// <summary>
+		/// Operator new - Heap allocates a Scope (or a class derived from it) behind the header ObjectPool::Deallocate reads on delete.
+		/// </summary>
+		/// <param name="size">Size of the most derived object.</param>
+		/// <returns>Uninitialized storage for the object.</returns>
+		static void* operator new(size_t size);
+
+		/// <summary>
+		/// Operator new - Takes the storage for a Scope (or a class derived from it) from a pool. Used by ConcreteFactory, deleted with a plain delete.
+		/// </summary>
+		/// <param name="size">Size of the most derived object. Must not exceed the pool's object size.</param>
+		/// <param name="pool">Pool to allocate from.</param>
+		/// <returns>Uninitialized storage for the object.</returns>
+		static void* operator new(size_t size, ObjectPool& pool);
+
+		/// <summary>
+		/// Operator new - Placement form, constructs into storage the caller owns.
+		/// </summary>
+		static void* operator new(size_t size, void* place) noexcept;
+
+		/// <summary>
+		/// Operator delete - Returns pooled storage to its pool and frees the rest.
+		/// </summary>
+		/// <param name="object">Address of the deleted object.</param>
+		static void operator delete(void* object);
+
+		/// <summary>
+		/// Operator delete - Matches the pooled operator new, called if a constructor throws.
+		/// </summary>
+		static void operator delete(void* object, ObjectPool& pool);
+
+		/// <summary>
+		/// Operator delete - Matches the placement operator new, called if a constructor throws. Does nothing.
+		/// </summary>
+		static void operator delete(void* object, void* place) noexcept;
+
 #pragma endregion
 
 		/// <summary>
@@ -168,6 +218,14 @@ namespace FieaGameEngine
 		/// <exception cref="std::runtime_error">Attempting to Adopt a scope and pair it with a name that is already associated with a Datum - but the datum
 		/// is not of DatumType::Table - will throw a runtime error.</exception>
 		void Adopt(Scope& child, const string& name);
+
+		/// <summary>
+		/// Merge - Moves every entry of other into this Scope, in other's insertion order, as if other's keys had been parsed into this Scope after its own.
+		/// Nested Scopes are adopted rather than copied and values are appended to the Datum of the same key. Leaves other empty.
+		/// </summary>
+		/// <param name="other">The scope whose entries are moved. Must not be this Scope or one of its ancestors.</param>
+		/// <exception cref="std::runtime_error">Throws if a key of other holds a different type of data than the same key in this Scope.</exception>
+		void Merge(Scope& other);
 		
 		/// <summary>
 		/// GetParent - Returns the address to the parent of the scope.
@@ -183,14 +241,34 @@ namespace FieaGameEngine
 		Datum& operator[](const string& keyString);
 
 		/// <summary>
-		/// Operator[] - Operator[] where the argument is a size_t index that you pass in. This dereferences the _orderList vector at index
-		/// and returns the reference to the datum in that pair.
+		/// Operator[] - Operator[] where the argument is a size_t index that you pass in. Returns the datum of the pair inserted at that index.
 		/// </summary>
 		/// <param name="index">Which entry within the Scope you wish to access the datum of.</param>
 		/// <returns>Reference to the datum member at the passed index.</returns>
 		/// <exception cref="runtime_error">Attempting to Access an index >= _size will go out of bounds and throw a runtime error.</exception>
 		Datum& operator[](size_t index);
 
+		/// <summary>
+		/// GetPair - Returns the (key, Datum) pair at the passed insertion index, for read only walks that need the keys as well as the values.
+		/// </summary>
+		/// <param name="index">Which entry within the Scope you wish to access.</param>
+		/// <returns>Constant reference to the pair at the passed index.</returns>
+		/// <exception cref="runtime_error">Attempting to Access an index >= _size will go out of bounds and throw a runtime error.</exception>
+		const PairType& GetPair(size_t index) const;
+
+		/// <summary>
+		/// Entries - Returns a view of every (key, Datum, index) in insertion order. Walks the table in place without allocating.
+		/// Plain Scopes have no prescribed attributes, so isPrescribed is always false - see Attributed::AttributeEntries().
+		/// </summary>
+		/// <returns>View over all of the Scope's entries.</returns>
+		AttributeView<Datum> Entries();
+
+		/// <summary>
+		/// Entries - Returns a view of every (key, Datum, index) in insertion order. Walks the table in place without allocating. Const version
+		/// </summary>
+		/// <returns>Read only view over all of the Scope's entries.</returns>
+		AttributeView<const Datum> Entries() const;
+
 		/// <summary>
 		/// Operator== - Compares Two scopes for equality (not just sameness). Recursively walks through nested children.
 		/// Compares keyStrings and datums for every pair within the Scope.
@@ -213,10 +291,79 @@ namespace FieaGameEngine
 		size_t Size() const;
 
 		/// <summary>
-		/// Clear - Walks the Scope and clears all datums within (and children nested scopes). Also calls Clear on the Hashmap _table.
+		/// Clear - Walks the Scope and deletes all nested child scopes, then clears the _table.
 		/// </summary>
 		void Clear();
 
+#pragma region Change Tracking
+
+		/// <summary>
+		/// IsDirty - Returns whether this Scope, or anything beneath it, has changed since the last ClearDirty(). Scopes start out dirty.
+		/// A clean Scope guarantees its whole subtree is clean, so savers can skip it in O(1). Only maintained while the ChangeJournal is enabled.
+		/// </summary>
+		/// <returns>True if this subtree needs to be saved.</returns>
+		bool IsDirty() const;
+
+		/// <summary>
+		/// MarkDirty - Marks this Scope and its ancestors dirty, stopping at the first ancestor that already is.
+		/// Call after writes the tracking can't see, such as direct writes to an Attributed member or through a non-const Get() reference.
+		/// </summary>
+		void MarkDirty();
+
+		/// <summary>
+		/// ClearDirty - Clears the dirty bits of this Scope, its Datums, and every dirty nested Scope. Clean subtrees are not visited.
+		/// </summary>
+		void ClearDirty();
+
+		/// <summary>
+		/// Serial - Returns a number identifying this Scope for the life of the process. Unlike its address it is never reused by another Scope,
+		/// so it can key caches that outlive the Scopes in them.
+		/// </summary>
+		/// <returns>This Scope's serial.</returns>
+		std::uint64_t Serial() const;
+
+#pragma endregion
+
+		/// <summary>
+		/// IsPrototype - Returns whether this Scope belongs to a prefab registered with the PrefabRegistry. Copies of a prototype
+		/// share its Datums copy on write instead of copying them.
+		/// </summary>
+		/// <returns>True if this Scope is part of a registered prefab.</returns>
+		bool IsPrototype() const;
+
+#pragma region Lazy Materialization
+
+		/// <summary>
+		/// SetLazyContent - Makes this empty Scope a placeholder for content, which fills it the first time it is accessed: through Find, Search,
+		/// Append, operator[], GetPair, Entries, Size, or anything built on them. Copies of a placeholder share its content and stay placeholders.
+		/// Filling a placeholder writes to it even through a const Scope, so const reads of a placeholder from several threads at once aren't safe.
+		/// </summary>
+		/// <param name="content">What the Scope stands for.</param>
+		/// <exception cref="std::runtime_error">Throws if the Scope isn't empty, or isn't a plain Scope - an Attributed one has prescribed attributes.</exception>
+		void SetLazyContent(std::shared_ptr<const LazyContent> content);
+
+		/// <summary>
+		/// IsLazy - Returns whether this Scope is a placeholder whose content hasn't been materialized. Doesn't materialize it.
+		/// </summary>
+		/// <returns>True if the Scope is waiting to be filled.</returns>
+		bool IsLazy() const;
+
+		/// <summary>
+		/// Materialize - Fills a placeholder from its content now rather than on its first access. Does nothing for other Scopes.
+		/// The Scope holds what it held before, only no longer lazily, so filling it isn't journaled and marks nothing dirty.
+		/// If the content fails to materialize, the Scope is left an empty placeholder.
+		/// </summary>
+		void Materialize();
+
+		/// <summary>
+		/// Evict - Turns a Scope that was filled from lazy content back into a placeholder, deleting everything in it. Runtime changes to the
+		/// subtree are lost, and pointers into it dangle.
+		/// </summary>
+		/// <returns>True if the Scope was evicted, false if it has no lazy content or isn't materialized.</returns>
+		bool Evict();
+
+#pragma endregion
+
 #pragma region RTTI Overrides
 
 		/// <summary>
@@ -235,11 +382,68 @@ namespace FieaGameEngine
 		/// </summary>
 		void Orphan();
 
+		/// <summary>
+		/// RecordChange - Called by a Datum owned by this Scope when it is mutated while the ChangeJournal is enabled. Marks this Scope
+		/// dirty and journals the change under the Datum's key.
+		/// </summary>
+		/// <param name="datum">The mutated Datum, which must be owned by this Scope.</param>
+		/// <param name="index">Index within the Datum that was mutated.</param>
+		/// <param name="type">The kind of mutation.</param>
+		void RecordChange(const Datum& datum, size_t index, ChangeJournal::ChangeType type);
+
+		/// <summary>
+		/// FindKey - Returns the key paired with the given Datum in this scope. Linear in Size(), only used while journaling.
+		/// </summary>
+		/// <param name="datum">The Datum whose key you are looking for.</param>
+		/// <returns>Address of the key, nullptr if the Datum isn't stored in this Scope.</returns>
+		const string* FindKey(const Datum& datum) const;
+
+		/// <summary>
+		/// EnsureMaterialized - Fills this Scope from its lazy content if it is still a placeholder. Logically const: reading a placeholder reads its content.
+		/// Not safe to race with another EnsureMaterialized of the same placeholder.
+		/// </summary>
+		void EnsureMaterialized() const;
+
+		/// <summary>
+		/// DeleteChildren - Deletes every nested Scope without orphaning this one. Leaves the Table Datums holding dangling pointers, for the caller to clear.
+		/// </summary>
+		void DeleteChildren();
+
 		/// <summary>
 		/// Pointer to the parent Scope of this scope if this is nested. nullptr if this is a root scope.
 		/// </summary>
 		Scope* _parent = nullptr;
 
+		/// <summary>
+		/// Dirty bit - see IsDirty(). Starts true so that new Scopes are always saved at least once.
+		/// </summary>
+		bool _dirty = true;
+
+		/// <summary>
+		/// Set by PrefabRegistry::Register() on every Scope of a prefab. Not carried over by copies or moves.
+		/// </summary>
+		bool _isPrototype = false;
+
+		/// <summary>
+		/// See Serial(). Copies and moves are new Scopes and get their own.
+		/// </summary>
+		std::uint64_t _serial = _nextSerial.fetch_add(1, std::memory_order_relaxed);
+
+		/// <summary>
+		/// Next serial to hand out. Atomic as Scopes are built on worker threads.
+		/// </summary>
+		inline static std::atomic<std::uint64_t> _nextSerial{ 1 };
+
+		/// <summary>
+		/// Content this Scope was, or is to be, filled from. Kept once materialized so the Scope can be evicted.
+		/// </summary>
+		std::shared_ptr<const LazyContent> _lazy;
+
+		/// <summary>
+		/// Whether this Scope is a placeholder waiting for _lazy to fill it. A placeholder's table is always empty.
+		/// </summary>
+		bool _isLazyPending = false;
+
 	protected:
 
 		/// <summary>
@@ -249,14 +453,16 @@ namespace FieaGameEngine
 		virtual gsl::owner<Scope*> Clone() const;
 
 		/// <summary>
-		/// HashMap of string, Datum pairs that is used as the basis of the table for scope.
+		/// AssignLayout - Fills this empty Scope with a copy of a prebuilt table (see TypeManager::GetLayoutForType()) in one pass, index included,
+		/// and takes ownership of the copied Datums.
 		/// </summary>
-		HashMap<string, Datum> _table;
+		/// <param name="layout">The table to copy.</param>
+		void AssignLayout(const TableType& layout);
 
 		/// <summary>
-		/// Vector of PairType addresses that is used to maintain insertion order and provide quick access to the locations of string, Datum pairs.
+		/// Insertion ordered map of string, Datum pairs that is used as the basis of the table for scope.
 		/// </summary>
-		OrderListType _orderList;
+		TableType _table;
 	};
 
 	ConcreteFactory(Scope, Scope)
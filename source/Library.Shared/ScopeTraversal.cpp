@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "ScopeTraversal.h"
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		//	Consumed BreadthFirst entries are only shifted out once there are at least this many of them.
+		const size_t QueueCompactThreshold = 256;
+	}
+
+#pragma region Iterator
+
+	ScopeTraversal::Iterator::Iterator(Scope& root, Order order, size_t depth) :
+		_current{ &root, depth }, _order(order)
+	{
+	}
+
+	Scope& ScopeTraversal::Iterator::operator*() const
+	{
+		if (_current._scope == nullptr)
+		{
+			throw std::runtime_error("Attempting to dereference the end of a ScopeTraversal.");
+		}
+
+		return *_current._scope;
+	}
+
+	Scope* ScopeTraversal::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+	ScopeTraversal::Iterator& ScopeTraversal::Iterator::operator++()
+	{
+		if (_current._scope == nullptr)
+		{
+			throw std::runtime_error("Attempting to increment past the end of a ScopeTraversal.");
+		}
+
+		if (_skipChildren == false)
+		{
+			Expand();
+		}
+		_skipChildren = false;
+
+		if (_order == Order::DepthFirst)
+		{
+			if (_frontier.IsEmpty())
+			{
+				_current = Visit{ nullptr, 0 };
+				return *this;
+			}
+
+			_current = _frontier.Back();
+			_frontier.PopBack();
+
+			//	Start loading the next scope while the caller works on this one.
+			if (!_frontier.IsEmpty())
+			{
+				Prefetch(_frontier.Back()._scope);
+			}
+		}
+		else
+		{
+			if (_head == _frontier.Size())
+			{
+				_frontier.Clear();
+				_head = 0;
+				_current = Visit{ nullptr, 0 };
+				return *this;
+			}
+
+			_current = _frontier[_head++];
+
+			if (_head < _frontier.Size())
+			{
+				Prefetch(_frontier[_head]._scope);
+			}
+
+			//	Shift the unread part of the queue down once the consumed part dominates, so wide trees don't hold on to every visit.
+			if (_head >= QueueCompactThreshold && _head * 2 >= _frontier.Size())
+			{
+				size_t remaining = _frontier.Size() - _head;
+				for (size_t i = 0; i < remaining; ++i)
+				{
+					_frontier[i] = _frontier[_head + i];
+				}
+				_frontier.Resize(remaining);
+				_head = 0;
+			}
+		}
+
+		return *this;
+	}
+
+	ScopeTraversal::Iterator ScopeTraversal::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		operator++();
+		return temp;
+	}
+
+	bool ScopeTraversal::Iterator::operator==(const Iterator& other) const
+	{
+		return _current._scope == other._current._scope;
+	}
+
+	bool ScopeTraversal::Iterator::operator!=(const Iterator& other) const
+	{
+		return !(operator==(other));
+	}
+
+	size_t ScopeTraversal::Iterator::Depth() const
+	{
+		return _current._depth;
+	}
+
+	void ScopeTraversal::Iterator::SkipChildren()
+	{
+		_skipChildren = true;
+	}
+
+	void ScopeTraversal::Iterator::Expand()
+	{
+		size_t first = _frontier.Size();
+		AppendChildren(*_current._scope, _current._depth, _frontier);
+
+		if (_order == Order::DepthFirst)
+		{
+			//	Reverse the new entries so the first child ends up on top of the stack.
+			for (size_t i = first, j = _frontier.Size(); i + 1 < j; ++i, --j)
+			{
+				std::swap(_frontier[i], _frontier[j - 1]);
+			}
+		}
+	}
+
+#pragma endregion
+
+	ScopeTraversal::ScopeTraversal(Scope& root, Order order) :
+		_root(&root), _order(order)
+	{
+	}
+
+	ScopeTraversal::Iterator ScopeTraversal::begin() const
+	{
+		return Iterator(*_root, _order, 0);
+	}
+
+	ScopeTraversal::Iterator ScopeTraversal::end() const
+	{
+		return Iterator();
+	}
+
+	void ScopeTraversal::AppendChildren(Scope& scope, size_t depth, Vector<Visit>& frontier)
+	{
+		for (size_t i = 0; i < scope.Size(); ++i)
+		{
+			Datum& d = scope[i];
+			if (d.Type() == Datum::DatumType::Table)
+			{
+				for (size_t j = 0; j < d.Size(); ++j)
+				{
+					frontier.PushBack(Visit{ &d[j], depth + 1 });
+				}
+			}
+		}
+	}
+}
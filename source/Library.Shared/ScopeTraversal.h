@@ -0,0 +1,250 @@
+#pragma once
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// ScopeTraversal - Non-recursive walks over a Scope tree. A "visit" is a (Scope, depth) pair, the root being at depth 0.
+	/// Iteration keeps its pending scopes on an explicit heap allocated frontier, so tree depth never grows the call stack,
+	/// and prefetches the scope that will be visited next while the current one is being processed.
+	/// Every scope is visited exactly once and always after its parent. The tree must not be restructured (Adopt/Orphan/Clear)
+	/// while it is being walked, though the Datums of the scope being visited may be freely written.
+	/// </summary>
+	class ScopeTraversal final
+	{
+	public:
+
+		/// <summary>
+		/// Order - DepthFirst visits in pre-order, children in insertion order. BreadthFirst visits level by level.
+		/// </summary>
+		enum class Order
+		{
+			DepthFirst,
+			BreadthFirst
+		};
+
+		/// <summary>
+		/// Visit - A scope that has been reached by the traversal and its depth below the root.
+		/// </summary>
+		struct Visit final
+		{
+			Scope* _scope;
+			size_t _depth;
+		};
+
+		/// <summary>
+		/// Iterator - Forward iterator over the scopes of a tree. Copying an iterator copies its frontier.
+		/// </summary>
+		class Iterator final
+		{
+			friend ScopeTraversal;
+
+		public:
+
+			/// <summary>
+			/// Default constructor - Creates an end iterator.
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Defaulted copy constructor.
+			/// </summary>
+			Iterator(const Iterator& other) = default;
+
+			/// <summary>
+			/// Defaulted move constructor.
+			/// </summary>
+			Iterator(Iterator&& other) noexcept = default;
+
+			/// <summary>
+			/// Defaulted copy assignment.
+			/// </summary>
+			Iterator& operator=(const Iterator& other) = default;
+
+			/// <summary>
+			/// Defaulted move assignment.
+			/// </summary>
+			Iterator& operator=(Iterator&& other) noexcept = default;
+
+			/// <summary>
+			/// Defaulted destructor.
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Dereference operator - Returns the scope currently being visited.
+			/// </summary>
+			/// <returns>Reference to the current scope.</returns>
+			/// <exception cref="std::runtime_error">Throws if the iterator is at the end.</exception>
+			Scope& operator*() const;
+
+			/// <summary>
+			/// Arrow operator - Returns the address of the scope currently being visited.
+			/// </summary>
+			/// <returns>Address of the current scope.</returns>
+			/// <exception cref="std::runtime_error">Throws if the iterator is at the end.</exception>
+			Scope* operator->() const;
+
+			/// <summary>
+			/// Pre-increment - Queues the children of the current scope (unless SkipChildren was called) and moves to the next scope.
+			/// </summary>
+			/// <returns>Reference to this iterator.</returns>
+			/// <exception cref="std::runtime_error">Throws if the iterator is at the end.</exception>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Post-increment - Same as pre-increment, returning a copy of the iterator from before the increment.
+			/// </summary>
+			/// <returns>Copy of the iterator before it was incremented.</returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Equality operator - Iterators are equal if they are visiting the same scope. All end iterators are equal.
+			/// </summary>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// Inequality operator.
+			/// </summary>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// Depth - Returns the depth of the current scope below the traversal root.
+			/// </summary>
+			/// <returns>0 for the root, 1 for its children and so on.</returns>
+			size_t Depth() const;
+
+			/// <summary>
+			/// SkipChildren - Prunes the subtree below the current scope. The next increment moves on without visiting any of its descendants.
+			/// </summary>
+			void SkipChildren();
+
+		private:
+
+			/// <summary>
+			/// Constructor - Starts a traversal at root, reporting depths offset by depth.
+			/// </summary>
+			Iterator(Scope& root, Order order, size_t depth);
+
+			/// <summary>
+			/// Expand - Queues the children of the current scope on the frontier.
+			/// </summary>
+			void Expand();
+
+			/// <summary>
+			/// Pending scopes. Used as a stack for DepthFirst and as a queue, read from _head, for BreadthFirst.
+			/// </summary>
+			Vector<Visit> _frontier;
+
+			/// <summary>
+			/// Read position of the BreadthFirst queue.
+			/// </summary>
+			size_t _head = 0;
+
+			/// <summary>
+			/// Scope currently being visited. nullptr at the end.
+			/// </summary>
+			Visit _current{ nullptr, 0 };
+
+			/// <summary>
+			/// Visiting order.
+			/// </summary>
+			Order _order = Order::DepthFirst;
+
+			/// <summary>
+			/// Set by SkipChildren, reset on increment.
+			/// </summary>
+			bool _skipChildren = false;
+		};
+
+		/// <summary>
+		/// Constructor - Describes a traversal of the tree below root, which can be walked with begin()/end() and range based for.
+		/// </summary>
+		/// <param name="root">Scope the traversal starts at. Its parents are never visited.</param>
+		/// <param name="order">Visiting order.</param>
+		explicit ScopeTraversal(Scope& root, Order order = Order::DepthFirst);
+
+		/// <summary>
+		/// begin - Returns an iterator at the root.
+		/// </summary>
+		Iterator begin() const;
+
+		/// <summary>
+		/// end - Returns the end iterator.
+		/// </summary>
+		Iterator end() const;
+
+		/// <summary>
+		/// ForEachScope - Calls visit(Scope&, size_t depth) for every scope in the tree below (and including) root.
+		/// If visit returns bool, returning false skips the children of that scope.
+		/// </summary>
+		/// <param name="root">Scope the traversal starts at.</param>
+		/// <param name="visit">Callable taking (Scope&, size_t), returning void or bool.</param>
+		/// <param name="order">Visiting order.</param>
+		template <typename Visitor>
+		static void ForEachScope(Scope& root, Visitor visit, Order order = Order::DepthFirst);
+
+		/// <summary>
+		/// ParallelForEachScope - Calls visit(Scope&, size_t depth) for every scope in the tree below (and including) root, splitting
+		/// independent subtrees across worker threads. The top levels are visited breadth first on the calling thread until there are enough
+		/// subtrees to keep every worker busy; workers then claim whole subtrees and walk them depth first.
+		/// A scope is always visited after its parent, but there is no ordering between siblings or between subtrees.
+		/// visit runs concurrently on different scopes, so it must only touch the scope it is given (and data it synchronizes itself).
+		/// It must not Append to scopes other than its own or write Datums while the ChangeJournal is enabled, as the journal isn't thread safe.
+		/// If visit throws, workers stop claiming subtrees and the first exception is rethrown on the calling thread once all workers have joined.
+		/// </summary>
+		/// <param name="root">Scope the traversal starts at.</param>
+		/// <param name="visit">Thread safe callable taking (Scope&, size_t), returning void or bool (false skips the children).</param>
+		/// <param name="threadCount">Number of threads to use, including the calling thread. 0 uses std::thread::hardware_concurrency().</param>
+		template <typename Visitor>
+		static void ParallelForEachScope(Scope& root, Visitor visit, size_t threadCount = 0);
+
+		/// <summary>
+		/// Prefetch - Hints the processor to start loading the cache line at address. Never faults, a no-op where unsupported.
+		/// </summary>
+		/// <param name="address">Address to load.</param>
+		static void Prefetch(const void* address);
+
+		/// <summary>
+		/// Minimum number of subtrees handed out per worker by ParallelForEachScope, so that uneven subtrees still balance out.
+		/// </summary>
+		inline static const size_t SubtreesPerThread = 4;
+
+	private:
+
+		/// <summary>
+		/// VisitOne - Calls visit on a single scope, returning whether its children should be visited.
+		/// </summary>
+		template <typename Visitor>
+		static bool VisitOne(Visitor& visit, Scope& scope, size_t depth);
+
+		/// <summary>
+		/// VisitSubtree - Depth first walk of the tree below root, with depths offset by depth.
+		/// </summary>
+		template <typename Visitor>
+		static void VisitSubtree(Scope& root, size_t depth, Visitor& visit, Order order);
+
+		/// <summary>
+		/// AppendChildren - Pushes every nested scope of scope, in insertion order, onto frontier at depth + 1.
+		/// </summary>
+		static void AppendChildren(Scope& scope, size_t depth, Vector<Visit>& frontier);
+
+		/// <summary>
+		/// Root of the traversal.
+		/// </summary>
+		Scope* _root;
+
+		/// <summary>
+		/// Visiting order.
+		/// </summary>
+		Order _order;
+	};
+}
+
+#include "ScopeTraversal.inl"
@@ -0,0 +1,145 @@
+#include "ScopeTraversal.h"
+#include <algorithm>
+#include <system_error>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace FieaGameEngine
+{
+	inline void ScopeTraversal::Prefetch(const void* address)
+	{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#else
+		UNREFERENCED_LOCAL(address);
+#endif
+	}
+
+	template <typename Visitor>
+	inline bool ScopeTraversal::VisitOne(Visitor& visit, Scope& scope, size_t depth)
+	{
+		if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, Scope&, size_t>, bool>)
+		{
+			return visit(scope, depth);
+		}
+		else
+		{
+			visit(scope, depth);
+			return true;
+		}
+	}
+
+	template <typename Visitor>
+	void ScopeTraversal::VisitSubtree(Scope& root, size_t depth, Visitor& visit, Order order)
+	{
+		for (Iterator it(root, order, depth); it._current._scope != nullptr; ++it)
+		{
+			if (VisitOne(visit, *it._current._scope, it._current._depth) == false)
+			{
+				it.SkipChildren();
+			}
+		}
+	}
+
+	template <typename Visitor>
+	inline void ScopeTraversal::ForEachScope(Scope& root, Visitor visit, Order order)
+	{
+		VisitSubtree(root, 0, visit, order);
+	}
+
+	template <typename Visitor>
+	void ScopeTraversal::ParallelForEachScope(Scope& root, Visitor visit, size_t threadCount)
+	{
+		if (threadCount == 0)
+		{
+			threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		}
+
+		if (threadCount == 1)
+		{
+			VisitSubtree(root, 0, visit, Order::DepthFirst);
+			return;
+		}
+
+		//	Visit the top of the tree a level at a time until there are enough unvisited subtrees to share out.
+		const size_t targetSubtrees = threadCount * SubtreesPerThread;
+		Vector<Visit> subtrees;
+		subtrees.PushBack(Visit{ &root, 0 });
+
+		while (!subtrees.IsEmpty() && subtrees.Size() < targetSubtrees)
+		{
+			Vector<Visit> nextLevel(subtrees.Size() * 2);
+			for (size_t i = 0; i < subtrees.Size(); ++i)
+			{
+				Visit& v = subtrees[i];
+				if (VisitOne(visit, *v._scope, v._depth))
+				{
+					AppendChildren(*v._scope, v._depth, nextLevel);
+				}
+			}
+			subtrees = std::move(nextLevel);
+		}
+
+		if (subtrees.IsEmpty())
+		{
+			return;
+		}
+
+		std::atomic<size_t> nextSubtree{ 0 };
+		std::atomic<bool> failed{ false };
+		std::exception_ptr error;
+		std::mutex errorMutex;
+
+		auto worker = [&]()
+		{
+			try
+			{
+				for (size_t i = nextSubtree++; i < subtrees.Size() && failed == false; i = nextSubtree++)
+				{
+					VisitSubtree(*subtrees[i]._scope, subtrees[i]._depth, visit, Order::DepthFirst);
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (error == nullptr)
+				{
+					error = std::current_exception();
+				}
+				failed = true;
+			}
+		};
+
+		//	The calling thread is one of the workers.
+		const size_t spawnCount = std::min(threadCount, subtrees.Size()) - 1;
+		Vector<std::thread> workers(spawnCount);
+
+		try
+		{
+			for (size_t i = 0; i < spawnCount; ++i)
+			{
+				workers.PushBack(std::thread(worker));
+			}
+		}
+		catch (const std::system_error&)
+		{
+			//	Out of threads - whoever did start, plus this thread, still drain the whole list.
+		}
+
+		worker();
+
+		for (size_t i = 0; i < workers.Size(); ++i)
+		{
+			workers[i].join();
+		}
+
+		if (error != nullptr)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+}
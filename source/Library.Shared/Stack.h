@@ -1,13 +1,24 @@
 #pragma once
 
-#include "SList.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Stack - Last in first out adaptor over a Vector. Frames sit next to each other and popping keeps the capacity, so a stack that has
+	/// reached its working depth pushes without allocating. Pushing may move the frames, references from Peek don't survive a Push.
+	/// </summary>
+	/// <typeparam name="T">Generic Objects</typeparam>
 	template <typename T>
 	class Stack final
 	{
 	public:
+		/// <summary>
+		/// Constructor - Reserves room for capacity frames up front.
+		/// </summary>
+		/// <param name="capacity">Number of frames that can be pushed before the stack allocates.</param>
+		explicit Stack(std::size_t capacity = 0);
+
 		void Push(const T& value);
 		void Push(T&& value);
 		void Pop();
@@ -17,11 +28,14 @@ namespace FieaGameEngine
 		std::size_t Size() const;		
 		bool IsEmpty() const;
 
+		/// <summary>
+		/// Clear - Pops every frame, keeping the capacity for the next use.
+		/// </summary>
 		void Clear();
 
 	private:
-		SList<T> _list;
+		Vector<T> _frames;
 	};
 }
 
-#include "Stack.inl"
\ No newline at end of file
+#include "Stack.inl"
@@ -1,50 +1,56 @@
 namespace FieaGameEngine
 {
+	template <typename T>
+	inline Stack<T>::Stack(std::size_t capacity) :
+		_frames(capacity)
+	{
+	}
+
 	template <typename T>
 	inline void Stack<T>::Push(const T& value)
 	{
-		_list.PushFront(value);
+		_frames.PushBack(value);
 	}
 
 	template <typename T>
 	inline void Stack<T>::Push(T&& value)
 	{
-		_list.PushFront(std::move(value));
+		_frames.PushBack(std::move(value));
 	}
 
 	template <typename T>
 	inline void Stack<T>::Pop()
 	{
-		_list.PopFront();
+		_frames.PopBack();
 	}
 
 	template <typename T>
 	inline T& Stack<T>::Peek()
 	{
-		return _list.Front();
+		return _frames.Back();
 	}
 
 	template <typename T>
 	inline const T& Stack<T>::Peek() const
 	{
-		return _list.Front();
+		return _frames.Back();
 	}
 
 	template <typename T>
 	inline std::size_t Stack<T>::Size() const
 	{
-		return _list.Size();
+		return _frames.Size();
 	}
 
 	template <typename T>
 	inline bool Stack<T>::IsEmpty() const
 	{
-		return _list.IsEmpty();
+		return _frames.IsEmpty();
 	}
 
 	template <typename T>
 	inline void Stack<T>::Clear()
 	{
-		return _list.Clear();
+		_frames.Clear();
 	}
 }
\ No newline at end of file
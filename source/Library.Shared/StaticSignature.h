@@ -0,0 +1,224 @@
+#pragma once
+#include <string_view>
+#include <type_traits>
+#include "Datum.h"
+#include "DefaultHash.h"
+
+namespace FieaGameEngine
+{
+	class Scope;
+
+	/// <summary>
+	/// StaticSignature struct - Compile time description of a prescribed member. Built with REFLECT_FIELD and REFLECT_TABLE into constexpr arrays,
+	/// so a type's attributes are declared once, checked against the members by the compiler, and cost nothing until the type is registered.
+	/// </summary>
+	struct StaticSignature final
+	{
+		/// <summary>
+		/// Name of the prescribed member
+		/// </summary>
+		std::string_view name;
+
+		/// <summary>
+		/// type of the prescribed member
+		/// </summary>
+		Datum::DatumType type;
+
+		/// <summary>
+		/// Number of elements in the prescribed member
+		/// </summary>
+		size_t size;
+
+		/// <summary>
+		/// Offset of the prescribed member (&class + member location)
+		/// </summary>
+		size_t offset;
+
+		/// <summary>
+		/// Hash of the name, computed at compile time. Equal to DefaultHash&lt;std::string&gt; of the same name.
+		/// </summary>
+		size_t nameHash;
+	};
+
+	/// <summary>
+	/// DatumTypeOf - Maps the element type of a reflected member to the DatumType that stores it. Unknown for types a Datum can't hold.
+	/// </summary>
+	template <typename T>
+	struct DatumTypeOf
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Unknown;
+	};
+
+	template <>
+	struct DatumTypeOf<int>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Integer;
+	};
+
+	template <>
+	struct DatumTypeOf<float>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Float;
+	};
+
+	template <>
+	struct DatumTypeOf<glm::vec4>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Vector;
+	};
+
+	template <>
+	struct DatumTypeOf<glm::mat4>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Matrix;
+	};
+
+	template <>
+	struct DatumTypeOf<std::string>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::String;
+	};
+
+	template <>
+	struct DatumTypeOf<RTTI*>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Pointer;
+	};
+
+	template <>
+	struct DatumTypeOf<Scope>
+	{
+		static constexpr Datum::DatumType value = Datum::DatumType::Table;
+	};
+
+	/// <summary>
+	/// ReflectField - Builds the StaticSignature of a data member. The type and element count come from the member's declaration and the offset
+	/// is checked against the class, so a signature can't disagree with the member it describes. Use through REFLECT_FIELD.
+	/// </summary>
+	/// <typeparam name="TClass">The class being reflected.</typeparam>
+	/// <typeparam name="TMember">Declared type of the member - a supported type or a one dimensional array of one.</typeparam>
+	/// <typeparam name="Offset">offsetof(TClass, member).</typeparam>
+	/// <param name="name">Attribute name the member is bound to.</param>
+	/// <returns>The member's signature.</returns>
+	template <typename TClass, typename TMember, size_t Offset>
+	constexpr StaticSignature ReflectField(std::string_view name)
+	{
+		using ElementType = std::remove_all_extents_t<TMember>;
+		constexpr Datum::DatumType type = DatumTypeOf<ElementType>::value;
+
+		static_assert(type != Datum::DatumType::Unknown, "Reflected members must be int, float, vec4, mat4, std::string, RTTI* or Scope, or arrays of one of them.");
+		static_assert(std::rank_v<TMember> <= 1, "Reflected arrays must be one dimensional.");
+		static_assert(Offset % alignof(ElementType) == 0, "Reflected member offset is misaligned for its type.");
+		static_assert(Offset + sizeof(TMember) <= sizeof(TClass), "Reflected member lies outside of its class.");
+
+		return StaticSignature{ name, type, std::is_array_v<TMember> ? std::extent_v<TMember> : 1, Offset, AdditiveHash(name) };
+	}
+
+	/// <summary>
+	/// ReflectTable - Builds the StaticSignature of a table attribute that is not backed by a member. Use through REFLECT_TABLE.
+	/// </summary>
+	/// <param name="name">Attribute name.</param>
+	/// <param name="count">Number of nested Scopes created with each instance.</param>
+	/// <returns>The table's signature.</returns>
+	constexpr StaticSignature ReflectTable(std::string_view name, size_t count)
+	{
+		return StaticSignature{ name, Datum::DatumType::Table, count, 0, AdditiveHash(name) };
+	}
+
+	/// <summary>
+	/// HasUniqueNames - Compile time check that no two signatures of a type share a name.
+	/// </summary>
+	/// <param name="signatures">Signature array to check.</param>
+	/// <returns>True if every name is unique.</returns>
+	template <size_t Count>
+	constexpr bool HasUniqueNames(const StaticSignature (&signatures)[Count])
+	{
+		for (size_t i = 0; i < Count; ++i)
+		{
+			for (size_t j = i + 1; j < Count; ++j)
+			{
+				if (signatures[i].nameHash == signatures[j].nameHash && signatures[i].name == signatures[j].name)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/// <summary>
+	/// StaticSignatureList Class - Non owning view of a constexpr StaticSignature array, as returned by a type's StaticSignatures().
+	/// </summary>
+	class StaticSignatureList final
+	{
+	public:
+		/// <summary>
+		/// Default Constructor - An empty list, for types without prescribed attributes.
+		/// </summary>
+		constexpr StaticSignatureList() = default;
+
+		/// <summary>
+		/// Constructor - Views a static signature array.
+		/// </summary>
+		/// <param name="signatures">Array with static storage duration.</param>
+		template <size_t Count>
+		constexpr StaticSignatureList(const StaticSignature (&signatures)[Count]) :
+			_data(signatures), _size(Count)
+		{
+		}
+
+		/// <summary>
+		/// begin - Returns the address of the first signature.
+		/// </summary>
+		constexpr const StaticSignature* begin() const
+		{
+			return _data;
+		}
+
+		/// <summary>
+		/// end - Returns the address one past the last signature.
+		/// </summary>
+		constexpr const StaticSignature* end() const
+		{
+			return _data + _size;
+		}
+
+		/// <summary>
+		/// Size - Returns the number of signatures.
+		/// </summary>
+		constexpr size_t Size() const
+		{
+			return _size;
+		}
+
+		/// <summary>
+		/// Operator[] - Returns the signature at index. Not bounds checked.
+		/// </summary>
+		constexpr const StaticSignature& operator[](size_t index) const
+		{
+			return _data[index];
+		}
+
+	private:
+		/// <summary>
+		/// Address of the viewed array.
+		/// </summary>
+		const StaticSignature* _data = nullptr;
+
+		/// <summary>
+		/// Number of signatures in the viewed array.
+		/// </summary>
+		size_t _size = 0;
+	};
+}
+
+/// <summary>
+/// REFLECT_FIELD - StaticSignature of the data member Member of Class, bound to the attribute Name. Type, size and offset are taken from the member.
+/// </summary>
+#define REFLECT_FIELD(Name, Class, Member) FieaGameEngine::ReflectField<Class, decltype(Class::Member), offsetof(Class, Member)>(Name)
+
+/// <summary>
+/// REFLECT_TABLE - StaticSignature of a table attribute named Name, created with Count nested Scopes.
+/// </summary>
+#define REFLECT_TABLE(Name, Count) FieaGameEngine::ReflectTable(Name, Count)
@@ -12,12 +12,43 @@ namespace FieaGameEngine
 
 	const Vector<Signature>& TypeManager::GetSignaturesForType(RTTI::IdType typeID)
 	{
-		return _signatureMap.At(typeID);
+		return _signatureMap.At(typeID)._signatures;
+	}
+
+	const Scope::TableType& TypeManager::GetLayoutForType(RTTI::IdType typeID)
+	{
+		return _signatureMap.At(typeID)._layout;
 	}
 
 	void TypeManager::AddType(RTTI::IdType idType, Vector<Signature> signatureVector)
 	{
-		_signatureMap.Insert(make_pair(idType, std::move(signatureVector)));
+		TypeEntry entry;
+		entry._layout.Reserve(signatureVector.Size() + 1);
+		entry._layout.Insert(make_pair("this"s, Datum(Datum::DatumType::Pointer)));
+		for (const Signature& signature : signatureVector)
+		{
+			entry._layout.Insert(make_pair(signature.name, Datum(signature.type)));
+		}
+		entry._signatures = std::move(signatureVector);
+
+		_signatureMap.Insert(make_pair(idType, std::move(entry)));
+	}
+
+	void TypeManager::AddType(RTTI::IdType idType, StaticSignatureList signatures)
+	{
+		AddType(idType, ToSignatures(signatures));
+	}
+
+	Vector<Signature> TypeManager::ToSignatures(StaticSignatureList signatures)
+	{
+		Vector<Signature> signatureVector;
+		signatureVector.Reserve(signatures.Size());
+		for (const StaticSignature& signature : signatures)
+		{
+			signatureVector.PushBack(Signature{ string(signature.name), signature.type, signature.size, signature.offset });
+		}
+
+		return signatureVector;
 	}
 
 	void TypeManager::RemoveType(RTTI::IdType idType)
@@ -34,4 +65,14 @@ namespace FieaGameEngine
 	{
 		_signatureMap.Clear();
 	}
+
+	void TypeManager::Freeze()
+	{
+		_signatureMap.Freeze();
+	}
+
+	bool TypeManager::IsFrozen()
+	{
+		return _signatureMap.IsFrozen();
+	}
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include "Scope.h"
+#include "StaticSignature.h"
+#include "ConcurrentHashMap.h"
 
 namespace FieaGameEngine
 {
@@ -89,6 +91,14 @@ namespace FieaGameEngine
 		/// <returns>A reference to the signature array.</returns>
 		static const Vector<Signature>& GetSignaturesForType(RTTI::IdType typeID);
 
+		/// <summary>
+		/// GetLayoutForType - Returns the attribute table template built for a type when it was added: "this" followed by one typed, empty Datum per
+		/// prescribed attribute, in signature order, with its index already built. Attributed constructors copy it instead of appending key by key.
+		/// </summary>
+		/// <param name="typeID">The type ID of the class whose layout you want to retrieve.</param>
+		/// <returns>A reference to the layout table.</returns>
+		static const Scope::TableType& GetLayoutForType(RTTI::IdType typeID);
+
 		/// <summary>
 		/// AddType - Registers a typeID and it's signature array into the type manager
 		/// </summary>
@@ -96,6 +106,27 @@ namespace FieaGameEngine
 		/// <param name="signatureVector">The signature array of the class you are attempting to register.</param>
 		static void AddType(RTTI::IdType idType, Vector<Signature> signatureVector);
 
+		/// <summary>
+		/// AddType - Registers a typeID with the compile time signatures declared by REFLECT_FIELD and REFLECT_TABLE.
+		/// </summary>
+		/// <param name="idType">The type ID of the class you are attempting to register.</param>
+		/// <param name="signatures">The static signature array of the class you are attempting to register.</param>
+		static void AddType(RTTI::IdType idType, StaticSignatureList signatures);
+
+		/// <summary>
+		/// AddType - Registers T under T::TypeIdClass() with the signatures returned by T::StaticSignatures().
+		/// </summary>
+		/// <typeparam name="T">An Attributed class declaring its attributes with REFLECT_FIELD and REFLECT_TABLE.</typeparam>
+		template <typename T>
+		static void AddType();
+
+		/// <summary>
+		/// ToSignatures - Converts a static signature array into the runtime signature vector stored by the Type Manager.
+		/// </summary>
+		/// <param name="signatures">The static signature array to convert.</param>
+		/// <returns>A signature vector with one entry per static signature, in the same order.</returns>
+		static Vector<Signature> ToSignatures(StaticSignatureList signatures);
+
 		/// <summary>
 		/// RemoveType - Removes the type associated with the typeID passed into it from the Type Manager.
 		/// </summary>
@@ -107,6 +138,17 @@ namespace FieaGameEngine
 		/// </summary>
 		static void Clear();
 
+		/// <summary>
+		/// Freeze - Builds a perfect hash of the registered types for lookups by type ID. Call once every type is registered - adding or removing
+		/// a type afterwards goes back to the regular table until Freeze is called again.
+		/// </summary>
+		static void Freeze();
+
+		/// <summary>
+		/// IsFrozen - Tells you if lookups currently go through the perfect hash built by Freeze.
+		/// </summary>
+		static bool IsFrozen();
+
 		/// <summary>
 		/// Size - Returns the number of types registered in the type manager.
 		/// </summary>
@@ -116,8 +158,26 @@ namespace FieaGameEngine
 	private:
 
 		/// <summary>
-		/// A Hashmap storing (IDType, Signature Array) pairs.
+		/// TypeEntry - Everything registered for a type: its signatures and the layout built from them.
 		/// </summary>
-		static inline HashMap<RTTI::IdType, Vector<Signature>> _signatureMap;
+		struct TypeEntry final
+		{
+			/// <summary>
+			/// The prescribed attributes of the type.
+			/// </summary>
+			Vector<Signature> _signatures;
+
+			/// <summary>
+			/// Attribute table template, see GetLayoutForType().
+			/// </summary>
+			Scope::TableType _layout;
+		};
+
+		/// <summary>
+		/// A Hashmap storing (IDType, TypeEntry) pairs. Read without a lock, so Attributed objects can be constructed on any thread.
+		/// </summary>
+		static inline ConcurrentHashMap<RTTI::IdType, TypeEntry> _signatureMap;
 	};
-}
\ No newline at end of file
+}
+
+#include "TypeManager.inl"
@@ -0,0 +1,10 @@
+#include "TypeManager.h"
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline void TypeManager::AddType()
+	{
+		AddType(T::TypeIdClass(), T::StaticSignatures());
+	}
+}
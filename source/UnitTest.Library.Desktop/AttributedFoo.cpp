@@ -15,27 +15,33 @@ namespace FieaGameEngine
 
 #pragma endregion
 
-	const Vector<Signature> AttributedFoo::Signatures()
+	StaticSignatureList AttributedFoo::StaticSignatures()
 	{
-		FieaGameEngine::Vector<Signature> signatureVector =
+		static constexpr StaticSignature signatures[] =
 		{
-			{"Integer", Datum::DatumType::Integer, 1, offsetof(AttributedFoo, Integer)},
-			{"Float", Datum::DatumType::Float, 1, offsetof(AttributedFoo, Float)},
-			{"Vector", Datum::DatumType::Vector, 1, offsetof(AttributedFoo, Vector)},
-			{"Matrix", Datum::DatumType::Matrix, 1, offsetof(AttributedFoo, Matrix)},
-			{"String", Datum::DatumType::String, 1, offsetof(AttributedFoo, String)},
-			{"scope", Datum::DatumType::Table, 1, offsetof(AttributedFoo, scope)},
-			{"Rtti", Datum::DatumType::Pointer, 1, offsetof(AttributedFoo, Rtti)},
-			{"IntegerArray", Datum::DatumType::Integer, 2, offsetof(AttributedFoo, IntegerArray)},
-			{"FloatArray", Datum::DatumType::Float, 2, offsetof(AttributedFoo, FloatArray)},
-			{"VectorArray", Datum::DatumType::Vector, 2, offsetof(AttributedFoo, VectorArray)},
-			{"MatrixArray", Datum::DatumType::Matrix, 2, offsetof(AttributedFoo, MatrixArray)},
-			{"StringArray", Datum::DatumType::String, 2, offsetof(AttributedFoo, StringArray)},
-			{"scopeArray", Datum::DatumType::Table, 2, offsetof(AttributedFoo, scopeArray)},
-			{"RttiArray", Datum::DatumType::Pointer, 2, offsetof(AttributedFoo, RttiArray)}
+			REFLECT_FIELD("Integer", AttributedFoo, Integer),
+			REFLECT_FIELD("Float", AttributedFoo, Float),
+			REFLECT_FIELD("Vector", AttributedFoo, Vector),
+			REFLECT_FIELD("Matrix", AttributedFoo, Matrix),
+			REFLECT_FIELD("String", AttributedFoo, String),
+			REFLECT_FIELD("scope", AttributedFoo, scope),
+			REFLECT_FIELD("Rtti", AttributedFoo, Rtti),
+			REFLECT_FIELD("IntegerArray", AttributedFoo, IntegerArray),
+			REFLECT_FIELD("FloatArray", AttributedFoo, FloatArray),
+			REFLECT_FIELD("VectorArray", AttributedFoo, VectorArray),
+			REFLECT_FIELD("MatrixArray", AttributedFoo, MatrixArray),
+			REFLECT_FIELD("StringArray", AttributedFoo, StringArray),
+			REFLECT_FIELD("scopeArray", AttributedFoo, scopeArray),
+			REFLECT_FIELD("RttiArray", AttributedFoo, RttiArray)
 		};
+		static_assert(HasUniqueNames(signatures), "Two attributes of AttributedFoo share a name.");
+
+		return signatures;
+	}
 
-		return signatureVector;
+	const Vector<Signature> AttributedFoo::Signatures()
+	{
+		return TypeManager::ToSignatures(StaticSignatures());
 	}
 
 	gsl::owner<AttributedFoo*> AttributedFoo::Clone() const
@@ -31,6 +31,12 @@ namespace FieaGameEngine
 		/// <returns>Vector of the class's prescribed attributes' signatures.</returns>
 		static const Vector<Signature> Signatures();
 
+		/// <summary>
+		/// StaticSignatures - Returns the compile time signatures of the prescribed attributes, declared with REFLECT_FIELD. Register with TypeManager::AddType&lt;AttributedFoo&gt;().
+		/// </summary>
+		/// <returns>View of the static signature array.</returns>
+		static StaticSignatureList StaticSignatures();
+
 	private:
 		int Integer = 10;
 		float Float = 10.0f;
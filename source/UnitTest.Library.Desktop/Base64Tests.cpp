@@ -0,0 +1,96 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include "Base64.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(Base64Tests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestEncode)
+		{
+			Assert::AreEqual(""s, Base64::Encode("", 0));
+			Assert::AreEqual("TQ=="s, Base64::Encode("M", 1));
+			Assert::AreEqual("TWE="s, Base64::Encode("Ma", 2));
+			Assert::AreEqual("TWFu"s, Base64::Encode("Man", 3));
+
+			const int32_t values[] = { 7, -1, 300 };
+			Assert::AreEqual("BwAAAP////8sAQAA"s, Base64::Encode(values, sizeof(values)));
+		}
+
+		TEST_METHOD(TestDecode)
+		{
+			int32_t values[3] = { };
+			Assert::AreEqual(12_z, Base64::DecodedSize("BwAAAP////8sAQAA"));
+			Assert::AreEqual(12_z, Base64::Decode("BwAAAP////8sAQAA", values));
+			Assert::AreEqual(7, values[0]);
+			Assert::AreEqual(-1, values[1]);
+			Assert::AreEqual(300, values[2]);
+
+			//	Padded endings write only their bytes
+			char bytes[4] = { 'x', 'x', 'x', 'x' };
+			Assert::AreEqual(1_z, Base64::Decode("TQ==", bytes));
+			Assert::AreEqual("Mxxx"s, string(bytes, 4));
+			Assert::AreEqual(2_z, Base64::Decode("TWE=", bytes));
+			Assert::AreEqual("Maxx"s, string(bytes, 4));
+			Assert::AreEqual(0_z, Base64::Decode("", bytes));
+
+			//	Every length and byte value round trips
+			string data;
+			for (size_t i = 0; i < 300; ++i)
+			{
+				data.push_back(static_cast<char>(i * 7));
+				const string text = Base64::Encode(data.data(), data.size());
+				string decoded(Base64::DecodedSize(text), '\0');
+				Assert::AreEqual(data.size(), Base64::Decode(text, decoded.data()));
+				Assert::IsTrue(data == decoded);
+			}
+		}
+
+		TEST_METHOD(TestInvalid)
+		{
+			char bytes[6];
+			Assert::ExpectException<runtime_error>([] { Base64::DecodedSize("TWF"); });
+			Assert::ExpectException<runtime_error>([&bytes] { Base64::Decode("TW u", bytes); });
+			Assert::ExpectException<runtime_error>([&bytes] { Base64::Decode("TW=uTWFu", bytes); });
+			Assert::ExpectException<runtime_error>([&bytes] { Base64::Decode("TWFuTW\xff=", bytes); });
+			Assert::ExpectException<runtime_error>([&bytes] { Base64::Decode("====", bytes); });
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState Base64Tests::_startMemState;
+}
@@ -0,0 +1,1225 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include "Scope.h"
+#include "ScopeTraversal.h"
+#include "PrefabRegistry.h"
+#include "TypeManager.h"
+#include "FactoryHandle.h"
+#include "GameObject.h"
+#include "ActionListIf.h"
+#include "ActionTestDamage.h"
+#include "Avatar.h"
+#include "CookedScene.h"
+#include "AttributedFoo.h"
+#include "Event.h"
+#include "EventMessageAttributed.h"
+#include "ReactionAttributed.h"
+#include "Foo.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	ConcreteFactory(GameObject, Scope)
+	ConcreteFactory(Avatar, Scope)
+
+	/// <summary>
+	/// ComponentParseHelper - Stands in for a game's component helpers, each handling objects under a key of its own that the benchmark scene never uses.
+	/// Declared, its key is dispatched through the keyword table. Undeclared, it is a link of the chain, offered every key and comparing it.
+	/// </summary>
+	template <size_t Index>
+	class ComponentParseHelper final : public IJsonParseHelper
+	{
+		RTTI_DECLARATIONS(ComponentParseHelper, IJsonParseHelper)
+
+	public:
+		explicit ComponentParseHelper(bool isDeclared) :
+			_isDeclared(isDeclared)
+		{
+		}
+
+		void DeclareKeywords(Vector<Keyword>& keywords) const override
+		{
+			if (_isDeclared)
+			{
+				keywords.PushBack(Keyword{ _componentKey, ValueKinds::Object, 0 });
+			}
+		}
+
+		ValueKinds OtherKeys() const override
+		{
+			return (_isDeclared ? ValueKinds::None : ValueKinds::Any);
+		}
+
+		bool StartHandler(SharedData& data, const std::string& key, const Json::Value& object, bool inArray, size_t index) override
+		{
+			UNREFERENCED_LOCAL(data);
+			UNREFERENCED_LOCAL(object);
+			UNREFERENCED_LOCAL(inArray);
+			UNREFERENCED_LOCAL(index);
+			return key == _componentKey;
+		}
+
+		bool EndHandler(SharedData& data, const std::string& key) override
+		{
+			UNREFERENCED_LOCAL(data);
+			return key == _componentKey;
+		}
+
+		gsl::owner<IJsonParseHelper*> Create() override
+		{
+			return new ComponentParseHelper(_isDeclared);
+		}
+
+	private:
+		inline static const std::string _componentKey = "Component" + std::to_string(Index);
+		bool _isDeclared;
+	};
+
+	template <size_t Index>
+	const RTTI::IdType ComponentParseHelper<Index>::sRunTimeTypeId = ComponentParseHelper<Index>::TypeIdClass();
+
+	/// <summary>
+	/// BenchmarkTests - Timings for the engine's hot paths, written to the test output. Sizes are kept small enough for Debug runs;
+	/// the assertions only check that every variant did the same work, the numbers are for comparing builds.
+	/// </summary>
+	TEST_CLASS(BenchmarkTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			PrefabRegistry::Clear();
+			TypeManager::Clear();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(BenchmarkTraversalWideTree)
+		{
+			//	One root, 2000 children with 8 leaves each
+			Scope root;
+			for (size_t i = 0; i < 2000; ++i)
+			{
+				Scope& child = root.AppendScope("Children");
+				child["Health"] = static_cast<int>(i);
+				for (size_t j = 0; j < 8; ++j)
+				{
+					child.AppendScope("Leaves")["Health"] = static_cast<int>(j);
+				}
+			}
+
+			RunTraversalBenchmarks("Wide (1 x 2000 x 8)", root, 1 + 2000 + 16000);
+		}
+
+		TEST_METHOD(BenchmarkTraversalDeepTree)
+		{
+			//	16 chains, 400 scopes deep
+			Scope root;
+			for (size_t i = 0; i < 16; ++i)
+			{
+				Scope* link = &root;
+				for (size_t j = 0; j < 400; ++j)
+				{
+					link = &link->AppendScope("Next");
+					(*link)["Health"] = static_cast<int>(j);
+				}
+			}
+
+			RunTraversalBenchmarks("Deep (16 x 400)", root, 1 + 16 * 400);
+		}
+
+		TEST_METHOD(BenchmarkActionHeavyScene)
+		{
+			TypeManager::AddType(GameObject::TypeIdClass(), GameObject::Signatures());
+			TypeManager::AddType(ActionListIf::TypeIdClass(), ActionListIf::Signatures());
+			TypeManager::AddType(ActionTestDamage::TypeIdClass(), ActionTestDamage::Signatures());
+
+			GameObjectFactory gameObjectFactory;
+			ActionListIfFactory actionListIfFactory;
+			ActionTestDamageFactory actionTestDamageFactory;
+
+			const size_t objectCount = 250;
+			const size_t actionsPerObject = 6;
+
+#ifdef _DEBUG
+			_CrtMemState before;
+			_CrtMemCheckpoint(&before);
+#endif
+			{
+				//	Every GameObject carries a handful of small Actions - the common shape of a parsed level
+				auto start = Clock::now();
+				GameObject world;
+				for (size_t i = 0; i < objectCount; ++i)
+				{
+					GameObject* object = world.CreateGameObject("GameObject", "Object" + to_string(i));
+					for (size_t j = 0; j < actionsPerObject - 1; ++j)
+					{
+						object->CreateAction("ActionTestDamage", "Damage" + to_string(j));
+					}
+					object->CreateAction("ActionListIf", "Branch");
+				}
+
+				size_t scopeCount = 0;
+				size_t keyCount = 0;
+				ScopeTraversal::ForEachScope(world, [&scopeCount, &keyCount](Scope& s, size_t)
+				{
+					++scopeCount;
+					keyCount += s.Size();
+				});
+				Report("Action scene build", start, scopeCount);
+				Logger::WriteMessage(("  Average keys per scope: " + to_string(static_cast<double>(keyCount) / scopeCount)).c_str());
+
+#ifdef _DEBUG
+				_CrtMemState after, diff;
+				_CrtMemCheckpoint(&after);
+				_CrtMemDifference(&diff, &before, &after);
+				Logger::WriteMessage(("  Heap: " + to_string(diff.lSizes[_NORMAL_BLOCK]) + " bytes in " + to_string(diff.lCounts[_NORMAL_BLOCK]) + " blocks").c_str());
+#endif
+
+				//	Lookups are a mix of hits on prescribed attributes and misses
+				const string keys[] = { "Name", "Actions", "Condition", "Missing" };
+				const size_t passes = 20;
+				size_t hits = 0;
+				start = Clock::now();
+				for (size_t pass = 0; pass < passes; ++pass)
+				{
+					ScopeTraversal::ForEachScope(world, [&hits, &keys](Scope& s, size_t)
+					{
+						for (const string& key : keys)
+						{
+							hits += (s.Find(key) != nullptr) ? 1 : 0;
+						}
+					});
+				}
+				Report("  Find x " + to_string(passes * 4), start, scopeCount);
+
+				Assert::AreEqual(1 + objectCount * (actionsPerObject + 1), scopeCount);
+				Assert::IsTrue(hits > 0);
+			}
+		}
+
+		TEST_METHOD(BenchmarkPrefabInstancing)
+		{
+			//	An Avatar-like prefab: a dozen attributes, a few of them arrays, plus two nested scopes
+			Scope* avatar = new Scope();
+			(*avatar)["Name"] = "Avatar with a name too long for the small string buffer"s;
+			(*avatar)["Health"] = 100;
+			(*avatar)["Speed"] = 4.5f;
+			(*avatar)["Transform"] = mat4x4(1.0f);
+			(*avatar)["Position"] = vec4(0.0f);
+			(*avatar)["Velocity"] = vec4(0.0f);
+			Datum& path = avatar->Append("Path");
+			path.SetType(Datum::DatumType::Vector);
+			Datum& tags = avatar->Append("Tags");
+			tags.SetType(Datum::DatumType::String);
+			for (size_t i = 0; i < 16; ++i)
+			{
+				path.PushBack(vec4(static_cast<float>(i)));
+				tags.PushBack("Tag number " + to_string(i) + " of the avatar prefab");
+			}
+			Scope& weapon = avatar->AppendScope("Weapon");
+			weapon["Damage"] = 12.5f;
+			weapon["Description"] = "A weapon with a long enough description to allocate"s;
+			avatar->AppendScope("Inventory")["Slots"] = mat4x4(0.0f);
+
+			const size_t instanceCount = 500;
+			Vector<Scope*> instances;
+			instances.Reserve(instanceCount);
+
+			//	Deep copies of an unregistered prototype are what spawning cost before prefabs
+			RunInstancingBenchmark("Deep Clone", instances, instanceCount, [avatar] { return new Scope(*avatar); });
+			Assert::IsTrue(*instances[0] == *avatar);
+			Assert::IsFalse(as_const(*instances[0]).Find("Tags")->IsShared());
+			DeleteAll(instances);
+
+			const Scope& prototype = PrefabRegistry::Register("Avatar", avatar);
+			RunInstancingBenchmark("Prefab instances", instances, instanceCount, [] { return PrefabRegistry::Instantiate("Avatar"); });
+			Assert::IsTrue(*instances[0] == prototype);
+			Assert::IsTrue(as_const(*instances[0]).Find("Tags")->IsShared());
+
+			//	Writing one attribute per instance only materializes that attribute
+			auto start = Clock::now();
+			for (Scope* instance : instances)
+			{
+				instance->Find("Health")->Set(50);
+			}
+			Report("  Write one attribute", start, instanceCount);
+			Assert::IsTrue(as_const(*instances[0]).Find("Tags")->IsShared());
+			DeleteAll(instances);
+		}
+
+		TEST_METHOD(BenchmarkAttributedSpawn)
+		{
+			TypeManager::AddType(Avatar::TypeIdClass(), Avatar::Signatures());
+			TypeManager::AddType(AttributedFoo::TypeIdClass(), AttributedFoo::Signatures());
+
+			//	Avatar stays under the linear scan threshold, AttributedFoo is large enough to need an index
+			const size_t spawnCount = 2000;
+			RunSpawnBenchmark<Avatar>("Avatar spawn", spawnCount);
+			RunSpawnBenchmark<AttributedFoo>("AttributedFoo spawn", spawnCount);
+		}
+
+		TEST_METHOD(BenchmarkAttributedEventDelivery)
+		{
+			TypeManager::AddType(GameObject::TypeIdClass(), GameObject::Signatures());
+			TypeManager::AddType(ActionList::TypeIdClass(), ActionList::Signatures());
+			TypeManager::AddType(EventMessageAttributed::TypeIdClass(), EventMessageAttributed::Signatures());
+
+			//	Two events carrying the same four arguments with different values, delivered alternately so every argument is written each time
+			Event<EventMessageAttributed> hit(BuildEventMessage(12, "Arrow"s));
+			Event<EventMessageAttributed> blocked(BuildEventMessage(0, "Shield"s));
+
+			ReactionAttributed reaction;
+			reaction.Notify(hit);
+			Assert::AreEqual(12, reaction["Damage"].Get<int>());
+			Assert::AreEqual("Arrow"s, reaction["Source"].Get<string>());
+
+			const size_t eventCount = 5000;
+#ifdef _DEBUG
+			_allocationCount = 0;
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+#endif
+			auto start = Clock::now();
+			for (size_t i = 0; i < eventCount; ++i)
+			{
+				reaction.Notify((i & 1) == 0 ? blocked : hit);
+			}
+			double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+#ifdef _DEBUG
+			_CrtSetAllocHook(previousHook);
+			Logger::WriteMessage(("  Allocations per event: " + to_string(static_cast<double>(_allocationCount) / eventCount)).c_str());
+#endif
+			Logger::WriteMessage(("Attributed event delivery: " + to_string(eventCount) + " events in " + to_string(ms) + " ms").c_str());
+
+			Assert::AreEqual(12, reaction["Damage"].Get<int>());
+			Assert::AreEqual("Arrow"s, reaction["Source"].Get<string>());
+			Assert::AreEqual(ActionList::Signatures().Size() + 5, reaction.Size());
+		}
+
+		TEST_METHOD(BenchmarkTypeRegistration)
+		{
+			//	Startup registration of a few hundred Avatar sized types, under made up type ids
+			const size_t typeCount = 400;
+
+			auto start = Clock::now();
+			for (size_t i = 0; i < typeCount; ++i)
+			{
+				TypeManager::AddType(static_cast<RTTI::IdType>(i + 1), HandWrittenAvatarSignatures());
+			}
+			double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+			Logger::WriteMessage(("Hand written signature vectors: " + to_string(typeCount) + " types in " + to_string(ms) + " ms").c_str());
+			Assert::AreEqual(typeCount, TypeManager::Size());
+			const Vector<Signature> handWritten = TypeManager::GetSignaturesForType(typeCount);
+			TypeManager::Clear();
+
+			start = Clock::now();
+			for (size_t i = 0; i < typeCount; ++i)
+			{
+				TypeManager::AddType(static_cast<RTTI::IdType>(i + 1), Avatar::StaticSignatures());
+			}
+			ms = chrono::duration<double, milli>(Clock::now() - start).count();
+			Logger::WriteMessage(("Static signatures: " + to_string(typeCount) + " types in " + to_string(ms) + " ms").c_str());
+			Assert::AreEqual(typeCount, TypeManager::Size());
+
+			const Vector<Signature>& reflected = TypeManager::GetSignaturesForType(typeCount);
+			Assert::AreEqual(handWritten.Size(), reflected.Size());
+			for (size_t i = 0; i < reflected.Size(); ++i)
+			{
+				Assert::IsTrue(handWritten[i] == reflected[i]);
+				Assert::AreEqual(handWritten[i].offset, reflected[i].offset);
+			}
+		}
+
+		TEST_METHOD(BenchmarkPooledSpawn)
+		{
+			TypeManager::AddType<ActionList>();
+
+			//	Waves of short lived Actions, spawned and despawned together
+			const size_t waveCount = 50;
+			const size_t waveSize = 200;
+			Vector<Scope*> wave;
+			wave.Reserve(waveSize);
+
+			auto start = Clock::now();
+			for (size_t i = 0; i < waveCount; ++i)
+			{
+				for (size_t j = 0; j < waveSize; ++j)
+				{
+					wave.PushBack(new ActionList());
+				}
+				DeleteAll(wave);
+			}
+			Report("Heap spawn waves", start, waveCount * waveSize);
+
+			ActionListFactory actionListFactory;
+			start = Clock::now();
+			for (size_t i = 0; i < waveCount; ++i)
+			{
+				for (size_t j = 0; j < waveSize; ++j)
+				{
+					wave.PushBack(IFactory<Scope>::Create("ActionList"s));
+				}
+				DeleteAll(wave);
+			}
+			Report("Pooled spawn waves", start, waveCount * waveSize);
+
+			const ObjectPool& pool = actionListFactory.Pool();
+			Logger::WriteMessage(("  Hit rate: " + to_string(pool.HitRate()) + ", high water mark: " + to_string(pool.HighWaterMark())).c_str());
+			Assert::AreEqual(waveCount * waveSize, pool.Allocations());
+			Assert::AreEqual(waveSize, pool.HighWaterMark());
+			Assert::AreEqual(0_z, pool.LiveCount());
+		}
+
+		TEST_METHOD(BenchmarkBatchedCreate)
+		{
+			TypeManager::AddType<ActionList>();
+			ActionListFactory actionListFactory;
+
+			const size_t batchCount = 20;
+			const size_t batchSize = 500;
+			Vector<Scope*> batch;
+			batch.Reserve(batchSize);
+
+			auto start = Clock::now();
+			for (size_t i = 0; i < batchCount; ++i)
+			{
+				for (size_t j = 0; j < batchSize; ++j)
+				{
+					batch.PushBack(IFactory<Scope>::Create("ActionList"s));
+				}
+				DeleteAll(batch);
+			}
+			Report("Create one at a time", start, batchCount * batchSize);
+
+			size_t created = 0;
+			start = Clock::now();
+			for (size_t i = 0; i < batchCount; ++i)
+			{
+				batch = IFactory<Scope>::CreateN("ActionList"s, batchSize);
+				created += batch.Size();
+				DeleteAll(batch);
+			}
+			Report("CreateN", start, batchCount * batchSize);
+
+			Assert::AreEqual(batchCount * batchSize, created);
+			Assert::AreEqual(batchSize, actionListFactory.Pool().HighWaterMark());
+			Assert::AreEqual(0_z, actionListFactory.Pool().LiveCount());
+		}
+
+		TEST_METHOD(BenchmarkFactoryHandle)
+		{
+			TypeManager::AddType<ActionList>();
+			ActionListFactory actionListFactory;
+
+			//	Spawning by name hashes the class name on every call, a handle resolves it once
+			const size_t waveCount = 50;
+			const size_t waveSize = 200;
+			const string className = "ActionList"s;
+			Vector<Scope*> wave;
+			wave.Reserve(waveSize);
+
+			auto start = Clock::now();
+			for (size_t i = 0; i < waveCount; ++i)
+			{
+				for (size_t j = 0; j < waveSize; ++j)
+				{
+					wave.PushBack(IFactory<Scope>::Create(className));
+				}
+				DeleteAll(wave);
+			}
+			Report("Create by name", start, waveCount * waveSize);
+
+			const FactoryHandle<Scope> handle(className);
+			start = Clock::now();
+			for (size_t i = 0; i < waveCount; ++i)
+			{
+				for (size_t j = 0; j < waveSize; ++j)
+				{
+					wave.PushBack(handle.Create());
+				}
+				DeleteAll(wave);
+			}
+			Report("Create by handle", start, waveCount * waveSize);
+
+			Assert::AreEqual(2 * waveCount * waveSize, actionListFactory.Pool().Allocations());
+			Assert::AreEqual(0_z, actionListFactory.Pool().LiveCount());
+		}
+
+		TEST_METHOD(BenchmarkConcurrentLookup)
+		{
+			TypeManager::AddType<GameObject>();
+			TypeManager::AddType<ActionList>();
+			TypeManager::AddType<ActionListIf>();
+			GameObjectFactory gameObjectFactory;
+			ActionListFactory actionListFactory;
+			ActionListIfFactory actionListIfFactory;
+
+			//	The same registry lookups through the lock free maps and through a HashMap behind a mutex, the way the registries used to need guarding
+			const string names[] = { "GameObject"s, "ActionList"s, "ActionListIf"s, "Missing"s };
+			const RTTI::IdType ids[] = { GameObject::TypeIdClass(), ActionList::TypeIdClass(), ActionListIf::TypeIdClass(), Foo::TypeIdClass() };
+			HashMap<string, const IFactory<Scope>*> lockedTable;
+			for (size_t i = 0; i < 3; ++i)
+			{
+				lockedTable.Insert(make_pair(names[i], IFactory<Scope>::Find(names[i])));
+			}
+			mutex lockedTableMutex;
+
+			const size_t lookupsPerThread = 20000;
+			for (size_t threadCount : { 1_z, 2_z, 4_z, 8_z, 16_z, 32_z })
+			{
+				atomic<size_t> found{ 0 };
+				double ms = RunOnThreads(threadCount, [&] {
+					size_t hits = 0;
+					for (size_t i = 0; i < lookupsPerThread; ++i)
+					{
+						const size_t which = i % 4;
+						hits += IFactory<Scope>::Find(names[which]) != nullptr ? 1 : 0;
+						hits += TypeManager::ContainsType(ids[which]) ? 1 : 0;
+					}
+					found += hits;
+				});
+				Logger::WriteMessage(("Lock free lookups, " + to_string(threadCount) + " threads: " + to_string(2 * threadCount * lookupsPerThread) + " in " + to_string(ms) + " ms").c_str());
+				Assert::AreEqual(threadCount * lookupsPerThread * 3 / 2, found.load());
+
+				found = 0;
+				ms = RunOnThreads(threadCount, [&] {
+					size_t hits = 0;
+					for (size_t i = 0; i < lookupsPerThread; ++i)
+					{
+						const size_t which = i % 4;
+						lock_guard<mutex> lock(lockedTableMutex);
+						hits += lockedTable.ContainsKey(names[which]) ? 1 : 0;
+						hits += TypeManager::ContainsType(ids[which]) ? 1 : 0;
+					}
+					found += hits;
+				});
+				Logger::WriteMessage(("Mutex lookups, " + to_string(threadCount) + " threads: " + to_string(2 * threadCount * lookupsPerThread) + " in " + to_string(ms) + " ms").c_str());
+				Assert::AreEqual(threadCount * lookupsPerThread * 3 / 2, found.load());
+			}
+		}
+
+		TEST_METHOD(BenchmarkFrozenLookup)
+		{
+			TypeManager::AddType<GameObject>();
+			TypeManager::AddType<ActionList>();
+			TypeManager::AddType<ActionListIf>();
+			GameObjectFactory gameObjectFactory;
+			ActionListFactory actionListFactory;
+			ActionListIfFactory actionListIfFactory;
+
+			//	Datum's Json type names through the HashMap they used to live in and through the compile time perfect hash
+			const string typeNames[] = { "float"s, "integer"s, "matrix"s, "string"s, "table"s, "vector"s, "pointer"s, "unknown"s };
+			HashMap<string, Datum::DatumType> typeTable;
+			for (const auto& entry : Datum::_setTypeJsonTableParseMap)
+			{
+				typeTable.Insert(make_pair(string(entry.first), entry.second));
+			}
+
+			const size_t lookupCount = 200000;
+			size_t hashMapHits = 0;
+			auto start = Clock::now();
+			for (size_t i = 0; i < lookupCount; ++i)
+			{
+				hashMapHits += typeTable.ContainsKey(typeNames[i % 8]) ? 1 : 0;
+			}
+			ReportLatency("Type name, HashMap", start, lookupCount);
+
+			size_t frozenHits = 0;
+			start = Clock::now();
+			for (size_t i = 0; i < lookupCount; ++i)
+			{
+				frozenHits += Datum::_setTypeJsonTableParseMap.ContainsKey(typeNames[i % 8]) ? 1 : 0;
+			}
+			ReportLatency("Type name, FrozenMap", start, lookupCount);
+			Assert::AreEqual(lookupCount * 3 / 4, hashMapHits);
+			Assert::AreEqual(hashMapHits, frozenHits);
+
+			//	The registries before and after freezing them
+			const string names[] = { "GameObject"s, "ActionList"s, "ActionListIf"s, "Missing"s };
+			const RTTI::IdType ids[] = { GameObject::TypeIdClass(), ActionList::TypeIdClass(), ActionListIf::TypeIdClass(), Foo::TypeIdClass() };
+			size_t found[2] = { 0, 0 };
+			for (size_t pass = 0; pass < 2; ++pass)
+			{
+				const char* state = (pass == 0 ? ", open" : ", frozen");
+				start = Clock::now();
+				for (size_t i = 0; i < lookupCount; ++i)
+				{
+					found[pass] += IFactory<Scope>::Find(names[i % 4]) != nullptr ? 1 : 0;
+				}
+				ReportLatency("Factory registry"s + state, start, lookupCount);
+
+				start = Clock::now();
+				for (size_t i = 0; i < lookupCount; ++i)
+				{
+					found[pass] += TypeManager::ContainsType(ids[i % 4]) ? 1 : 0;
+				}
+				ReportLatency("Type registry"s + state, start, lookupCount);
+
+				IFactory<Scope>::Freeze();
+				TypeManager::Freeze();
+			}
+
+			Assert::IsTrue(IFactory<Scope>::IsFrozen());
+			Assert::IsTrue(TypeManager::IsFrozen());
+			Assert::AreEqual(lookupCount * 3 / 2, found[0]);
+			Assert::AreEqual(found[0], found[1]);
+		}
+
+		TEST_METHOD(BenchmarkStreamingParse)
+		{
+			//	A scene of areas full of entities, members in name order so both parses build identical trees. Raise the counts for real sized scenes.
+			ScopeFactory scopeFactory;
+			const string fileName = "BenchmarkScene.json";
+			const size_t areaCount = 30;
+			const size_t entityCount = 100;
+			const double megabytes = WriteScene(fileName, areaCount, entityCount);
+			const size_t baseline = PeakWorkingSet();
+
+			//	Streaming first: the process peak only grows, so each parse is reported against the same baseline
+			size_t streamedEntities = 0;
+			{
+				Scope root;
+				SharedTableData data(root);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+
+				string name = fileName;
+				auto start = Clock::now();
+				parser.ParseFromFileStreaming(name);
+				ReportParse("Streaming parse", start, megabytes, PeakWorkingSet() - baseline);
+				streamedEntities = CountEntities(root);
+			}
+
+			Scope root;
+			SharedTableData data(root);
+			JsonParseCoordinator parser(data);
+			JsonTableParseHelper helper;
+			parser.AddHelper(helper);
+
+			string name = fileName;
+			auto start = Clock::now();
+			parser.ParseFromFile(name);
+			ReportParse("Json::Value parse", start, megabytes, PeakWorkingSet() - baseline);
+
+			Assert::AreEqual(areaCount * entityCount, streamedEntities);
+			Assert::AreEqual(streamedEntities, CountEntities(root));
+
+			//	Same tree either way
+			Scope streamedRoot;
+			data.SetRootScope(streamedRoot);
+			name = fileName;
+			parser.ParseFromFileStreaming(name);
+			Assert::IsTrue(root == streamedRoot);
+
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(BenchmarkParseBatch)
+		{
+			//	A level split over files, parsed on 1 to 8 threads. Raise the counts for real sized levels.
+			ScopeFactory scopeFactory;
+			const size_t fileCount = 8;
+			const size_t areaCount = 4;
+			const size_t entityCount = 100;
+			Vector<string> fileNames(fileCount);
+			double megabytes = 0.0;
+			for (size_t i = 0; i < fileCount; ++i)
+			{
+				fileNames.PushBack("BenchmarkBatch"s + to_string(i) + ".json"s);
+				megabytes += WriteScene(fileNames.Back(), areaCount, entityCount, i * areaCount);
+			}
+
+			JsonTableParseHelper helper;
+			Scope first;
+			SharedTableData data(first);
+			JsonParseCoordinator parser(data);
+			parser.AddHelper(helper);
+
+			double singleThreadSeconds = 0.0;
+			for (size_t threadCount = 1; threadCount <= 8; threadCount *= 2)
+			{
+				Scope root;
+				Scope& target = (threadCount == 1 ? first : root);
+				data.SetRootScope(target);
+				auto start = Clock::now();
+				parser.ParseBatch(fileNames, threadCount);
+				const double seconds = chrono::duration<double>(Clock::now() - start).count();
+				if (threadCount == 1)
+				{
+					singleThreadSeconds = seconds;
+				}
+				Logger::WriteMessage(("ParseBatch on " + to_string(threadCount) + " threads: " + to_string(megabytes) + " MB at " + to_string(megabytes / seconds)
+					+ " MB/s, " + to_string(singleThreadSeconds / seconds) + "x one thread").c_str());
+
+				//	Merged in list order, so every thread count builds the same tree
+				Assert::AreEqual(fileCount * areaCount * entityCount, CountEntities(target));
+				Assert::IsTrue(target == first);
+			}
+
+			for (const auto& fileName : fileNames)
+			{
+				remove(fileName.c_str());
+			}
+		}
+
+		TEST_METHOD(BenchmarkCookedLoad)
+		{
+			//	The streaming parse's scene, cooked once and loaded both ways. Loads go first, as the process peak only grows. Raise the counts for real sized scenes.
+			ScopeFactory scopeFactory;
+			const string fileName = "BenchmarkCooked.json";
+			const string cookedFileName = "BenchmarkCooked.scene";
+			const size_t areaCount = 30;
+			const size_t entityCount = 100;
+			const double megabytes = WriteScene(fileName, areaCount, entityCount);
+			CookedScene::CookFile(fileName, cookedFileName);
+			Assert::IsFalse(CookedScene::IsStale(fileName, cookedFileName));
+			const size_t baseline = PeakWorkingSet();
+
+			Scope copied;
+			Scope referenced;
+			CookedScene scene(cookedFileName);
+			{
+				auto start = Clock::now();
+				scene.Load(copied);
+				ReportParse("Cooked load, copied", start, megabytes, PeakWorkingSet() - baseline);
+			}
+
+			{
+				auto start = Clock::now();
+				scene.Load(referenced, CookedScene::LoadMode::Reference);
+				ReportParse("Cooked load, referenced", start, megabytes, PeakWorkingSet() - baseline);
+				Assert::AreEqual(areaCount * entityCount, CountEntities(referenced));
+			}
+
+			Scope parsed;
+			{
+				SharedTableData data(parsed);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+
+				string name = fileName;
+				auto start = Clock::now();
+				parser.ParseFromFileStreaming(name);
+				ReportParse("Streaming parse", start, megabytes, PeakWorkingSet() - baseline);
+			}
+
+			//	Same tree every way
+			Assert::IsTrue(parsed == copied);
+			Assert::IsTrue(parsed == referenced);
+			referenced.Clear();
+			scene.Close();
+			remove(fileName.c_str());
+			remove(cookedFileName.c_str());
+		}
+
+		TEST_METHOD(BenchmarkKeywordDispatch)
+		{
+			//	The streaming parse's scene, with ten component helpers registered ahead of the table helper
+			ScopeFactory scopeFactory;
+			const string fileName = "BenchmarkKeywords.json";
+			const size_t areaCount = 30;
+			const size_t entityCount = 100;
+			const double megabytes = WriteScene(fileName, areaCount, entityCount);
+
+			Scope chained;
+			Scope dispatched;
+			for (bool isDeclared : { false, true })
+			{
+				Scope& root = (isDeclared ? dispatched : chained);
+				SharedTableData data(root);
+				JsonParseCoordinator parser(data);
+				Vector<gsl::owner<IJsonParseHelper*>> helpers;
+				AddComponentHelpers(parser, helpers, isDeclared, make_index_sequence<10>());
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+
+				string name = fileName;
+				auto start = Clock::now();
+				parser.ParseFromFile(name);
+				const double seconds = chrono::duration<double>(Clock::now() - start).count();
+				Logger::WriteMessage(((isDeclared ? "Keyword table, "s : "Helper chain, "s) + to_string(parser.GetHelperCount()) + " helpers: "
+					+ to_string(megabytes) + " MB at " + to_string(megabytes / seconds) + " MB/s").c_str());
+
+				for (auto* componentHelper : helpers)
+				{
+					delete componentHelper;
+				}
+			}
+
+			Assert::AreEqual(areaCount * entityCount, CountEntities(dispatched));
+			Assert::IsTrue(chained == dispatched);
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(BenchmarkAttributedParse)
+		{
+			//	An Avatar heavy scene, prescribed attributes written straight into their members and then through Append and their Datums
+			ScopeFactory scopeFactory;
+			AvatarFactory avatarFactory;
+			TypeManager::AddType<Avatar>();
+			const string fileName = "BenchmarkAvatars.json";
+			const size_t avatarCount = 3000;
+			const double megabytes = WriteAvatarScene(fileName, avatarCount);
+
+			Scope direct;
+			Scope generic;
+			for (bool isDirect : { true, false })
+			{
+				Scope& root = (isDirect ? direct : generic);
+				SharedTableData data(root);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				helper.SetDirectWrites(isDirect);
+				parser.AddHelper(helper);
+
+				string name = fileName;
+				auto start = Clock::now();
+				parser.ParseFromFileStreaming(name);
+				const double seconds = chrono::duration<double>(Clock::now() - start).count();
+				Logger::WriteMessage(((isDirect ? "Direct member writes: "s : "Append and Datum writes: "s) + to_string(avatarCount) + " Avatars, "
+					+ to_string(megabytes) + " MB at " + to_string(megabytes / seconds) + " MB/s").c_str());
+			}
+
+			//	Same values either way
+			Assert::AreEqual(avatarCount, direct["Avatars"].Size());
+			Assert::AreEqual(avatarCount, generic["Avatars"].Size());
+			for (size_t i = 0; i < avatarCount; i += avatarCount / 10)
+			{
+				Avatar* avatar = direct["Avatars"][i].As<Avatar>();
+				Scope& expected = generic["Avatars"][i];
+				Assert::IsNotNull(avatar);
+				Assert::AreEqual(static_cast<int>(i), avatar->GetHealth());
+				for (const char* key : { "Name", "Health", "Velocity", "Dps", "Team" })
+				{
+					Assert::IsTrue((*avatar)[key] == expected[key]);
+				}
+			}
+
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(BenchmarkTypeDispatch)
+		{
+			TypeManager::AddType<GameObject>();
+			TypeManager::AddType<Avatar>();
+			TypeManager::AddType<ActionList>();
+			TypeManager::AddType<ActionListIf>();
+			TypeManager::AddType<AttributedFoo>();
+
+			//	A mixed bag of shallow and deep types, queried the way Update loops and parse helpers do
+			const size_t objectCount = 600;
+			Vector<RTTI*> objects;
+			objects.Reserve(objectCount);
+			for (size_t i = 0; i < objectCount; i += 6)
+			{
+				objects.PushBack(new GameObject());
+				objects.PushBack(new Avatar());
+				objects.PushBack(new ActionList());
+				objects.PushBack(new ActionListIf());
+				objects.PushBack(new AttributedFoo());
+				objects.PushBack(new Foo());
+			}
+
+			const size_t passCount = 200;
+			size_t actions = 0;
+			size_t gameObjects = 0;
+			size_t avatars = 0;
+			auto start = Clock::now();
+			for (size_t pass = 0; pass < passCount; ++pass)
+			{
+				for (RTTI* object : objects)
+				{
+					actions += object->Is(Action::TypeIdClass()) ? 1 : 0;
+					gameObjects += object->Is(GameObject::TypeIdClass()) ? 1 : 0;
+					avatars += object->As<Avatar>() != nullptr ? 1 : 0;
+				}
+			}
+			double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+			Logger::WriteMessage(("Type id dispatch: " + to_string(passCount * objectCount * 3) + " queries in " + to_string(ms) + " ms").c_str());
+			Assert::AreEqual(passCount * objectCount / 3, actions);
+			Assert::AreEqual(passCount * objectCount / 3, gameObjects);
+			Assert::AreEqual(passCount * objectCount / 6, avatars);
+
+			const string actionName = "Action"s;
+			const string scopeName = "Scope"s;
+			actions = 0;
+			size_t scopes = 0;
+			start = Clock::now();
+			for (size_t pass = 0; pass < passCount; ++pass)
+			{
+				for (RTTI* object : objects)
+				{
+					actions += object->Is(actionName) ? 1 : 0;
+					scopes += object->Is(scopeName) ? 1 : 0;
+				}
+			}
+			ms = chrono::duration<double, milli>(Clock::now() - start).count();
+			Logger::WriteMessage(("Type name dispatch: " + to_string(passCount * objectCount * 2) + " queries in " + to_string(ms) + " ms").c_str());
+			Assert::AreEqual(passCount * objectCount / 3, actions);
+			Assert::AreEqual(passCount * objectCount * 5 / 6, scopes);
+
+			for (RTTI* object : objects)
+			{
+				delete object;
+			}
+		}
+
+	private:
+
+		using Clock = chrono::high_resolution_clock;
+
+		/// <summary>
+		/// VisitWork - Stand in for a per-scope update: a lookup plus some arithmetic, written back to the scope.
+		/// </summary>
+		static void VisitWork(Scope& scope)
+		{
+			Datum* health = scope.Find("Health");
+			if (health != nullptr)
+			{
+				float value = static_cast<float>(health->Get<int>());
+				for (int i = 0; i < 64; ++i)
+				{
+					value = sqrtf(value * value + 1.0f);
+				}
+				scope["Result"] = value;
+			}
+		}
+
+		/// <summary>
+		/// VisitRecursive - The hand written recursion every whole tree operation used before ScopeTraversal.
+		/// </summary>
+		static size_t VisitRecursive(Scope& scope)
+		{
+			VisitWork(scope);
+
+			size_t count = 1;
+			for (size_t i = 0; i < scope.Size(); ++i)
+			{
+				Datum& d = scope[i];
+				if (d.Type() == Datum::DatumType::Table)
+				{
+					for (size_t j = 0; j < d.Size(); ++j)
+					{
+						count += VisitRecursive(d[j]);
+					}
+				}
+			}
+			return count;
+		}
+
+		static void Report(const string& name, Clock::time_point start, size_t count)
+		{
+			double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+			Logger::WriteMessage((name + ": " + to_string(count) + " scopes in " + to_string(ms) + " ms").c_str());
+		}
+
+		static void ReportLatency(const string& name, Clock::time_point start, size_t count)
+		{
+			double ns = chrono::duration<double, nano>(Clock::now() - start).count();
+			Logger::WriteMessage((name + ": " + to_string(count) + " lookups, " + to_string(ns / count) + " ns each").c_str());
+		}
+
+		static void ReportParse(const string& name, Clock::time_point start, double megabytes, size_t peakGrowth)
+		{
+			double seconds = chrono::duration<double>(Clock::now() - start).count();
+			Logger::WriteMessage((name + ": " + to_string(megabytes) + " MB at " + to_string(megabytes / seconds) + " MB/s, peak working set +"
+				+ to_string(static_cast<double>(peakGrowth) / (1024.0 * 1024.0)) + " MB").c_str());
+		}
+
+		/// <summary>
+		/// WriteScene - Writes a scene of areas full of entities, members in name order so the Json::Value and streaming parses build identical trees.
+		/// Areas are numbered from firstArea, so scenes written for one level don't share keys.
+		/// </summary>
+		/// <returns>Size of the file in megabytes.</returns>
+		static double WriteScene(const string& fileName, size_t areaCount, size_t entityCount, size_t firstArea = 0)
+		{
+			{
+				ofstream scene(fileName);
+				scene << "{\n";
+				for (size_t area = firstArea; area < firstArea + areaCount; ++area)
+				{
+					scene << "  \"Area" << (1000 + area) << "\": { \"type\": \"table\", \"value\": { \"Entities\": { \"type\": \"table\", \"value\": [\n";
+					for (size_t entity = 0; entity < entityCount; ++entity)
+					{
+						scene << "    { \"type\": \"table\", \"value\": {"
+							<< " \"Dps\": { \"type\": \"float\", \"value\": " << entity << ".5 },"
+							<< " \"Health\": { \"type\": \"integer\", \"value\": " << entity << " },"
+							<< " \"Name\": { \"type\": \"string\", \"value\": \"Entity " << entity << "\" },"
+							<< " \"Position\": { \"type\": \"vector\", \"value\": \"vec4(" << entity << ", 0, 1, 1)\" },"
+							<< " \"Tags\": { \"type\": \"string\", \"value\": [ \"Enemy\", \"Spawned\" ] } } }" << (entity + 1 < entityCount ? ",\n" : "\n");
+					}
+					scene << "  ] } } }" << (area + 1 < firstArea + areaCount ? ",\n" : "\n");
+				}
+				scene << "}\n";
+			}
+
+			ifstream sceneFile(fileName, ios::binary | ios::ate);
+			return static_cast<double>(sceneFile.tellg()) / (1024.0 * 1024.0);
+		}
+
+		/// <summary>
+		/// WriteAvatarScene - Writes a scene of Avatars, their prescribed attributes in signature order with an auxiliary one after them.
+		/// </summary>
+		/// <returns>Size of the file in megabytes.</returns>
+		static double WriteAvatarScene(const string& fileName, size_t avatarCount)
+		{
+			{
+				ofstream scene(fileName);
+				scene << "{ \"Avatars\": { \"type\": \"table\", \"class\": \"Avatar\", \"value\": [\n";
+				for (size_t avatar = 0; avatar < avatarCount; ++avatar)
+				{
+					scene << "    { \"type\": \"table\", \"value\": {"
+						<< " \"Name\": { \"type\": \"string\", \"value\": \"Avatar " << avatar << "\" },"
+						<< " \"Health\": { \"type\": \"integer\", \"value\": " << avatar << " },"
+						<< " \"Velocity\": { \"type\": \"vector\", \"value\": \"vec4(" << avatar << ", 0, 1, 0)\" },"
+						<< " \"Dps\": { \"type\": \"float\", \"value\": " << avatar << ".5 },"
+						<< " \"Team\": { \"type\": \"string\", \"value\": \"Blue\" } } }" << (avatar + 1 < avatarCount ? ",\n" : "\n");
+				}
+				scene << "] } }\n";
+			}
+
+			ifstream sceneFile(fileName, ios::binary | ios::ate);
+			return static_cast<double>(sceneFile.tellg()) / (1024.0 * 1024.0);
+		}
+
+		/// <summary>
+		/// PeakWorkingSet - The most memory the process has had resident so far, in bytes.
+		/// </summary>
+		static size_t PeakWorkingSet()
+		{
+#ifdef _WIN32
+			PROCESS_MEMORY_COUNTERS counters{};
+			GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+			return counters.PeakWorkingSetSize;
+#else
+			rusage usage{};
+			getrusage(RUSAGE_SELF, &usage);
+			return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+		}
+
+		template <size_t... Indices>
+		static void AddComponentHelpers(JsonParseCoordinator& parser, Vector<gsl::owner<IJsonParseHelper*>>& helpers, bool isDeclared, index_sequence<Indices...>)
+		{
+			(helpers.PushBack(new ComponentParseHelper<Indices>(isDeclared)), ...);
+			for (auto* helper : helpers)
+			{
+				parser.AddHelper(*helper);
+			}
+		}
+
+		static size_t CountEntities(Scope& root)
+		{
+			size_t count = 0;
+			for (size_t i = 0; i < root.Size(); ++i)
+			{
+				Datum& area = root[i];
+				for (size_t j = 0; j < area.Size(); ++j)
+				{
+					count += area[j]["Entities"].Size();
+				}
+			}
+			return count;
+		}
+
+		static void RunTraversalBenchmarks(const string& treeName, Scope& root, size_t expectedCount)
+		{
+			Logger::WriteMessage(treeName.c_str());
+
+			auto start = Clock::now();
+			size_t count = VisitRecursive(root);
+			Report("  Recursive", start, count);
+			Assert::AreEqual(expectedCount, count);
+
+			count = 0;
+			start = Clock::now();
+			ScopeTraversal::ForEachScope(root, [&count](Scope& s, size_t) { VisitWork(s); ++count; });
+			Report("  Depth first", start, count);
+			Assert::AreEqual(expectedCount, count);
+
+			count = 0;
+			start = Clock::now();
+			ScopeTraversal::ForEachScope(root, [&count](Scope& s, size_t) { VisitWork(s); ++count; }, ScopeTraversal::Order::BreadthFirst);
+			Report("  Breadth first", start, count);
+			Assert::AreEqual(expectedCount, count);
+
+			atomic<size_t> parallelCount{ 0 };
+			start = Clock::now();
+			ScopeTraversal::ParallelForEachScope(root, [&parallelCount](Scope& s, size_t) { VisitWork(s); ++parallelCount; });
+			Report("  Parallel (" + to_string(thread::hardware_concurrency()) + " threads)", start, parallelCount);
+			Assert::AreEqual(expectedCount, parallelCount.load());
+		}
+
+		template <typename TSpawn>
+		static void RunInstancingBenchmark(const string& name, Vector<Scope*>& instances, size_t count, TSpawn spawn)
+		{
+#ifdef _DEBUG
+			_CrtMemState before, after, diff;
+			_CrtMemCheckpoint(&before);
+#endif
+			auto start = Clock::now();
+			for (size_t i = 0; i < count; ++i)
+			{
+				instances.PushBack(spawn());
+			}
+			Report(name, start, count * 3);
+#ifdef _DEBUG
+			_CrtMemCheckpoint(&after);
+			_CrtMemDifference(&diff, &before, &after);
+			Logger::WriteMessage(("  Heap: " + to_string(diff.lSizes[_NORMAL_BLOCK]) + " bytes in " + to_string(diff.lCounts[_NORMAL_BLOCK]) + " blocks").c_str());
+#endif
+		}
+
+		template <typename TAttributed>
+		static void RunSpawnBenchmark(const string& name, size_t count)
+		{
+			Vector<Scope*> instances;
+			instances.Reserve(count);
+
+			auto start = Clock::now();
+			for (size_t i = 0; i < count; ++i)
+			{
+				instances.PushBack(new TAttributed());
+			}
+			Report(name, start, count);
+
+			const size_t expectedSize = TypeManager::GetSignaturesForType(TAttributed::TypeIdClass()).Size() + 1;
+			Assert::AreEqual(expectedSize, instances[count - 1]->Size());
+			Assert::IsTrue((*instances[count - 1])["this"].Get<RTTI*>() == instances[count - 1]);
+
+			start = Clock::now();
+			DeleteAll(instances);
+			Report("  Teardown", start, count);
+		}
+
+		/// <summary>
+		/// HandWrittenAvatarSignatures - Avatar's signatures written out the way every type did before StaticSignatures().
+		/// </summary>
+		static const Vector<Signature> HandWrittenAvatarSignatures()
+		{
+			return Vector<Signature>
+			{
+				{ "Name"s, Datum::DatumType::String, 1, Avatar::StaticSignatures()[0].offset },
+				{ "Transform"s, Datum::DatumType::Matrix, 1, Avatar::StaticSignatures()[1].offset },
+				{ "Actions"s, Datum::DatumType::Table, 0, 0 },
+				{ "Children"s, Datum::DatumType::Table, 0, 0 },
+				{ "Health"s, Datum::DatumType::Integer, 1, Avatar::StaticSignatures()[4].offset },
+				{ "Velocity"s, Datum::DatumType::Vector, 1, Avatar::StaticSignatures()[5].offset },
+				{ "Dps"s, Datum::DatumType::Float, 1, Avatar::StaticSignatures()[6].offset }
+			};
+		}
+
+		/// <summary>
+		/// BuildEventMessage - An attributed event message with four arguments. The message owns the GameObject it carries.
+		/// </summary>
+		static EventMessageAttributed BuildEventMessage(int damage, const string& source)
+		{
+			EventMessageAttributed message;
+			message.SetGameObject(*new GameObject());
+			message["Damage"] = damage;
+			message["Source"] = source;
+			message["Direction"] = vec4(1.0f, 0.0f, 0.0f, 0.0f);
+			message["Critical"] = damage * 1.5f;
+			return message;
+		}
+
+#ifdef _DEBUG
+		/// <summary>
+		/// CountAllocations - Debug heap hook counting every allocation made while it is installed.
+		/// </summary>
+		static int CountAllocations(int allocType, void*, size_t, int, long, const unsigned char*, int)
+		{
+			if (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC)
+			{
+				++_allocationCount;
+			}
+			return TRUE;
+		}
+
+		static inline size_t _allocationCount = 0;
+#endif
+
+		/// <summary>
+		/// RunOnThreads - Runs work on threadCount threads, released together, and returns the milliseconds until the last one finished.
+		/// </summary>
+		template <typename TWork>
+		static double RunOnThreads(size_t threadCount, TWork work)
+		{
+			atomic<bool> isStarted{ false };
+			Vector<thread> threads;
+			threads.Reserve(threadCount);
+			for (size_t i = 0; i < threadCount; ++i)
+			{
+				threads.PushBack(thread([&isStarted, &work] {
+					while (isStarted == false)
+					{
+						this_thread::yield();
+					}
+					work();
+				}));
+			}
+
+			auto start = Clock::now();
+			isStarted = true;
+			for (thread& worker : threads)
+			{
+				worker.join();
+			}
+			return chrono::duration<double, milli>(Clock::now() - start).count();
+		}
+
+		static void DeleteAll(Vector<Scope*>& instances)
+		{
+			for (Scope* instance : instances)
+			{
+				delete instance;
+			}
+			instances.Clear();
+		}
+
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState BenchmarkTests::_startMemState;
+}
@@ -0,0 +1,368 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include "Scope.h"
+#include "ChangeJournal.h"
+#include "JsonTableWriter.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ChangeJournalTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			ChangeJournal::Disable();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestDisabledByDefault)
+		{
+			Assert::IsFalse(ChangeJournal::IsEnabled());
+
+			Scope s;
+			s["Health"] = 10;
+			s["Health"].Set(20);
+
+			Assert::AreEqual(0_z, ChangeJournal::Size());
+			Assert::AreEqual(0_z, ChangeJournal::Capacity());
+			Assert::IsFalse(s["Health"].IsDirty());
+
+			Assert::ExpectException<runtime_error>([] { ChangeJournal::Enable(0); });
+		}
+
+		TEST_METHOD(TestDatumMutationsAreJournaled)
+		{
+			ChangeJournal::Enable(16);
+			Assert::IsTrue(ChangeJournal::IsEnabled());
+			Assert::AreEqual(16_z, ChangeJournal::Capacity());
+
+			Scope s;
+			Datum& health = s.Append("Health");
+			health = 10;
+			health.Set(20);
+			health.PushBack(30);
+			health.RemoveAt(0);
+
+			Assert::AreEqual(5_z, ChangeJournal::Size());
+
+			const ChangeJournal::ChangeType expected[] =
+			{
+				ChangeJournal::ChangeType::Append,
+				ChangeJournal::ChangeType::PushBack,
+				ChangeJournal::ChangeType::Set,
+				ChangeJournal::ChangeType::PushBack,
+				ChangeJournal::ChangeType::RemoveAt
+			};
+			const size_t expectedIndex[] = { 0, 0, 0, 1, 0 };
+
+			for (size_t i = 0; i < ChangeJournal::Size(); ++i)
+			{
+				const ChangeJournal::Entry& entry = ChangeJournal::At(i);
+				Assert::IsTrue(entry._scope == &s);
+				Assert::AreEqual("Health"s, entry._key);
+				Assert::IsTrue(entry._type == expected[i]);
+				Assert::AreEqual(expectedIndex[i], entry._index);
+			}
+
+			Assert::ExpectException<runtime_error>([] { ChangeJournal::At(5); });
+
+			ChangeJournal::Checkpoint();
+			Assert::AreEqual(0_z, ChangeJournal::Size());
+			Assert::AreEqual(16_z, ChangeJournal::Capacity());
+
+			//	Free standing Datums are marked dirty but have no scope to journal against
+			Datum loose;
+			loose = 5;
+			Assert::IsTrue(loose.IsDirty());
+			Assert::AreEqual(0_z, ChangeJournal::Size());
+		}
+
+		TEST_METHOD(TestJournalIsBounded)
+		{
+			ChangeJournal::Enable(2);
+
+			Scope s;
+			Datum& d = s.Append("Value");
+			d = 1;
+			d.Set(2);
+
+			Assert::AreEqual(2_z, ChangeJournal::Size());
+			Assert::AreEqual(1_z, ChangeJournal::DroppedCount());
+			Assert::IsTrue(ChangeJournal::At(0)._type == ChangeJournal::ChangeType::PushBack);
+			Assert::IsTrue(ChangeJournal::At(1)._type == ChangeJournal::ChangeType::Set);
+
+			d.Set(3);
+			Assert::AreEqual(2_z, ChangeJournal::DroppedCount());
+			Assert::IsTrue(ChangeJournal::At(0)._type == ChangeJournal::ChangeType::Set);
+
+			ChangeJournal::Checkpoint();
+			Assert::AreEqual(0_z, ChangeJournal::DroppedCount());
+
+			size_t epoch = ChangeJournal::Epoch();
+			ChangeJournal::Enable(4);
+			Assert::AreEqual(epoch + 1, ChangeJournal::Epoch());
+		}
+
+		TEST_METHOD(TestAdoptAndOrphanAreJournaled)
+		{
+			ChangeJournal::Enable();
+
+			Scope parent;
+			Scope other;
+			Scope* child = new Scope();
+
+			parent.Adopt(*child, "Children");
+			Assert::IsTrue(ChangeJournal::At(ChangeJournal::Size() - 1)._type == ChangeJournal::ChangeType::Adopt);
+			Assert::IsTrue(ChangeJournal::At(ChangeJournal::Size() - 1)._scope == &parent);
+
+			ChangeJournal::Checkpoint();
+			other.Adopt(*child, "Moved");
+
+			//	Orphaning is journaled once, not again as the RemoveAt it is made of
+			size_t orphanCount = 0;
+			for (size_t i = 0; i < ChangeJournal::Size(); ++i)
+			{
+				const ChangeJournal::Entry& entry = ChangeJournal::At(i);
+				if (entry._scope == &parent)
+				{
+					Assert::IsTrue(entry._type == ChangeJournal::ChangeType::Orphan);
+					Assert::AreEqual("Children"s, entry._key);
+					Assert::AreEqual(0_z, entry._index);
+					++orphanCount;
+				}
+			}
+			Assert::AreEqual(1_z, orphanCount);
+			Assert::AreEqual(0_z, parent["Children"].Size());
+			Assert::IsTrue(parent.IsDirty());
+			Assert::IsTrue(parent["Children"].IsDirty());
+		}
+
+		TEST_METHOD(TestSuppression)
+		{
+			ChangeJournal::Enable();
+			Scope root;
+			root.ClearDirty();
+
+			{
+				ChangeJournal::Suppression suppression;
+				{
+					ChangeJournal::Suppression nested;
+					Assert::IsFalse(ChangeJournal::IsEnabled());
+				}
+				Assert::IsFalse(ChangeJournal::IsEnabled());
+				root["Health"] = 10;
+				root.AppendScope("Child");
+			}
+
+			//	Nothing done under a suppression is journaled or dirtied
+			Assert::AreEqual(0_z, ChangeJournal::Size());
+			Assert::IsFalse(root.IsDirty());
+			Assert::IsTrue(ChangeJournal::IsEnabled());
+
+			root["Health"].Set(20);
+			Assert::AreEqual(1_z, ChangeJournal::Size());
+			Assert::IsTrue(root.IsDirty());
+		}
+
+		TEST_METHOD(TestDirtyBitsPropagateUpward)
+		{
+			ChangeJournal::Enable();
+
+			Scope root;
+			Scope& left = root.AppendScope("Left");
+			Scope& right = root.AppendScope("Right");
+			Scope& leaf = left.AppendScope("Leaf");
+			leaf["Health"] = 10;
+			right["Health"] = 10;
+
+			//	Scopes start dirty
+			Assert::IsTrue(root.IsDirty());
+			Assert::IsTrue(leaf.IsDirty());
+
+			root.ClearDirty();
+			Assert::IsFalse(root.IsDirty());
+			Assert::IsFalse(left.IsDirty());
+			Assert::IsFalse(right.IsDirty());
+			Assert::IsFalse(leaf.IsDirty());
+			Assert::IsFalse(leaf["Health"].IsDirty());
+
+			leaf["Health"].Set(5);
+			Assert::IsTrue(leaf["Health"].IsDirty());
+			Assert::IsTrue(leaf.IsDirty());
+			Assert::IsTrue(left.IsDirty());
+			Assert::IsTrue(root.IsDirty());
+			Assert::IsFalse(right.IsDirty());
+			Assert::IsFalse(right["Health"].IsDirty());
+
+			root.ClearDirty();
+			right.MarkDirty();
+			Assert::IsTrue(root.IsDirty());
+			Assert::IsFalse(left.IsDirty());
+		}
+
+		TEST_METHOD(TestWriteRoundTrip)
+		{
+			ScopeFactory scopeFactory;
+
+			//	The parser visits keys alphabetically, so build the tree in that order for operator== to match.
+			Scope root;
+			Scope& child = root.AppendScope("Children");
+			child["Dps"] = 0.1f;
+			child.AppendScope("Grandchildren")["Name"] = "Leaf"s;
+			root.AppendScope("Children")["Health"] = 3;
+			root["Dps"] = 1.5f;
+			root["Health"] = 80;
+			root["Health"].PushBack(90);
+			root["Name"] = "Root \"quoted\""s;
+			root["Transform"] = mat4x4(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+			root["Velocity"] = vec4(1.0f, 2.5f, 3.0f, 4.0f);
+
+			std::string text = JsonTableWriter::Write(root);
+
+			Scope loaded;
+			SharedTableData data(loaded);
+			JsonParseCoordinator parseMaster(data);
+			JsonTableParseHelper helper;
+			parseMaster.AddHelper(helper);
+			parseMaster.Parse(text);
+
+			Assert::IsTrue(loaded == root);
+		}
+
+		TEST_METHOD(TestIncrementalSave)
+		{
+			ScopeFactory scopeFactory;
+			JsonTableWriter writer;
+
+			Scope root;
+			Scope& left = root.AppendScope("Left");
+			Scope& right = root.AppendScope("Right");
+			left["Health"] = 10;
+			right["Health"] = 20;
+			right.AppendScope("Leaf")["Health"] = 30;
+
+			//	Tracking off - always a full write
+			writer.Save(root);
+			Assert::AreEqual(4_z, writer.RewrittenCount());
+			writer.Save(root);
+			Assert::AreEqual(4_z, writer.RewrittenCount());
+			Assert::AreEqual(0_z, writer.ReusedCount());
+
+			ChangeJournal::Enable();
+
+			//	First save of a new epoch is a full write, the next one with no changes reuses the root
+			writer.Save(root);
+			Assert::AreEqual(4_z, writer.RewrittenCount());
+			Assert::IsFalse(root.IsDirty());
+			writer.Save(root);
+			Assert::AreEqual(0_z, writer.RewrittenCount());
+			Assert::AreEqual(1_z, writer.ReusedCount());
+
+			left["Health"].Set(15);
+			const std::string& text = writer.Save(root);
+			Assert::AreEqual(2_z, writer.RewrittenCount());
+			Assert::AreEqual(1_z, writer.ReusedCount());
+			Assert::AreEqual(JsonTableWriter::Write(root), text);
+
+			std::string copy = text;
+			Scope loaded;
+			SharedTableData data(loaded);
+			JsonParseCoordinator parseMaster(data);
+			JsonTableParseHelper helper;
+			parseMaster.AddHelper(helper);
+			parseMaster.Parse(copy);
+			Assert::IsTrue(loaded == root);
+
+			writer.Reset();
+			writer.Save(root);
+			Assert::AreEqual(4_z, writer.RewrittenCount());
+		}
+
+		TEST_METHOD(TestSaveAfterAddressReuse)
+		{
+			JsonTableWriter writer;
+			ChangeJournal::Enable();
+
+			//	A clean Scope made where a saved one was destroyed isn't given the destroyed one's text
+			alignas(Scope) std::byte storage[sizeof(Scope)];
+			Scope* first = new (storage) Scope();
+			(*first)["Health"] = 10;
+			writer.Save(*first);
+			first->~Scope();
+
+			Scope* second = new (storage) Scope();
+			(*second)["Armor"] = 20;
+			second->ClearDirty();
+			const std::string text = writer.Save(*second);
+			Assert::AreEqual(JsonTableWriter::Write(*second), text);
+			Assert::AreEqual(1_z, writer.RewrittenCount());
+			second->~Scope();
+		}
+
+		TEST_METHOD(TestSaveDropsRemovedScopes)
+		{
+			JsonTableWriter writer;
+			ChangeJournal::Enable();
+
+			Scope root;
+			Scope& keep = root.AppendScope("Keep");
+			keep["Health"] = 10;
+			writer.Save(root);
+			Assert::AreEqual(2_z, writer.CachedCount());
+
+			//	Scopes come and go between saves, the text of the removed ones doesn't pile up
+			for (int i = 0; i < 100; ++i)
+			{
+				Scope& temp = root.AppendScope("Temp");
+				temp.AppendScope("Leaf")["Health"] = i;
+				writer.Save(root);
+				Assert::IsTrue(writer.CachedCount() <= 8_z);
+
+				delete &temp;
+				const std::string& text = writer.Save(root);
+				Assert::AreEqual(JsonTableWriter::Write(root), text);
+				Assert::IsTrue(writer.CachedCount() <= 8_z);
+			}
+
+			//	Clean subtrees that were only reused still keep their text
+			keep["Health"].Set(20);
+			writer.Save(root);
+			Assert::AreEqual(2_z, writer.RewrittenCount());
+			Assert::AreEqual(JsonTableWriter::Write(root), writer.Save(root));
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState ChangeJournalTests::_startMemState;
+}
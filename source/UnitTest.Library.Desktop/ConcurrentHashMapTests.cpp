@@ -0,0 +1,219 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include <atomic>
+#include <thread>
+#include "ConcurrentHashMap.h"
+#include "Vector.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ConcurrentHashMapTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestInsertAndFind)
+		{
+			ConcurrentHashMap<string, int> map;
+			Assert::IsTrue(map.IsEmpty());
+			Assert::IsNull(map.Find("a"s));
+			Assert::ExpectException<runtime_error>([&map] { map.At("a"s); });
+
+			Assert::IsTrue(map.Insert(make_pair("a"s, 1)));
+			const pair<const string, int> b("b"s, 2);
+			Assert::IsTrue(map.Insert(b));
+			Assert::IsFalse(map.Insert(make_pair("a"s, 10)));
+			Assert::AreEqual(2_z, map.Size());
+			Assert::AreEqual(1, map.At("a"s));
+			Assert::AreEqual(2, *map.Find("b"s));
+			Assert::IsTrue(map.ContainsKey("b"s));
+			Assert::IsFalse(map.ContainsKey("c"s));
+
+			//	Values stay put while the table grows around them
+			const int* a = map.Find("a"s);
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::IsTrue(map.Insert(make_pair(to_string(i), i)));
+			}
+			Assert::AreEqual(102_z, map.Size());
+			Assert::IsTrue(a == map.Find("a"s));
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i, map.At(to_string(i)));
+			}
+		}
+
+		TEST_METHOD(TestRemoveAndClear)
+		{
+			ConcurrentHashMap<size_t, string> map(4);
+			Assert::IsTrue(map.IsEmpty());
+			for (size_t i = 0; i < 50; ++i)
+			{
+				map.Insert(make_pair(i, to_string(i)));
+			}
+
+			Assert::IsFalse(map.Remove(50));
+			for (size_t i = 0; i < 50; i += 2)
+			{
+				Assert::IsTrue(map.Remove(i));
+			}
+			Assert::AreEqual(25_z, map.Size());
+			for (size_t i = 0; i < 50; ++i)
+			{
+				Assert::AreEqual(i % 2 == 1, map.ContainsKey(i));
+			}
+
+			map.Clear();
+			Assert::IsTrue(map.IsEmpty());
+			Assert::IsNull(map.Find(1));
+			map.Clear();
+
+			Assert::IsTrue(map.Insert(make_pair(1_z, "one"s)));
+			Assert::IsTrue(map.Remove(1));
+			Assert::IsTrue(map.IsEmpty());
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			ConcurrentHashMap<int, int> map;
+			map.Reserve(100);
+			map.Insert(make_pair(1, 1));
+			map.Reserve(10);
+			Assert::AreEqual(1, map.At(1));
+			Assert::AreEqual(1_z, map.Size());
+		}
+
+		TEST_METHOD(TestFreeze)
+		{
+			ConcurrentHashMap<string, int> map;
+			map.Freeze();
+			Assert::IsTrue(map.IsFrozen());
+			Assert::IsNull(map.Find("a"s));
+
+			for (int i = 0; i < 50; ++i)
+			{
+				map.Insert(make_pair(to_string(i), i));
+			}
+			Assert::IsFalse(map.IsFrozen());
+
+			//	Frozen lookups hand out the same values as the table
+			const int* value = map.Find("7"s);
+			map.Freeze();
+			Assert::IsTrue(map.IsFrozen());
+			Assert::IsTrue(value == map.Find("7"s));
+			for (int i = 0; i < 50; ++i)
+			{
+				Assert::AreEqual(i, map.At(to_string(i)));
+			}
+			Assert::IsFalse(map.ContainsKey("50"s));
+
+			//	Reserving keeps the nodes, so the frozen table stays valid
+			map.Reserve(500);
+			Assert::IsTrue(map.IsFrozen());
+			Assert::AreEqual(7, map.At("7"s));
+
+			//	Every write thaws the map
+			Assert::IsFalse(map.Insert(make_pair("7"s, 70)));
+			Assert::IsTrue(map.IsFrozen());
+			Assert::IsTrue(map.Insert(make_pair("50"s, 50)));
+			Assert::IsFalse(map.IsFrozen());
+			Assert::AreEqual(50, map.At("50"s));
+
+			map.Freeze();
+			Assert::IsTrue(map.Remove("7"s));
+			Assert::IsFalse(map.IsFrozen());
+			Assert::IsFalse(map.ContainsKey("7"s));
+
+			map.Freeze();
+			map.Clear();
+			Assert::IsFalse(map.IsFrozen());
+			Assert::IsTrue(map.IsEmpty());
+		}
+
+		TEST_METHOD(TestConcurrentReaders)
+		{
+			ConcurrentHashMap<int, int> map;
+			const int stableCount = 64;
+			for (int i = 0; i < stableCount; ++i)
+			{
+				map.Insert(make_pair(i, i * 2));
+			}
+
+			//	Readers look up the stable keys while a writer churns others
+			atomic<bool> isDone = false;
+			atomic<size_t> misses = 0;
+			Vector<thread> readers;
+			for (size_t t = 0; t < 4; ++t)
+			{
+				readers.PushBack(thread([&map, &isDone, &misses] {
+					while (isDone == false)
+					{
+						for (int i = 0; i < stableCount; ++i)
+						{
+							const int* value = map.Find(i);
+							if (value == nullptr || *value != i * 2)
+							{
+								++misses;
+							}
+						}
+					}
+				}));
+			}
+
+			for (int round = 0; round < 200; ++round)
+			{
+				for (int i = stableCount; i < stableCount + 16; ++i)
+				{
+					map.Insert(make_pair(i, round));
+				}
+				for (int i = stableCount; i < stableCount + 16; ++i)
+				{
+					map.Remove(i);
+				}
+			}
+			isDone = true;
+			for (thread& reader : readers)
+			{
+				reader.join();
+			}
+
+			Assert::AreEqual(0_z, misses.load());
+			Assert::AreEqual(static_cast<size_t>(stableCount), map.Size());
+			Rcu::Reclaim();
+			Assert::AreEqual(0_z, Rcu::PendingCount());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState ConcurrentHashMapTests::_startMemState;
+}
@@ -0,0 +1,271 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include "AttributedFoo.h"
+#include "CookedScene.h"
+#include "IFactory.h"
+#include "TypeManager.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	ConcreteFactory(AttributedFoo, Scope)
+
+	TEST_CLASS(CookedSceneTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+			TypeManager::AddType<AttributedFoo>();
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestCookAndLoad)
+		{
+			ScopeFactory scopeFactory;
+			const string fileName = "CookedSceneTest.scene";
+
+			Scope root;
+			root["Name"] = "Root"s;
+			Datum& scores = root.Append("Scores"s);
+			scores = 1;
+			scores.PushBack(2);
+			scores.PushBack(3);
+			root["Speed"] = 2.5f;
+			root["Position"] = vec4(1.0f, 2.0f, 3.0f, 4.0f);
+			root["Transform"] = mat4x4(2.0f);
+			root.Append("Unknown"s);
+			Scope& area = root.AppendScope("Areas"s);
+			area["Tags"] = "Forest"s;
+
+			root.AppendScope("Areas"s).AppendScope("Nested"s)["Depth"] = 2;
+
+			{
+				const string cooked = CookedScene::Cook(root, 42);
+				ofstream file(fileName, ios::binary);
+				file.write(cooked.data(), static_cast<streamsize>(cooked.size()));
+			}
+
+			CookedScene scene(fileName);
+			Assert::IsTrue(scene.IsOpen());
+			Assert::AreEqual(uint64_t(42), scene.SourceHash());
+
+			//	Copied trees match the cooked one, unknown Datums aren't cooked
+			Scope copied;
+			scene.Load(copied);
+			Assert::IsNull(copied.Find("Unknown"s));
+			Assert::AreEqual(root.Size() - 1, copied.Size());
+
+			Assert::AreEqual(3_z, copied["Scores"].Size());
+			Assert::AreEqual(3, copied["Scores"].Get<int>(2));
+			Assert::AreEqual(2.5f, copied["Speed"].Get<float>());
+			Assert::IsTrue(copied["Position"].Get<vec4>() == vec4(1.0f, 2.0f, 3.0f, 4.0f));
+			Assert::IsTrue(copied["Transform"].Get<mat4x4>() == mat4x4(2.0f));
+			Assert::IsTrue(copied["Areas"][0] == area);
+			Assert::AreEqual(2, copied["Areas"][1]["Nested"][0]["Depth"].Get<int>());
+			Assert::IsTrue(copied["Areas"][1].GetParent() == &copied);
+			Assert::IsTrue(copied["Scores"].OwnsData());
+
+			//	Referenced arrays point into the file and stay writable, copy on write
+			{
+				Scope referenced;
+				scene.Load(referenced, CookedScene::LoadMode::Reference);
+				Datum& referencedScores = referenced["Scores"];
+				Assert::IsFalse(referencedScores.OwnsData());
+				Assert::AreEqual(2, referencedScores.Get<int>(1));
+				referencedScores.Set(20, 1);
+				Assert::AreEqual(20, referencedScores.Get<int>(1));
+				Assert::IsTrue(referenced["Transform"].Get<mat4x4>() == mat4x4(2.0f));
+				Assert::IsTrue(referenced["Name"].OwnsData());
+
+				//	Every referenced tree has a view of its own, writes to one don't show up in another or in copies
+				Scope second;
+				scene.Load(second, CookedScene::LoadMode::Reference);
+				Assert::IsFalse(second["Scores"].OwnsData());
+				Assert::AreEqual(2, second["Scores"].Get<int>(1));
+				second["Scores"].Set(30, 1);
+				Assert::AreEqual(20, referencedScores.Get<int>(1));
+
+				Scope third;
+				scene.Load(third);
+				Assert::AreEqual(2, third["Scores"].Get<int>(1));
+			}
+
+			//	Loading into a tree appends, as parsing more Json into it would
+			scene.Load(copied);
+			Assert::AreEqual(6_z, copied["Scores"].Size());
+			Assert::AreEqual(4_z, copied["Areas"].Size());
+
+			//	Type clashes with the target throw
+			Scope clash;
+			clash["Scores"] = "Text"s;
+			Assert::ExpectException<runtime_error>([&scene, &clash] { scene.Load(clash); });
+
+			scene.Close();
+			Assert::IsFalse(scene.IsOpen());
+			Assert::AreEqual(uint64_t(0), scene.SourceHash());
+			Assert::ExpectException<runtime_error>([&scene, &copied] { scene.Load(copied); });
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(TestAttributed)
+		{
+			ScopeFactory scopeFactory;
+			const string fileName = "CookedSceneAttributed.scene";
+
+			Scope root;
+			AttributedFoo* foo = new AttributedFoo();
+			root.Adopt(*foo, "Foo"s);
+			(*foo)["Integer"].Set(5);
+			(*foo)["VectorArray"].Set(vec4(7.0f), 1);
+			(*foo)["StringArray"].Set("Cooked"s);
+			(*foo)["scopeArray"][1]["Inner"] = 9;
+			foo->AppendAuxiliaryAttribute("Aux"s) = 3.0f;
+
+			//	Classes without a registered factory couldn't be loaded, so they aren't cooked
+			Assert::ExpectException<runtime_error>([&root] { CookedScene::Cook(root, 0); });
+
+			CookedScene scene;
+			{
+				AttributedFooFactory fooFactory;
+				{
+					const string cooked = CookedScene::Cook(root, 0);
+					ofstream file(fileName, ios::binary);
+					file.write(cooked.data(), static_cast<streamsize>(cooked.size()));
+				}
+
+				//	Prescribed values land in the members, prescribed tables are loaded into rather than added to
+				Assert::IsTrue(scene.Open(fileName));
+				Scope loaded;
+				scene.Load(loaded, CookedScene::LoadMode::Reference);
+				AttributedFoo* loadedFoo = loaded["Foo"][0].As<AttributedFoo>();
+				Assert::IsNotNull(loadedFoo);
+				Assert::AreEqual(5, (*loadedFoo)["Integer"].Get<int>());
+				Assert::IsTrue((*loadedFoo)["VectorArray"].Get<vec4>(1) == vec4(7.0f));
+				Assert::AreEqual("Cooked"s, (*loadedFoo)["StringArray"].Get<string>());
+				Assert::IsFalse((*loadedFoo)["IntegerArray"].OwnsData());
+				Assert::AreEqual(1_z, (*loadedFoo)["scope"].Size());
+				Assert::AreEqual(2_z, (*loadedFoo)["scopeArray"].Size());
+				Assert::AreEqual(9, (*loadedFoo)["scopeArray"][1]["Inner"].Get<int>());
+				Assert::AreEqual(3.0f, (*loadedFoo)["Aux"].Get<float>());
+				Assert::IsTrue((*loadedFoo)["this"].Get<RTTI*>() == loadedFoo);
+				Assert::IsTrue(loadedFoo->IsAuxiliaryAttribute("Aux"s));
+			}
+
+			Scope withoutFactory;
+			Assert::ExpectException<runtime_error>([&scene, &withoutFactory] { scene.Load(withoutFactory); });
+			scene.Close();
+
+			//	Trees that drifted from their signatures can't be cooked
+			AttributedFooFactory fooFactory;
+			Datum& integer = (*foo)["Integer"];
+			int* member = &integer.Get<int>();
+			int storage[2] = { 1, 2 };
+			integer.SetStorage(storage, 2);
+			Assert::ExpectException<runtime_error>([&root] { CookedScene::Cook(root, 0); });
+			integer.SetStorage(member, 1);
+			Assert::IsFalse(CookedScene::Cook(root, 0).empty());
+
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(TestCookFileAndStaleness)
+		{
+			ScopeFactory scopeFactory;
+			const string jsonFileName = "CookedSceneSource.json";
+			const string cookedFileName = "CookedSceneSource.scene";
+			auto writeJson = [&jsonFileName](int health)
+			{
+				ofstream file(jsonFileName, ios::binary);
+				file << R"json({ "Name": { "type": "string", "value": "Hero" },
+					"Health": { "type": "integer", "value": )json" << health << R"json( },
+					"Position": { "type": "vector", "value": "vec4(1, 2, 3, 4)" },
+					"Items": { "type": "table", "class": "Scope", "value": [
+						{ "type": "table", "value": { "Weight": { "type": "float", "value": 1.5 } } } ] } })json";
+			};
+
+			writeJson(100);
+			Assert::IsTrue(CookedScene::IsStale(jsonFileName, cookedFileName));
+			CookedScene::CookFile(jsonFileName, cookedFileName);
+			Assert::IsFalse(CookedScene::IsStale(jsonFileName, cookedFileName));
+
+			Scope loaded;
+			CookedScene scene(cookedFileName);
+			scene.Load(loaded);
+			Assert::AreEqual("Name"s, loaded.GetPair(0).first);
+			Assert::AreEqual(100, loaded["Health"].Get<int>());
+			Assert::IsTrue(loaded["Position"].Get<vec4>() == vec4(1.0f, 2.0f, 3.0f, 4.0f));
+			Assert::AreEqual(1.5f, loaded["Items"][0]["Weight"].Get<float>());
+			scene.Close();
+
+			//	Edited sources make the cook stale, a cook without its source is all there is
+			writeJson(50);
+			Assert::IsTrue(CookedScene::IsStale(jsonFileName, cookedFileName));
+			remove(jsonFileName.c_str());
+			Assert::IsFalse(CookedScene::IsStale(jsonFileName, cookedFileName));
+			Assert::ExpectException<runtime_error>([&jsonFileName, &cookedFileName] { CookedScene::CookFile(jsonFileName, cookedFileName); });
+
+			//	Files that aren't cooked scenes, or are cut short, are refused
+			{
+				ofstream file(cookedFileName, ios::binary);
+				file << "{ }";
+			}
+			Assert::IsTrue(CookedScene::IsStale(jsonFileName, cookedFileName));
+			Assert::ExpectException<runtime_error>([&cookedFileName] { CookedScene scene(cookedFileName); });
+
+			Scope root;
+			root["Values"] = 1;
+			string cooked = CookedScene::Cook(root, 0);
+			cooked[4] = 7;
+			{
+				ofstream file(cookedFileName, ios::binary);
+				file.write(cooked.data(), static_cast<streamsize>(cooked.size()));
+			}
+			Assert::ExpectException<runtime_error>([&cookedFileName] { CookedScene scene(cookedFileName); });
+
+			cooked = CookedScene::Cook(root, 0);
+			cooked[32] = 5;
+			{
+				ofstream file(cookedFileName, ios::binary);
+				file.write(cooked.data(), static_cast<streamsize>(cooked.size()));
+			}
+			CookedScene corrupt(cookedFileName);
+			Assert::ExpectException<runtime_error>([&corrupt, &loaded] { corrupt.Load(loaded); });
+			corrupt.Close();
+
+			Assert::IsFalse(scene.Open("CookedSceneMissing.scene"s));
+			remove(cookedFileName.c_str());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState CookedSceneTests::_startMemState;
+}
@@ -371,6 +371,44 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestBulkPushBack)
+		{
+			const int integers[] = { 1, 2, 3 };
+			const float floats[] = { 1.5f, 2.5f };
+			const vec4 vectors[] = { vec4(1.0f), vec4(2.0f) };
+			const mat4x4 matrices[] = { mat4x4(1.0f) };
+
+			//	Unknown Datums take the type of the values
+			Datum dInteger;
+			Assert::AreEqual(0_z, dInteger.PushBack(integers, 3));
+			Assert::IsTrue(dInteger.Type() == Datum::DatumType::Integer);
+			Assert::AreEqual(3_z, dInteger.Capacity());
+			Assert::AreEqual(3_z, dInteger.PushBack(integers, 2));
+			Assert::AreEqual(5_z, dInteger.Size());
+			Assert::AreEqual(2, dInteger.Get<int>(4));
+			Assert::AreEqual(5_z, dInteger.PushBack(integers, 0));
+
+			Datum dFloat;
+			dFloat = 0.5f;
+			Assert::AreEqual(1_z, dFloat.PushBack(floats, 2));
+			Assert::AreEqual(2.5f, dFloat.Back<float>());
+
+			Datum dVector;
+			dVector.PushBack(vectors, 2);
+			Assert::IsTrue(dVector.Get<vec4>(1) == vec4(2.0f));
+
+			Datum dMatrix;
+			dMatrix.PushBack(matrices, 1);
+			Assert::IsTrue(dMatrix.Front<mat4x4>() == mat4x4(1.0f));
+
+			//	Same rules as single PushBacks
+			Assert::ExpectException<runtime_error>([&dFloat, &integers] { dFloat.PushBack(integers, 3); });
+			int storage[2] = { 0, 0 };
+			Datum dExternal;
+			dExternal.SetStorage(storage, 2);
+			Assert::ExpectException<runtime_error>([&dExternal, &integers] { dExternal.PushBack(integers, 3); });
+		}
+
 		TEST_METHOD(TestRemoves)
 		{
 			Datum dInt(Datum::DatumType::Integer);
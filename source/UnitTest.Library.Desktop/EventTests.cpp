@@ -8,6 +8,9 @@
 #include "Event.h"
 #include "EventQueue.h"
 #include "FooSubscriber.h"
+#include "ActionEvent.h"
+#include "ReactionAttributed.h"
+#include "TypeManager.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -16,6 +19,27 @@ using namespace std::chrono_literals;
 
 namespace UnitTestLibraryDesktop
 {
+	/// <summary>
+	/// MessageProbe - Records what the attributed events delivered to it carried, while they are being delivered.
+	/// </summary>
+	class MessageProbe final : public IEventSubscriber
+	{
+	public:
+		void Notify(const EventPublisher& publisher) override
+		{
+			const EventMessageAttributed& message = static_cast<const Event<EventMessageAttributed>&>(publisher).Message();
+			IsOwnThis = (message.Find("this")->Get<RTTI*>() == &message);
+			Damage = message.Find("Damage")->Get<int>();
+			SubType = message.GetSubType();
+			++NotifyCount;
+		}
+
+		bool IsOwnThis = false;
+		int Damage = 0;
+		std::string SubType;
+		size_t NotifyCount = 0;
+	};
+
 	TEST_CLASS(EventTests)
 	{
 	public:
@@ -97,6 +121,69 @@ namespace UnitTestLibraryDesktop
 			Event<Foo>::UnsubscribeAll();
 		}
 
+		TEST_METHOD(TestActionEventArguments)
+		{
+			RegisterEventTypes();
+			GameState gameState;
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::time_point(0ms));
+			gameState.SetGameTime(gameTime);
+			EventQueue eventQueue(gameState);
+			gameState.SetEventQueue(eventQueue);
+
+			//	Messages own the GameObject they carry, this one goes with the event
+			gameState.SetCurrentGameObject(*new GameObject());
+
+			{
+				ActionEvent action;
+				action["Subtype"].Set("Hit"s);
+				action["Delay"].Set(0);
+				action["Damage"] = 12;
+				action.Update(gameState);
+			}
+			Assert::AreEqual(1_z, eventQueue.Size());
+
+			//	The message carries the action's arguments, but keeps its own "this"
+			MessageProbe probe;
+			Event<EventMessageAttributed>::Subscribe(probe);
+			eventQueue.Update(gameState);
+			Event<EventMessageAttributed>::UnsubscribeAll();
+			Assert::AreEqual(1_z, probe.NotifyCount);
+			Assert::IsTrue(probe.IsOwnThis);
+			Assert::AreEqual(12, probe.Damage);
+			Assert::AreEqual("Hit"s, probe.SubType);
+			Assert::IsTrue(eventQueue.IsEmpty());
+
+			TypeManager::Clear();
+		}
+
+		TEST_METHOD(TestReactionAttributedArguments)
+		{
+			RegisterEventTypes();
+			EventMessageAttributed message;
+			message.SetGameObject(*new GameObject());
+			message["Damage"] = 12;
+			Event<EventMessageAttributed> hit(message);
+			message.SetSubType("Other"s);
+			Event<EventMessageAttributed> other(message);
+
+			//	Only a matching subtype copies the arguments
+			ReactionAttributed reaction;
+			reaction.Notify(other);
+			Assert::IsNull(reaction.Find("Damage"));
+
+			//	Arguments are copied from the message into the reaction, which keeps its own "this". The message is unchanged.
+			reaction["Armor"] = 3;
+			reaction.Notify(hit);
+			Assert::AreEqual(12, reaction["Damage"].Get<int>());
+			Assert::AreEqual(3, reaction["Armor"].Get<int>());
+			Assert::IsTrue(reaction["this"].Get<RTTI*>() == &reaction);
+			Assert::IsNull(hit.Message().Find("Armor"));
+			Assert::IsTrue(hit.Message().Find("this")->Get<RTTI*>() == &hit.Message());
+
+			TypeManager::Clear();
+		}
+
 		TEST_METHOD(RTTIMacroCoverage)
 		{
 			FooSubscriber fooSub;
@@ -131,6 +218,14 @@ namespace UnitTestLibraryDesktop
 		}
 
 	private:
+		static void RegisterEventTypes()
+		{
+			TypeManager::AddType(GameObject::TypeIdClass(), GameObject::Signatures());
+			TypeManager::AddType(ActionList::TypeIdClass(), ActionList::Signatures());
+			TypeManager::AddType(ActionEvent::TypeIdClass(), ActionEvent::Signatures());
+			TypeManager::AddType(EventMessageAttributed::TypeIdClass(), EventMessageAttributed::Signatures());
+		}
+
 		static _CrtMemState _startMemState;
 	};
 
@@ -0,0 +1,127 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include "FactoryHandle.h"
+#include "Foo.h"
+#include "Scope.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	ConcreteFactory(Foo, RTTI)
+
+	TEST_CLASS(FactoryHandleTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestEmptyHandle)
+		{
+			FactoryHandle<RTTI> handle;
+			Assert::IsFalse(handle.IsValid());
+			Assert::IsFalse(static_cast<bool>(handle));
+			Assert::IsNull(handle.Create());
+			Assert::IsTrue(handle.CreateN(4).IsEmpty());
+			Assert::ExpectException<runtime_error>([&handle] { handle.ClassName(); });
+			Assert::ExpectException<runtime_error>([&handle] { handle.Pool(); });
+
+			//	Names without a registered factory resolve to an empty handle
+			Assert::IsTrue(FactoryHandle<RTTI>("Foo"s) == handle);
+			Assert::IsTrue(FactoryHandle<RTTI>::Of<Foo>() == handle);
+		}
+
+		TEST_METHOD(TestResolveByName)
+		{
+			FooFactory fooFactory;
+			const FactoryHandle<RTTI> handle("Foo"s);
+			Assert::IsTrue(handle.IsValid());
+			Assert::AreEqual("Foo"s, handle.ClassName());
+			Assert::IsTrue(&fooFactory.Pool() == &handle.Pool());
+
+			RTTI* product = handle.Create();
+			Assert::IsNotNull(product->As<Foo>());
+			delete product;
+
+			Vector<RTTI*> products = handle.CreateN(3);
+			Assert::AreEqual(3_z, products.Size());
+			for (RTTI* created : products)
+			{
+				Assert::IsNotNull(created->As<Foo>());
+				delete created;
+			}
+		}
+
+		TEST_METHOD(TestResolveByType)
+		{
+			{
+				ScopeFactory scopeFactory;
+				const FactoryHandle<Scope> byType = FactoryHandle<Scope>::Of<Scope>();
+				const FactoryHandle<Scope> byName("Scope"s);
+				Assert::IsTrue(byType.IsValid());
+				Assert::IsTrue(byType == byName);
+				Assert::IsTrue(&scopeFactory.Pool() == &byType.Pool());
+
+				Scope* scope = byType.Create();
+				Assert::AreEqual(1_z, scopeFactory.Pool().LiveCount());
+				delete scope;
+
+				//	Clearing the name table leaves the factory bound to its type
+				IFactory<Scope>::Clear();
+				Assert::IsFalse(FactoryHandle<Scope>("Scope"s).IsValid());
+				Assert::IsTrue(FactoryHandle<Scope>::Of<Scope>() == byType);
+			}
+
+			//	Destroying the factory unbinds it
+			Assert::IsFalse(FactoryHandle<Scope>::Of<Scope>().IsValid());
+			Assert::IsNull(IFactory<Scope>::FindFor<Scope>());
+		}
+
+		TEST_METHOD(TestEquality)
+		{
+			FooFactory fooFactory;
+			ScopeFactory scopeFactory;
+
+			const FactoryHandle<RTTI> foo("Foo"s);
+			FactoryHandle<RTTI> other;
+			Assert::IsTrue(foo != other);
+			other = FactoryHandle<RTTI>::Of<Foo>();
+			Assert::IsTrue(foo == other);
+			Assert::IsFalse(foo != other);
+
+			//	Each abstract product type has its own bindings
+			Assert::IsFalse(FactoryHandle<RTTI>::Of<Scope>().IsValid());
+			Assert::IsTrue(FactoryHandle<Scope>::Of<Scope>().IsValid());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState FactoryHandleTests::_startMemState;
+}
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include "IFactory.h"
 #include "Foo.h"
+#include "Scope.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -76,6 +77,27 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNull(foundFactory);
 		}
 
+		TEST_METHOD(TestFreeze)
+		{
+			{
+				const FooFactory fooFactory;
+				const BarFactory barFactory;
+				IFactory<RTTI>::Freeze();
+				Assert::IsTrue(IFactory<RTTI>::IsFrozen());
+				Assert::IsTrue(&fooFactory == reinterpret_cast<const FooFactory*>(IFactory<RTTI>::Find("Foo"s)));
+				Assert::IsTrue(&barFactory == reinterpret_cast<const BarFactory*>(IFactory<RTTI>::Find("Bar"s)));
+				Assert::IsNull(IFactory<RTTI>::Find("Baz"s));
+
+				RTTI* rtti = IFactory<RTTI>::Create("Foo"s);
+				Assert::IsNotNull(rtti);
+				delete rtti;
+			}
+
+			//	Removing the factories thawed the registry
+			Assert::IsFalse(IFactory<RTTI>::IsFrozen());
+			Assert::IsNull(IFactory<RTTI>::Find("Foo"s));
+		}
+
 		TEST_METHOD(ProductCreation)
 		{
 			RTTI* rtti = IFactory<RTTI>::Create("Foo");
@@ -97,7 +119,44 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNull(rtti);
 		}
 
-		
+
+		TEST_METHOD(TestCreateN)
+		{
+			Assert::IsTrue(IFactory<RTTI>::CreateN("Foo"s, 4).IsEmpty());
+
+			FooFactory fooFactory;
+			Vector<RTTI*> products = IFactory<RTTI>::CreateN("Foo"s, 4);
+			Assert::AreEqual(4_z, products.Size());
+			for (RTTI* product : products)
+			{
+				Assert::IsNotNull(product->As<Foo>());
+				delete product;
+			}
+
+			Assert::IsTrue(IFactory<RTTI>::CreateN("Foo"s, 0).IsEmpty());
+
+			//	Pooled products share a single block
+			ScopeFactory scopeFactory;
+			Vector<Scope*> scopes = IFactory<Scope>::CreateN("Scope"s, 50);
+			Assert::AreEqual(50_z, scopes.Size());
+			Assert::AreEqual(50_z, scopeFactory.Pool().Capacity());
+			Assert::AreEqual(50_z, scopeFactory.Pool().Allocations());
+			Assert::AreEqual(0_z, scopeFactory.Pool().Hits());
+
+			//	Back to back in one block
+			const ptrdiff_t stride = reinterpret_cast<char*>(scopes[1]) - reinterpret_cast<char*>(scopes[0]);
+			for (size_t i = 1; i < scopes.Size(); ++i)
+			{
+				Assert::AreEqual(stride, reinterpret_cast<char*>(scopes[i]) - reinterpret_cast<char*>(scopes[i - 1]));
+			}
+
+			for (Scope* scope : scopes)
+			{
+				delete scope;
+			}
+			Assert::AreEqual(0_z, scopeFactory.Pool().LiveCount());
+		}
+
 	private:
 		static _CrtMemState _startMemState;
 	};
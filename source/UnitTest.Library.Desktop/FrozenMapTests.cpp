@@ -0,0 +1,136 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "FrozenMap.h"
+#include "Vector.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FrozenMapTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestCompileTimeMap)
+		{
+			static constexpr auto map = MakeFrozenMap<string_view, int>({ { "integer", 1 }, { "float", 2 }, { "vector", 3 }, { "matrix", 4 }, { "string", 5 } });
+			static_assert(map.Size() == 5);
+			static_assert(map.At("vector") == 3);
+			static_assert(map.Find("pointer") == nullptr);
+
+			Assert::AreEqual(5_z, map.Size());
+			Assert::IsFalse(map.IsEmpty());
+			Assert::AreEqual(1, map.At("integer"));
+			Assert::AreEqual(5, *map.Find("string"));
+			Assert::IsTrue(map.ContainsKey("matrix"));
+			Assert::IsFalse(map.ContainsKey("Matrix"));
+			Assert::ExpectException<runtime_error>([] { map.At("table"); });
+
+			//	Every entry sits in its own slot
+			int sum = 0;
+			for (const auto& entry : map)
+			{
+				Assert::IsTrue(&entry.second == map.Find(entry.first));
+				sum += entry.second;
+			}
+			Assert::AreEqual(15, sum);
+		}
+
+		TEST_METHOD(TestIntegralKeys)
+		{
+			enum class Color { Red, Green, Blue };
+			static constexpr auto colors = MakeFrozenMap<Color, string_view>({ { Color::Red, "red" }, { Color::Green, "green" }, { Color::Blue, "blue" } });
+			static_assert(colors.At(Color::Green) == "green");
+			Assert::IsTrue(colors.At(Color::Blue) == "blue");
+
+			Vector<FrozenEntry<size_t, size_t>> entries;
+			for (size_t i = 0; i < 1000; ++i)
+			{
+				entries.PushBack({ i * 7919, i });
+			}
+
+			const FrozenMap<size_t, size_t> map(entries);
+			Assert::AreEqual(1000_z, map.Size());
+			for (size_t i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(i, map.At(i * 7919));
+			}
+			Assert::IsNull(map.Find(1));
+		}
+
+		TEST_METHOD(TestRuntimeMap)
+		{
+			Vector<FrozenEntry<string, string>> entries;
+			entries.Reserve(200);
+			for (size_t i = 0; i < 200; ++i)
+			{
+				entries.PushBack({ "Key"s + to_string(i), "Value"s + to_string(i) });
+			}
+
+			const FrozenMap<string, string> map(entries);
+			Assert::AreEqual(200_z, map.Size());
+			for (size_t i = 0; i < 200; ++i)
+			{
+				Assert::AreEqual("Value"s + to_string(i), map.At("Key"s + to_string(i)));
+			}
+			Assert::IsFalse(map.ContainsKey("Key200"s));
+			Assert::IsFalse(map.ContainsKey(""s));
+		}
+
+		TEST_METHOD(TestEmptyMap)
+		{
+			const FrozenMap<string, int> map{ Vector<FrozenEntry<string, int>>() };
+			Assert::AreEqual(0_z, map.Size());
+			Assert::IsTrue(map.IsEmpty());
+			Assert::IsNull(map.Find("a"s));
+			Assert::ExpectException<runtime_error>([&map] { map.At("a"s); });
+			Assert::IsTrue(map.begin() == map.end());
+		}
+
+		TEST_METHOD(TestDuplicateKeys)
+		{
+			Vector<FrozenEntry<string, int>> entries;
+			entries.PushBack({ "a"s, 1 });
+			entries.PushBack({ "b"s, 2 });
+			entries.PushBack({ "a"s, 3 });
+			Assert::ExpectException<runtime_error>([&entries] { FrozenMap<string, int> map(entries); UNREFERENCED_LOCAL(map); });
+
+			const FrozenEntry<int, int> literal[] = { { 1, 1 }, { 1, 2 } };
+			Assert::ExpectException<runtime_error>([&literal] { FrozenMap<int, int, 2> map(literal); UNREFERENCED_LOCAL(map); });
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState FrozenMapTests::_startMemState;
+}
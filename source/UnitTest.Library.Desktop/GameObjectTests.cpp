@@ -4,11 +4,12 @@
 #include <exception>
 #include <stdexcept>
 #include <functional>
+#include <fstream>
 #include "Foo.h"
 #include "JsonParseCoordinator.h"
 #include "JsonTableParseHelper.h"
 #include "TypeManager.h"
-#include "IFactory.h"
+#include "FactoryHandle.h"
 #include "GameObject.h"
 #include "Avatar.h"
 
@@ -153,6 +154,13 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNotNull(d);
 
 			Assert::ExpectException<std::runtime_error>([&world] {world.CreateGameObject("notAClass", "instanceName"); });
+
+			//	Test CreateGameObject from a resolved factory
+			const FactoryHandle<Scope> avatarHandle = FactoryHandle<Scope>::Of<Avatar>();
+			GameObject* created = world.CreateGameObject(avatarHandle, "Heroes");
+			Assert::IsTrue(created->Is(Avatar::TypeIdClass()));
+			Assert::IsTrue(created == &(*world.Find("Heroes"s))[0]);
+			Assert::ExpectException<std::runtime_error>([&world] {world.CreateGameObject(FactoryHandle<Scope>(), "instanceName"); });
 		}
 
 		TEST_METHOD(TestGameState)
@@ -175,6 +183,87 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(test.Size() == 7_z);
 		}
 
+		TEST_METHOD(TestParsingAllocations)
+		{
+#ifdef _DEBUG
+			const std::string fileName = "Content/JsonGameObjectInputTest.json";
+			Json::Value root;
+			{
+				std::ifstream file(fileName);
+				file >> root;
+			}
+
+			//	Every typed number, vector and matrix in the file reaches its Datum straight from the Json, no copy of the value is made on the way
+			Vector<const Json::Value*> declarations;
+			CollectDeclarations(root, declarations);
+			Assert::AreEqual(10_z, declarations.Size());
+
+			Vector<Datum> datums(declarations.Size());
+			for (const Json::Value* declaration : declarations)
+			{
+				datums.PushBack(Datum());
+				datums.Back().SetType(Datum::_setTypeJsonTableParseMap.At((*declaration)["type"].asCString()));
+				datums.Back().Reserve(1);
+			}
+
+			_allocationCount = 0;
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocations);
+			for (size_t i = 0; i < declarations.Size(); ++i)
+			{
+				const Json::Value& value = (*declarations[i])["value"];
+				datums[i].PushBackFromJsonValue(value);
+				datums[i].SetFromJsonValue(value, 0);
+			}
+			_CrtSetAllocHook(previousHook);
+			Assert::AreEqual(0_z, _allocationCount);
+			Assert::AreEqual(1_z, datums[2].Size());
+			Assert::AreEqual(80, datums[2].Get<int>());
+			Assert::IsTrue(datums[3].Get<mat4x4>() == mat4x4(1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1));
+
+			//	Parsing the whole file allocates what reading its Json and building its tree take, and nothing for passing values or keys between them
+			GameObjectFactory gameObjectFactory;
+			AvatarFactory avatarFactory;
+			GameObject warmUp;
+			SharedTableData tableData(warmUp);
+			JsonParseCoordinator parseMaster(tableData);
+			JsonTableParseHelper tableHelper;
+			parseMaster.AddHelper(tableHelper);
+			std::string parsedFileName = fileName;
+			parseMaster.ParseFromFile(parsedFileName);
+
+			size_t readCount;
+			{
+				_allocationCount = 0;
+				previousHook = _CrtSetAllocHook(CountAllocations);
+				std::ifstream file(fileName);
+				Json::Value reread;
+				file >> reread;
+				_CrtSetAllocHook(previousHook);
+				readCount = _allocationCount;
+			}
+
+			GameObject world;
+			tableData.SetRootScope(world);
+			parsedFileName = fileName;
+			_allocationCount = 0;
+			previousHook = _CrtSetAllocHook(CountAllocations);
+			parseMaster.ParseFromFile(parsedFileName);
+			_CrtSetAllocHook(previousHook);
+			const size_t parseCount = _allocationCount;
+
+			_allocationCount = 0;
+			previousHook = _CrtSetAllocHook(CountAllocations);
+			GameObject* copy = world.Clone();
+			_CrtSetAllocHook(previousHook);
+			const size_t copyCount = _allocationCount;
+			delete copy;
+
+			Logger::WriteMessage(("JsonGameObjectInputTest.json - read: " + std::to_string(readCount) + ", parse: " + std::to_string(parseCount) + ", copy of the tree: " + std::to_string(copyCount)).c_str());
+			Assert::IsTrue(parseCount <= readCount + copyCount);
+			Assert::AreEqual(warmUp.Size(), world.Size());
+#endif
+		}
+
 		TEST_METHOD(RTTIMacroCoverage)
 		{
 			GameObject gameObject;
@@ -237,6 +326,43 @@ namespace UnitTestLibraryDesktop
 		}
 
 	private:
+#ifdef _DEBUG
+		/// <summary>
+		/// CollectDeclarations - Gathers every typed attribute of a Json tree whose value is a single number, vector or matrix.
+		/// </summary>
+		static void CollectDeclarations(const Json::Value& value, Vector<const Json::Value*>& declarations)
+		{
+			if (value.isObject() && value["type"].isString() && value["value"].isObject() == false && value["value"].isArray() == false)
+			{
+				const std::string type = value["type"].asString();
+				if (type != "string" && type != "table")
+				{
+					declarations.PushBack(&value);
+				}
+				return;
+			}
+
+			for (const auto& member : value)
+			{
+				CollectDeclarations(member, declarations);
+			}
+		}
+
+		/// <summary>
+		/// CountAllocations - Debug heap hook counting every allocation made while it is installed.
+		/// </summary>
+		static int CountAllocations(int allocType, void*, size_t, int, long, const unsigned char*, int)
+		{
+			if (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC)
+			{
+				++_allocationCount;
+			}
+			return TRUE;
+		}
+
+		static inline size_t _allocationCount = 0;
+#endif
+
 		static _CrtMemState _startMemState;
 	};
 
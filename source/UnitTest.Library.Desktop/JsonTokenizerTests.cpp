@@ -0,0 +1,179 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "JsonTokenizer.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	using TokenType = JsonTokenizer::TokenType;
+
+	TEST_CLASS(JsonTokenizerTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestTokens)
+		{
+			const string json = R"({ "Name": "Bob", "Health": 100, "Dps": -1.5e2, "Alive": true, "Dead": false, "Target": null,
+				"List": [ 1, [ ], { } ], "Empty": { } })";
+			JsonTokenizer tokenizer(json);
+
+			const TokenType expected[] = {
+				TokenType::BeginObject,
+				TokenType::Key, TokenType::String,
+				TokenType::Key, TokenType::Integer,
+				TokenType::Key, TokenType::Real,
+				TokenType::Key, TokenType::Boolean,
+				TokenType::Key, TokenType::Boolean,
+				TokenType::Key, TokenType::Null,
+				TokenType::Key, TokenType::BeginArray, TokenType::Integer, TokenType::BeginArray, TokenType::EndArray, TokenType::BeginObject, TokenType::EndObject, TokenType::EndArray,
+				TokenType::Key, TokenType::BeginObject, TokenType::EndObject,
+				TokenType::EndObject,
+				TokenType::End };
+			const string_view texts[] = { "", "Name", "Bob", "Health", "100", "Dps", "-1.5e2", "Alive", "true", "Dead", "false", "Target", "null", "List" };
+
+			size_t i = 0;
+			for (TokenType type : expected)
+			{
+				Assert::IsTrue(type == tokenizer.Next());
+				Assert::IsTrue(type == tokenizer.Type());
+				if (i < std::size(texts))
+				{
+					Assert::IsTrue(texts[i] == tokenizer.Text());
+				}
+				++i;
+			}
+
+			Assert::IsTrue(TokenType::End == tokenizer.Next());
+			Assert::AreEqual(0_z, tokenizer.Depth());
+		}
+
+		TEST_METHOD(TestStrings)
+		{
+			const string json = R"([ "plain", "tab\tquote\"slash\/back\\", "\u00e9\u20AC\ud83d\ude00", "" ])";
+			JsonTokenizer tokenizer(json);
+			tokenizer.Next();
+
+			Assert::IsTrue(TokenType::String == tokenizer.Next());
+			Assert::IsTrue("plain"sv == tokenizer.Text());
+			Assert::IsTrue(tokenizer.Text().data() == json.data() + tokenizer.Offset() + 1);
+
+			tokenizer.Next();
+			Assert::IsTrue("tab\tquote\"slash/back\\"sv == tokenizer.Text());
+
+			tokenizer.Next();
+			Assert::IsTrue("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"sv == tokenizer.Text());
+
+			tokenizer.Next();
+			Assert::IsTrue(tokenizer.Text().empty());
+			Assert::IsTrue(TokenType::EndArray == tokenizer.Next());
+		}
+
+		TEST_METHOD(TestCommentsAndSkip)
+		{
+			const string json = "// A level\n{ /* skipped */ \"Area\": { \"Rooms\": [ { \"Size\": 4 }, [ 1, 2 ] ] }, \"Next\": 7 }\n";
+			JsonTokenizer tokenizer(json);
+			Assert::IsTrue(TokenType::BeginObject == tokenizer.Next());
+			Assert::AreEqual(json.find('{'), tokenizer.Offset());
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			Assert::IsTrue(TokenType::BeginObject == tokenizer.Next());
+			Assert::AreEqual(2_z, tokenizer.Depth());
+
+			tokenizer.Skip();
+			Assert::IsTrue(TokenType::EndObject == tokenizer.Type());
+			Assert::AreEqual(1_z, tokenizer.Depth());
+
+			Assert::IsTrue(TokenType::Key == tokenizer.Next());
+			Assert::IsTrue("Next"sv == tokenizer.Text());
+			Assert::IsTrue(TokenType::Integer == tokenizer.Next());
+			tokenizer.Skip();
+			Assert::IsTrue("7"sv == tokenizer.Text());
+			Assert::IsTrue(TokenType::EndObject == tokenizer.Next());
+			Assert::IsTrue(TokenType::End == tokenizer.Next());
+		}
+
+		TEST_METHOD(TestMalformed)
+		{
+			const string_view documents[] = {
+				"",
+				"{",
+				"{ \"a\" 1 }",
+				"{ \"a\": 1 ",
+				"{ \"a\": 1, }",
+				"{ a: 1 }",
+				"[ 1 2 ]",
+				"[ 1, ]",
+				"{ \"a\": [ 1 } }",
+				"{ \"a\": 01 }",
+				"{ \"a\": 1. }",
+				"{ \"a\": -x }",
+				"{ \"a\": tru }",
+				"{ \"a\": \"open }",
+				"{ \"a\": \"\\q\" }",
+				"{ \"a\": \"\\u12G4\" }",
+				"{ \"a\": \"\\ud83d\" }",
+				"{ } { }",
+				"{ /* open }" };
+
+			for (string_view document : documents)
+			{
+				Assert::ExpectException<runtime_error>([document]
+				{
+					JsonTokenizer tokenizer(document);
+					while (tokenizer.Next() != TokenType::End)
+					{
+					}
+				});
+			}
+
+			//	Errors name their line
+			JsonTokenizer tokenizer("{\n\"a\": 1,\n\"b\" 2 }");
+			string message;
+			try
+			{
+				while (tokenizer.Next() != TokenType::End)
+				{
+				}
+			}
+			catch (const runtime_error& error)
+			{
+				message = error.what();
+			}
+			Assert::IsTrue(message.find("line 3") != string::npos);
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState JsonTokenizerTests::_startMemState;
+}
@@ -0,0 +1,227 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <memory>
+#include <stdexcept>
+#include "AttributedFoo.h"
+#include "ChangeJournal.h"
+#include "IFactory.h"
+#include "JsonTableParseHelper.h"
+#include "LazyContent.h"
+#include "TypeManager.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	ConcreteFactory(AttributedFoo, Scope)
+
+	TEST_CLASS(LazyScopeTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+			TypeManager::AddType<AttributedFoo>();
+			LazyContent::ResetStats();
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestLazyParse)
+		{
+			ScopeFactory scopeFactory;
+			AttributedFooFactory fooFactory;
+			auto json = make_shared<const string>(R"json({ "Name": { "type": "string", "value": "Level" },
+				"Near": { "type": "table", "value": { "Health": { "type": "integer", "value": 10 } } },
+				"Far": { "type": "table", "value": [
+					{ "type": "table", "value": { "Index": { "type": "integer", "value": 0 },
+						"Inner": { "type": "table", "value": { "Depth": { "type": "integer", "value": 2 } } } } },
+					{ "type": "table", "value": { "Index": { "type": "integer", "value": 1 } } } ] },
+				"Foo": { "type": "table", "class": "AttributedFoo", "value": { "Integer": { "type": "integer", "value": 5 } } } })json");
+
+			Scope root;
+			{
+				SharedTableData data(root);
+				data.SetLazySource(json, *json);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+				parser.ParseStreaming(*json);
+			}
+
+			//	Plain tables are left as placeholders, Attributed ones are built
+			Assert::AreEqual(4_z, root.Size());
+			Assert::IsTrue(root["Near"][0].IsLazy());
+			Assert::IsTrue(root["Far"][0].IsLazy());
+			Assert::IsTrue(root["Far"][1].IsLazy());
+			Assert::IsFalse(root["Foo"][0].IsLazy());
+			Assert::AreEqual(5, root["Foo"][0]["Integer"].Get<int>());
+
+			LazyContent::Stats stats = LazyContent::GetStats();
+			Assert::AreEqual(3_z, stats._deferred);
+			Assert::AreEqual(0_z, stats._materialized);
+			Assert::AreEqual(stats._deferredBytes, stats.PendingBytes());
+
+			//	The first access fills a placeholder, and only that one. Its own tables are placeholders in turn.
+			Scope& far = root["Far"][0];
+			Assert::AreEqual(0, far["Index"].Get<int>());
+			Assert::IsFalse(far.IsLazy());
+			Assert::IsTrue(far.GetParent() == &root);
+			Assert::IsTrue(root["Far"][1].IsLazy());
+			Assert::IsTrue(far["Inner"][0].IsLazy());
+			Assert::IsTrue(far["Inner"][0].GetParent() == &far);
+
+			Scope* found = nullptr;
+			Assert::IsTrue(far["Inner"][0].Search("Name"s, found) == &root["Name"]);
+			Assert::IsTrue(found == &root);
+			Assert::AreEqual(2, far["Inner"][0].Find("Depth"s)->Get<int>());
+
+			stats = LazyContent::GetStats();
+			Assert::AreEqual(4_z, stats._deferred);
+			Assert::AreEqual(2_z, stats._materialized);
+
+			//	Copies share what they haven't materialized, and compare equal to the eager parse
+			const Scope copy = root;
+			Assert::IsTrue(copy.Find("Near"s)->Get<Scope*>()->IsLazy());
+			Scope eager;
+			{
+				SharedTableData data(eager);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+				parser.ParseStreaming(*json);
+			}
+			Assert::IsTrue(eager["Near"] == root["Near"]);
+			Assert::IsTrue(eager["Far"] == root["Far"]);
+			Assert::IsTrue(eager["Near"] == *copy.Find("Near"s));
+			Assert::IsFalse(root["Near"][0].IsLazy());
+
+			//	Text that isn't in the lazy source is copied
+			Scope other;
+			{
+				SharedTableData data(other);
+				data.SetLazySource(json, *json);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+				parser.ParseStreaming(R"({ "Table": { "type": "table", "value": { "A": { "type": "integer", "value": 1 } } } })");
+			}
+			Assert::IsTrue(other["Table"][0].IsLazy());
+			Assert::AreEqual(1, other["Table"][0]["A"].Get<int>());
+		}
+
+		TEST_METHOD(TestEvict)
+		{
+			ScopeFactory scopeFactory;
+			auto json = make_shared<const string>(R"({ "Area": { "type": "table", "value": { "Health": { "type": "integer", "value": 10 },
+				"Props": { "type": "table", "value": { } } } } })");
+
+			Scope root;
+			{
+				SharedTableData data(root);
+				data.SetLazySource(json, *json);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				parser.AddHelper(helper);
+				parser.ParseStreaming(*json);
+			}
+
+			Scope& area = root["Area"][0];
+			Assert::IsFalse(area.Evict());
+			Assert::IsFalse(root.Evict());
+
+			area["Health"] = 20;
+			area["Added"] = 1;
+			Assert::IsTrue(area.Evict());
+			Assert::IsTrue(area.IsLazy());
+			Assert::IsFalse(area.Evict());
+
+			//	Runtime changes are gone, the content is read again
+			Assert::AreEqual(2_z, area.Size());
+			Assert::AreEqual(10, area["Health"].Get<int>());
+			Assert::IsNull(area.Find("Added"s));
+
+			const LazyContent::Stats stats = LazyContent::GetStats();
+			Assert::AreEqual(1_z, stats._evicted);
+			Assert::AreEqual(2_z, stats._materialized);
+			Assert::AreEqual(3_z, stats._deferred);
+			Assert::AreEqual(2 * stats._evictedBytes, stats._materializedBytes);
+
+			//	Clearing forgets the content
+			area.Clear();
+			Assert::IsFalse(area.Evict());
+			delete &area;
+		}
+
+		TEST_METHOD(TestLazyContent)
+		{
+			ScopeFactory scopeFactory;
+			auto bad = make_shared<const string>(R"({ "A": { "type": "integer", "value": 1 }, "B": { "type": "nonsense", "value": 2 } })");
+
+			//	Content that fails leaves an empty placeholder, to fail again on the next access
+			Scope scope;
+			scope.SetLazyContent(make_shared<JsonLazyContent>(bad, *bad));
+			Assert::ExpectException<runtime_error>([&scope] { scope.Find("A"s); });
+			Assert::IsTrue(scope.IsLazy());
+			Assert::ExpectException<runtime_error>([&scope] { scope.Size(); });
+
+			//	Only empty, plain Scopes can be placeholders
+			Scope full;
+			full["A"] = 1;
+			Assert::ExpectException<runtime_error>([&full, &bad] { full.SetLazyContent(make_shared<JsonLazyContent>(bad, *bad)); });
+			AttributedFoo foo;
+			Assert::ExpectException<runtime_error>([&foo, &bad] { foo.SetLazyContent(make_shared<JsonLazyContent>(bad, *bad)); });
+
+			//	Moves carry the content
+			auto good = make_shared<const string>(R"({ "A": { "type": "integer", "value": 1 } })");
+			Scope lazy;
+			lazy.SetLazyContent(make_shared<JsonLazyContent>(good, *good));
+			Scope moved = std::move(lazy);
+			Assert::IsFalse(lazy.IsLazy());
+			Assert::IsTrue(moved.IsLazy());
+			moved.Materialize();
+			Assert::IsFalse(moved.IsLazy());
+			Assert::AreEqual(1_z, moved.Size());
+			Assert::AreEqual(1, moved["A"].Get<int>());
+
+			//	Filling a placeholder changes nothing: a const read that fills one isn't journaled and marks nothing dirty
+			Scope parent;
+			Scope& child = parent.AppendScope("Child"s);
+			child.SetLazyContent(make_shared<JsonLazyContent>(good, *good));
+			parent.ClearDirty();
+			ChangeJournal::Enable();
+			const Scope& constChild = child;
+			Assert::AreEqual(1, constChild.Find("A"s)->Get<int>());
+			Assert::IsFalse(child.IsLazy());
+			Assert::AreEqual(0_z, ChangeJournal::Size());
+			Assert::IsFalse(parent.IsDirty());
+			Assert::IsFalse(child.IsDirty());
+			ChangeJournal::Disable();
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState LazyScopeTests::_startMemState;
+}
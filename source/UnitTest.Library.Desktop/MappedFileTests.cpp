@@ -0,0 +1,132 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include "MappedFile.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(MappedFileTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestMapping)
+		{
+			const string fileName = "MappedFileTest.txt";
+			const string contents = "{ \"Health\": 100 }\n";
+			{
+				ofstream file(fileName, ios::binary);
+				file << contents;
+			}
+
+			MappedFile mapped(fileName);
+			Assert::IsTrue(mapped.IsOpen());
+			Assert::AreEqual(contents.size(), mapped.Size());
+			Assert::IsTrue(contents == mapped.View());
+			Assert::AreEqual('{', *mapped.Data());
+
+			MappedFile moved(std::move(mapped));
+			Assert::IsFalse(mapped.IsOpen());
+			Assert::IsNull(mapped.Data());
+			Assert::IsTrue(contents == moved.View());
+
+			mapped = std::move(moved);
+			Assert::IsTrue(mapped.IsOpen());
+			Assert::IsFalse(moved.IsOpen());
+
+			mapped.Close();
+			Assert::IsFalse(mapped.IsOpen());
+			Assert::AreEqual(0_z, mapped.Size());
+			Assert::IsTrue(mapped.View().empty());
+
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(TestCopyOnWrite)
+		{
+			const string fileName = "MappedFileCopyOnWrite.txt";
+			const string contents = "Cooked";
+			{
+				ofstream file(fileName, ios::binary);
+				file << contents;
+			}
+
+			MappedFile readOnly(fileName);
+			Assert::IsNull(readOnly.MutableData());
+			readOnly.Close();
+
+			//	Writes land in private pages, the file keeps its contents
+			MappedFile mapped(fileName, MappedFile::Access::CopyOnWrite);
+			Assert::IsTrue(mapped.IsOpen());
+			Assert::IsTrue(mapped.MutableData() == mapped.Data());
+			mapped.MutableData()[0] = 'B';
+			Assert::IsTrue("Booked"s == mapped.View());
+
+			MappedFile moved(std::move(mapped));
+			Assert::IsNull(mapped.MutableData());
+			Assert::AreEqual('B', *moved.MutableData());
+			moved.Close();
+			Assert::IsNull(moved.MutableData());
+
+			Assert::IsTrue(moved.Open(fileName, MappedFile::Access::CopyOnWrite));
+			Assert::IsTrue(contents == moved.View());
+			moved.Close();
+
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(TestEmptyAndMissingFiles)
+		{
+			const string fileName = "MappedFileEmpty.txt";
+			{
+				ofstream file(fileName, ios::binary);
+			}
+
+			MappedFile mapped;
+			Assert::IsFalse(mapped.IsOpen());
+			Assert::IsTrue(mapped.Open(fileName));
+			Assert::IsTrue(mapped.IsOpen());
+			Assert::AreEqual(0_z, mapped.Size());
+			Assert::IsTrue(mapped.View().empty());
+			remove(fileName.c_str());
+
+			Assert::IsFalse(mapped.Open("MappedFileMissing.txt"));
+			Assert::IsFalse(mapped.IsOpen());
+			Assert::IsFalse(MappedFile("MappedFileMissing.txt").IsOpen());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState MappedFileTests::_startMemState;
+}
@@ -0,0 +1,287 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include "ObjectPool.h"
+#include "Scope.h"
+#include "Foo.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ObjectPoolTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			ObjectPool pool(sizeof(Scope), 4);
+			Assert::AreEqual(sizeof(Scope), pool.ObjectSize());
+			Assert::AreEqual(0_z, pool.Capacity());
+			Assert::AreEqual(0_z, pool.LiveCount());
+			Assert::AreEqual(0_z, pool.Allocations());
+			Assert::AreEqual(0.0f, pool.HitRate());
+
+			//	Slots hold the free list link
+			ObjectPool tiny(1);
+			Assert::AreEqual(sizeof(void*), tiny.ObjectSize());
+
+			Assert::ExpectException<runtime_error>([] { ObjectPool empty(sizeof(Scope), 0); });
+		}
+
+		TEST_METHOD(TestAllocateAndRecycle)
+		{
+			ObjectPool pool(sizeof(int) * 4, 4);
+
+			void* first = pool.Allocate();
+			void* second = pool.Allocate();
+			void* third = pool.Allocate();
+			Assert::AreEqual(4_z, pool.Capacity());
+			Assert::AreEqual(3_z, pool.LiveCount());
+			Assert::AreEqual(3_z, pool.HighWaterMark());
+			Assert::AreEqual(3_z, pool.Allocations());
+			Assert::AreEqual(2_z, pool.Hits());
+			Assert::IsTrue(first != second && second != third);
+
+			//	Every slot sits at the alignment a plain new would give, including the first slot of a block and unpooled storage
+			for (void* object : { first, second, third })
+			{
+				Assert::AreEqual(0_z, reinterpret_cast<uintptr_t>(object) % __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+			}
+			void* unpooled = ObjectPool::AllocateUnpooled(sizeof(int));
+			Assert::AreEqual(0_z, reinterpret_cast<uintptr_t>(unpooled) % __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+			ObjectPool::Deallocate(unpooled);
+
+			ObjectPool::Deallocate(second);
+			Assert::AreEqual(2_z, pool.LiveCount());
+			Assert::AreEqual(3_z, pool.HighWaterMark());
+
+			//	Freed slots are handed out again before the pool grows
+			Assert::IsTrue(pool.Allocate() == second);
+			Assert::AreEqual(4_z, pool.Capacity());
+
+			void* fourth = pool.Allocate();
+			void* fifth = pool.Allocate();
+			Assert::AreEqual(0_z, reinterpret_cast<uintptr_t>(fifth) % __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+			Assert::AreEqual(8_z, pool.Capacity());
+			Assert::AreEqual(5_z, pool.HighWaterMark());
+			Assert::AreEqual(6_z, pool.Allocations());
+			Assert::AreEqual(4_z, pool.Hits());
+			Assert::AreEqual(4.0f / 6.0f, pool.HitRate());
+
+			for (void* object : { first, second, third, fourth, fifth })
+			{
+				ObjectPool::Deallocate(object);
+			}
+			Assert::AreEqual(0_z, pool.LiveCount());
+
+			ObjectPool::Deallocate(nullptr);
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			ObjectPool pool(sizeof(Scope));
+			pool.Reserve(100);
+			Assert::AreEqual(100_z, pool.Capacity());
+			pool.Reserve(10);
+			Assert::AreEqual(100_z, pool.Capacity());
+
+			Vector<Scope*> scopes;
+			for (size_t i = 0; i < 100; ++i)
+			{
+				scopes.PushBack(pool.Create<Scope>());
+			}
+			Assert::AreEqual(100_z, pool.Hits());
+			Assert::AreEqual(100_z, pool.Capacity());
+
+			for (Scope* scope : scopes)
+			{
+				delete scope;
+			}
+			Assert::AreEqual(0_z, pool.LiveCount());
+		}
+
+		TEST_METHOD(TestContiguousBatch)
+		{
+			ObjectPool pool(sizeof(Scope), 4);
+			Assert::IsNull(pool.AllocateContiguous(0));
+
+			//	Frees scattered over a block stay on the free list for single allocations
+			Vector<Scope*> singles;
+			for (size_t i = 0; i < 6; ++i)
+			{
+				singles.PushBack(pool.Create<Scope>());
+			}
+			delete singles[1];
+			delete singles[3];
+			delete singles[4];
+
+			Vector<Scope*> batch;
+			pool.Create<Scope>(5, batch);
+			Assert::AreEqual(5_z, batch.Size());
+			Assert::AreEqual(13_z, pool.Capacity());
+			Assert::AreEqual(8_z, pool.LiveCount());
+			for (size_t i = 0; i < batch.Size(); ++i)
+			{
+				Assert::AreEqual(i * pool.Stride(), static_cast<size_t>(reinterpret_cast<char*>(batch[i]) - reinterpret_cast<char*>(batch[0])));
+				Assert::IsTrue(batch[i] != singles[1] && batch[i] != singles[3] && batch[i] != singles[4]);
+				Assert::IsTrue(batch[i]->GetParent() == nullptr);
+			}
+
+			//	Small batches still grow by a whole block, the rest of it is free
+			Vector<Scope*> small;
+			pool.Create<Scope>(2, small);
+			Assert::AreEqual(17_z, pool.Capacity());
+			Assert::AreEqual(pool.Stride(), static_cast<size_t>(reinterpret_cast<char*>(small[1]) - reinterpret_cast<char*>(small[0])));
+
+			for (size_t i : { 0_z, 2_z, 5_z })
+			{
+				delete singles[i];
+			}
+			for (Scope* scope : batch)
+			{
+				delete scope;
+			}
+			for (Scope* scope : small)
+			{
+				delete scope;
+			}
+			Assert::AreEqual(0_z, pool.LiveCount());
+		}
+
+		TEST_METHOD(TestFactoryPooling)
+		{
+			Assert::IsTrue(IsPoolAllocated<Scope>::value);
+			Assert::IsFalse(IsPoolAllocated<Foo>::value);
+			Assert::IsNull(IFactory<Scope>::FindPool("Scope"s));
+
+			ScopeFactory scopeFactory;
+			ObjectPool* pool = IFactory<Scope>::FindPool("Scope"s);
+			Assert::IsTrue(pool == &scopeFactory.Pool());
+
+			Scope* created = IFactory<Scope>::Create("Scope"s);
+			Assert::AreEqual(1_z, pool->LiveCount());
+			created->AppendScope("Child"s)["Value"] = 5;
+
+			//	Scopes made without the factory, and their copies, are not pooled
+			Scope* copy = new Scope(*created);
+			Assert::AreEqual(1_z, pool->LiveCount());
+			Assert::AreEqual(5, (*copy)["Child"][0]["Value"].Get<int>());
+			delete copy;
+
+			delete created;
+			Assert::AreEqual(0_z, pool->LiveCount());
+
+			//	Despawned Scopes come back as the next spawns
+			for (size_t i = 0; i < 10; ++i)
+			{
+				delete IFactory<Scope>::Create("Scope"s);
+			}
+			Assert::AreEqual(11_z, pool->Allocations());
+			Assert::AreEqual(10_z, pool->Hits());
+			Assert::AreEqual(1_z, pool->HighWaterMark());
+		}
+
+		TEST_METHOD(TestPoolOutlivedByObjects)
+		{
+			Scope* survivor;
+			{
+				ScopeFactory scopeFactory;
+				survivor = IFactory<Scope>::Create("Scope"s);
+				delete IFactory<Scope>::Create("Scope"s);
+			}
+
+			//	The factory and its pool are gone, the blocks go with the last object
+			(*survivor)["Value"] = 1;
+			delete survivor;
+		}
+
+		TEST_METHOD(TestUnpooledCreate)
+		{
+			ObjectPool pool(sizeof(Foo));
+			Foo* foo = pool.Create<Foo>();
+			Assert::IsNotNull(foo);
+			Assert::AreEqual(0_z, pool.Allocations());
+			Assert::AreEqual(0_z, pool.Capacity());
+			delete foo;
+		}
+
+		TEST_METHOD(TestConcurrentAllocation)
+		{
+			ObjectPool pool(sizeof(Scope), 8);
+			const size_t threadCount = 4;
+			const size_t perThread = 500;
+
+			//	Objects are freed on another thread than the one that allocated them half of the time
+			Vector<Scope*> shared(threadCount * perThread);
+			std::mutex sharedMutex;
+			Vector<std::thread> threads(threadCount);
+			for (size_t t = 0; t < threadCount; ++t)
+			{
+				threads.PushBack(std::thread([&pool, &shared, &sharedMutex, perThread]
+				{
+					for (size_t i = 0; i < perThread; ++i)
+					{
+						Scope* scope = pool.Create<Scope>();
+						if (i % 2 == 0)
+						{
+							delete scope;
+						}
+						else
+						{
+							std::lock_guard<std::mutex> lock(sharedMutex);
+							shared.PushBack(scope);
+						}
+					}
+				}));
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			Assert::AreEqual(threadCount * perThread, pool.Allocations());
+			Assert::AreEqual(threadCount * perThread / 2, pool.LiveCount());
+			Assert::AreEqual(threadCount * perThread / 2, shared.Size());
+			for (Scope* scope : shared)
+			{
+				delete scope;
+			}
+			Assert::AreEqual(0_z, pool.LiveCount());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState ObjectPoolTests::_startMemState;
+}
@@ -0,0 +1,322 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include "Foo.h"
+#include "Vector.h"
+#include "OrderedMap.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<Foo>(const Foo& t)
+	{
+		RETURN_WIDE_STRING(t.Data());
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	namespace
+	{
+		//	Copies throw once CopiesLeft runs out, Live counts the instances still alive
+		struct ThrowingCopy final
+		{
+			inline static int CopiesLeft = 0;
+			inline static int Live = 0;
+
+			ThrowingCopy() { ++Live; }
+			ThrowingCopy(ThrowingCopy&&) noexcept { ++Live; }
+			ThrowingCopy(const ThrowingCopy&)
+			{
+				if (CopiesLeft-- == 0)
+				{
+					throw std::runtime_error("Copy failed.");
+				}
+				++Live;
+			}
+			~ThrowingCopy() { --Live; }
+		};
+	}
+
+	TEST_CLASS(OrderedMapTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			OrderedMap<int, Foo> map;
+			Assert::AreEqual(0_z, map.Size());
+			Assert::AreEqual(0_z, map.Capacity());
+			Assert::IsTrue(map.IsEmpty());
+			Assert::IsFalse(map.IsIndexed());
+			Assert::IsTrue(map.begin() == map.end());
+			Assert::IsTrue(map.Find(10) == map.end());
+			Assert::IsFalse(map.ContainsKey(10));
+		}
+
+		TEST_METHOD(TestInsert)
+		{
+			OrderedMap<int, Foo> map;
+			OrderedMap<int, Foo>::PairType entry = make_pair(10, Foo(20));
+
+			//	L-Value Reference
+			auto [it, inserted] = map.Insert(entry);
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(0_z, it.Index());
+			Assert::AreEqual(Foo(20), map.Find(10)->second);
+
+			//	R-Value Reference
+			map.Insert(make_pair(20, Foo(30)));
+			Assert::AreEqual(Foo(30), map.Find(20)->second);
+
+			//	Existing keys are not overwritten
+			auto [existing, overwritten] = map.Insert(make_pair(10, Foo(99)));
+			Assert::IsFalse(overwritten);
+			Assert::AreEqual(0_z, existing.Index());
+			Assert::AreEqual(Foo(20), map.Find(10)->second);
+			Assert::AreEqual(2_z, map.Size());
+			Assert::IsTrue(map.ContainsKey(20));
+		}
+
+		TEST_METHOD(TestOrderAndStableAddresses)
+		{
+			//	Well past the linear scan threshold and across several segments
+			const size_t count = 1000;
+			OrderedMap<string, Foo> map;
+			Vector<Foo*> addresses;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto [it, inserted] = map.Insert(make_pair("Key" + to_string(i), Foo(static_cast<int>(i))));
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(i, it.Index());
+				addresses.PushBack(&it->second);
+				Assert::AreEqual(i + 1 > OrderedMap<string, Foo>::LinearScanThreshold, map.IsIndexed());
+			}
+
+			Assert::AreEqual(count, map.Size());
+			Assert::IsTrue(map.Capacity() >= count);
+
+			size_t index = 0;
+			for (auto& [key, value] : map)
+			{
+				Assert::AreEqual("Key" + to_string(index), key);
+				Assert::IsTrue(&value == addresses[index]);
+				Assert::IsTrue(&map.At(index).second == addresses[index]);
+				++index;
+			}
+			Assert::AreEqual(count, index);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto it = map.Find("Key" + to_string(i));
+				Assert::IsTrue(it != map.end());
+				Assert::AreEqual(i, it.Index());
+				Assert::IsTrue(&it->second == addresses[i]);
+			}
+			Assert::IsTrue(map.Find("Key" + to_string(count)) == map.end());
+
+			//	Anagrams share an AdditiveHash - the index still has to tell them apart
+			OrderedMap<string, int> anagrams;
+			const string keys[] = { "abc", "acb", "bac", "bca", "cab", "cba", "aabbcc", "abcabc", "ccbbaa", "bbaacc", "ab", "ba" };
+			for (int i = 0; i < 12; ++i)
+			{
+				anagrams.Insert(make_pair(keys[i], i));
+			}
+			Assert::IsTrue(anagrams.IsIndexed());
+			for (int i = 0; i < 12; ++i)
+			{
+				Assert::AreEqual(i, anagrams.Find(keys[i])->second);
+			}
+		}
+
+		TEST_METHOD(TestCopySemantics)
+		{
+			OrderedMap<int, Foo> map;
+			for (int i = 0; i < 20; ++i)
+			{
+				map.Insert(make_pair(i * 7, Foo(i)));
+			}
+
+			OrderedMap<int, Foo> copy = map;
+			OrderedMap<int, Foo> assigned;
+			assigned.Insert(make_pair(1000, Foo(1000)));
+			assigned = map;
+
+			Assert::AreEqual(map.Size(), copy.Size());
+			Assert::AreEqual(map.Size(), assigned.Size());
+			Assert::IsFalse(assigned.ContainsKey(1000));
+
+			for (size_t i = 0; i < map.Size(); ++i)
+			{
+				Assert::AreEqual(map.At(i).first, copy.At(i).first);
+				Assert::AreEqual(map.At(i).second, copy.At(i).second);
+				Assert::AreEqual(map.At(i).first, assigned.At(i).first);
+				Assert::IsTrue(&map.At(i).second != &copy.At(i).second);
+				Assert::IsTrue(copy.Find(map.At(i).first) != copy.end());
+			}
+		}
+
+		TEST_METHOD(TestCopyThrows)
+		{
+			{
+				OrderedMap<int, ThrowingCopy> map;
+				for (int i = 0; i < 40; ++i)
+				{
+					map.Insert(make_pair(i, ThrowingCopy()));
+				}
+				Assert::AreEqual(40, ThrowingCopy::Live);
+
+				//	Fails partway through a later segment of a map big enough to have an index
+				ThrowingCopy::CopiesLeft = 25;
+				auto copy = [&map] { OrderedMap<int, ThrowingCopy> copied = map; };
+				Assert::ExpectException<std::runtime_error>(copy);
+				Assert::AreEqual(40, ThrowingCopy::Live);
+
+				OrderedMap<int, ThrowingCopy> assigned;
+				assigned.Insert(make_pair(1000, ThrowingCopy()));
+				ThrowingCopy::CopiesLeft = 10;
+				auto assign = [&map, &assigned] { assigned = map; };
+				Assert::ExpectException<std::runtime_error>(assign);
+				Assert::AreEqual(40, ThrowingCopy::Live);
+				Assert::AreEqual(0_z, assigned.Size());
+				Assert::AreEqual(0_z, assigned.Capacity());
+
+				ThrowingCopy::CopiesLeft = 40;
+				assigned = map;
+				Assert::AreEqual(40_z, assigned.Size());
+				Assert::AreEqual(80, ThrowingCopy::Live);
+			}
+
+			Assert::AreEqual(0, ThrowingCopy::Live);
+		}
+
+		TEST_METHOD(TestMoveSemantics)
+		{
+			OrderedMap<int, Foo> map;
+			for (int i = 0; i < 20; ++i)
+			{
+				map.Insert(make_pair(i, Foo(i)));
+			}
+			Foo* first = &map.At(0).second;
+
+			OrderedMap<int, Foo> moved = std::move(map);
+			Assert::AreEqual(0_z, map.Size());
+			Assert::IsFalse(map.IsIndexed());
+			Assert::AreEqual(20_z, moved.Size());
+			Assert::IsTrue(first == &moved.At(0).second);
+			Assert::AreEqual(Foo(19), moved.Find(19)->second);
+
+			OrderedMap<int, Foo> assigned;
+			assigned.Insert(make_pair(100, Foo(100)));
+			assigned = std::move(moved);
+			Assert::AreEqual(0_z, moved.Size());
+			Assert::AreEqual(20_z, assigned.Size());
+			Assert::IsTrue(first == &assigned.At(0).second);
+			Assert::IsFalse(assigned.ContainsKey(100));
+
+			//	Moved from maps are usable
+			moved.Insert(make_pair(5, Foo(5)));
+			Assert::AreEqual(1_z, moved.Size());
+		}
+
+		TEST_METHOD(TestReserveAndClear)
+		{
+			OrderedMap<int, Foo> map;
+			map.Reserve(3);
+			Assert::AreEqual(OrderedMap<int, Foo>::FirstSegmentCapacity, map.Capacity());
+			Assert::IsFalse(map.IsIndexed());
+
+			map.Reserve(100);
+			Assert::IsTrue(map.Capacity() >= 100);
+			Assert::IsTrue(map.IsIndexed());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				map.Insert(make_pair(i, Foo(i)));
+			}
+			Assert::AreEqual(Foo(42), map.Find(42)->second);
+
+			map.Clear();
+			Assert::AreEqual(0_z, map.Size());
+			Assert::AreEqual(0_z, map.Capacity());
+			Assert::IsFalse(map.IsIndexed());
+			Assert::IsFalse(map.ContainsKey(42));
+
+			map.Insert(make_pair(1, Foo(1)));
+			Assert::AreEqual(Foo(1), map.Find(1)->second);
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			OrderedMap<int, Foo> map;
+			const OrderedMap<int, Foo>& constMap = map;
+			map.Insert(make_pair(3, Foo(30)));
+			map.Insert(make_pair(1, Foo(10)));
+			map.Insert(make_pair(2, Foo(20)));
+
+			auto it = map.begin();
+			Assert::AreEqual(3, (*it).first);
+			Assert::AreEqual(3, (it++)->first);
+			Assert::AreEqual(1, it->first);
+			Assert::AreEqual(2, (++it)->first);
+			Assert::IsTrue(++it == map.end());
+			Assert::IsTrue(++it == map.end());
+
+			OrderedMap<int, Foo>::ConstIterator cit = map.begin();
+			Assert::IsTrue(cit == constMap.begin());
+			Assert::IsTrue(cit == map.cbegin());
+			Assert::AreEqual(Foo(30), (*cit).second);
+			Assert::AreEqual(Foo(30), (cit++)->second);
+			Assert::AreEqual(Foo(20), (++cit)->second);
+			Assert::AreEqual(2_z, cit.Index());
+			Assert::IsTrue(++cit == constMap.end());
+			Assert::IsTrue(cit == map.cend());
+			Assert::IsTrue(constMap.Find(2) != constMap.end());
+			Assert::AreEqual(Foo(10), constMap.At(1).second);
+
+			Assert::ExpectException<runtime_error>([&map] { *map.end(); });
+			Assert::ExpectException<runtime_error>([&constMap] { *constMap.end(); });
+			Assert::ExpectException<runtime_error>([&map] { map.At(3); });
+			Assert::ExpectException<runtime_error>([&constMap] { constMap.At(3); });
+			Assert::ExpectException<runtime_error>([] { OrderedMap<int, Foo>::Iterator unassociated; ++unassociated; });
+			Assert::ExpectException<runtime_error>([] { OrderedMap<int, Foo>::Iterator unassociated; *unassociated; });
+			Assert::ExpectException<runtime_error>([] { OrderedMap<int, Foo>::ConstIterator unassociated; ++unassociated; });
+			Assert::ExpectException<runtime_error>([] { OrderedMap<int, Foo>::ConstIterator unassociated; unassociated->first; });
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState OrderedMapTests::_startMemState;
+}
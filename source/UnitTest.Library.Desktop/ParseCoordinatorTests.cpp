@@ -4,10 +4,15 @@
 #include <exception>
 #include <stdexcept>
 #include <functional>
+#include <fstream>
 #include "Foo.h"
 #include "JsonParseCoordinator.h"
 #include "JsonTableParseHelper.h"
 #include "IFactory.h"
+#include "AttributedFoo.h"
+#include "Base64.h"
+#include "TypeManager.h"
+#include "ChangeJournal.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -39,6 +44,8 @@ namespace UnitTestLibraryDesktop
 
 	ConcreteFactory(Power, Scope)
 
+	ConcreteFactory(AttributedFoo, Scope)
+
 	class TestHelper : public IJsonParseHelper
 	{
 		RTTI_DECLARATIONS(TestHelper, IJsonParseHelper)
@@ -67,6 +74,62 @@ namespace UnitTestLibraryDesktop
 
 	RTTI_DEFINITIONS(TestHelper)
 
+	class KeywordHelper : public IJsonParseHelper
+	{
+		RTTI_DECLARATIONS(KeywordHelper, IJsonParseHelper)
+
+	public:
+		void DeclareKeywords(Vector<Keyword>& keywords) const override
+		{
+			keywords.PushBack(Keyword{ "Audio", ValueKinds::Object, 7 });
+			keywords.PushBack(Keyword{ "Volume", ValueKinds::Scalar, 8 });
+		}
+
+		ValueKinds OtherKeys() const override
+		{
+			return ValueKinds::None;
+		}
+
+		bool StartHandler(SharedData& data, const std::string& key, const Json::Value& object, bool inArray, size_t index) override
+		{
+			UNREFERENCED_LOCAL(data);
+			UNREFERENCED_LOCAL(key);
+			UNREFERENCED_LOCAL(object);
+			UNREFERENCED_LOCAL(inArray);
+			UNREFERENCED_LOCAL(index);
+			++_undeclaredCount;
+			return false;
+		}
+
+		bool KeywordStartHandler(SharedData& data, std::uint32_t token, const std::string& key, const Json::Value& object, bool inArray, size_t index) override
+		{
+			UNREFERENCED_LOCAL(data);
+			UNREFERENCED_LOCAL(key);
+			UNREFERENCED_LOCAL(object);
+			UNREFERENCED_LOCAL(inArray);
+			UNREFERENCED_LOCAL(index);
+			_tokens.PushBack(token);
+			return true;
+		}
+
+		bool EndHandler(SharedData& data, const std::string& key) override
+		{
+			UNREFERENCED_LOCAL(data);
+			UNREFERENCED_LOCAL(key);
+			return true;
+		}
+
+		gsl::owner<KeywordHelper*> Create() override
+		{
+			return new KeywordHelper();
+		}
+
+		Vector<std::uint32_t> _tokens;
+		size_t _undeclaredCount = 0;
+	};
+
+	RTTI_DEFINITIONS(KeywordHelper)
+
 	TEST_CLASS(ParseCoordinatorTests)
 	{
 	public:
@@ -367,6 +430,332 @@ namespace UnitTestLibraryDesktop
 			delete clone;
 		}
 
+		TEST_METHOD(TestHomogeneousTableArray)
+		{
+			ScopeFactory scopeFactory;
+			PowerFactory powerFactory;
+			Scope s;
+			SharedTableData tData(s);
+			JsonParseCoordinator parseMaster(tData);
+			JsonTableParseHelper tHelper;
+			parseMaster.AddHelper(tHelper);
+
+			//	Every element creates a Scope - all three come from one CreateN
+			std::string sameClass = R"({ "Items": { "type": "table", "class": "Scope", "value": [
+				{ "type": "table", "value": { "Health": { "type": "integer", "value": 1 } } },
+				{ "type": "table", "value": { "Health": { "type": "integer", "value": 2 } } },
+				{ "type": "table", "value": { "Health": { "type": "integer", "value": 3 } } } ] } })";
+			parseMaster.Parse(sameClass);
+
+			Datum& items = s["Items"];
+			Assert::AreEqual(3_z, items.Size());
+			for (size_t i = 0; i < items.Size(); ++i)
+			{
+				Assert::AreEqual(static_cast<int>(i + 1), items[i]["Health"].Get<int>());
+				Assert::IsTrue(items[i].GetParent() == &s);
+			}
+
+			const ObjectPool& scopePool = scopeFactory.Pool();
+			Assert::AreEqual(3_z, scopePool.Allocations());
+			Assert::AreEqual(0_z, scopePool.Hits());
+			Assert::AreEqual(ObjectPool::DefaultBlockCount, scopePool.Capacity());
+			Assert::IsTrue(reinterpret_cast<char*>(&items[2]) - reinterpret_cast<char*>(&items[0]) == static_cast<ptrdiff_t>(2 * scopePool.Stride()));
+
+			//	Mixed classes are created one at a time
+			std::string mixedClass = R"({ "Mixed": { "type": "table", "value": [
+				{ "class": "Scope", "value": { "Health": { "type": "integer", "value": 4 } } },
+				{ "class": "Power", "value": { "Health": { "type": "integer", "value": 5 } } } ] } })";
+			parseMaster.Parse(mixedClass);
+
+			Datum& mixed = s["Mixed"];
+			Assert::AreEqual(2_z, mixed.Size());
+			Assert::AreEqual(4, mixed[0]["Health"].Get<int>());
+			Assert::AreEqual(5, mixed[1]["Health"].Get<int>());
+			Assert::AreEqual(4_z, scopePool.Allocations());
+			Assert::AreEqual(1_z, powerFactory.Pool().Allocations());
+		}
+
+		TEST_METHOD(TestNativeArrays)
+		{
+			ScopeFactory scopeFactory;
+			Scope s;
+			SharedTableData tData(s);
+			JsonParseCoordinator parseMaster(tData);
+			JsonTableParseHelper tHelper;
+			parseMaster.AddHelper(tHelper);
+
+			//	Value arrays reserve their Datum once, vectors and matrices can be numbers instead of text
+			std::string arrays = R"json({
+				"Scores": { "type": "integer", "value": [ 1, 2, 3, 4, 5 ] },
+				"Flat": { "type": "vector", "value": [ 1, 2, 3, 4, 5, 6, 7, 8 ] },
+				"Nested": { "type": "vector", "value": [ [ 1, 2, 3, 4 ], [ 5, 6, 7, 8 ], [ 9, 10, 11, 12 ] ] },
+				"Single": { "type": "vector", "value": [ 1.5, 2.5, 3.5, 4.5 ] },
+				"Rows": { "type": "matrix", "value": [ [ 1, 2, 3, 4 ], [ 5, 6, 7, 8 ], [ 9, 10, 11, 12 ], [ 13, 14, 15, 16 ] ] },
+				"Text": { "type": "matrix", "value": "mat4x4((1, 2, 3, 4), (5, 6, 7, 8), (9, 10, 11, 12), (13, 14, 15, 16))" },
+				"Strings": { "type": "vector", "value": [ "vec4(1, 2, 3, 4)", "vec4(5, 6, 7, 8)" ] } })json";
+			parseMaster.Parse(arrays);
+
+			Assert::AreEqual(5_z, s["Scores"].Size());
+			Assert::AreEqual(5_z, s["Scores"].Capacity());
+			Assert::AreEqual(2_z, s["Flat"].Size());
+			Assert::AreEqual(2_z, s["Flat"].Capacity());
+			Assert::IsTrue(s["Flat"].Get<vec4>(1) == vec4(5, 6, 7, 8));
+			Assert::AreEqual(3_z, s["Nested"].Size());
+			Assert::AreEqual(3_z, s["Nested"].Capacity());
+			Assert::IsTrue(s["Nested"].Get<vec4>(2) == vec4(9, 10, 11, 12));
+			Assert::IsTrue(s["Single"].Get<vec4>() == vec4(1.5f, 2.5f, 3.5f, 4.5f));
+			Assert::AreEqual(1_z, s["Rows"].Size());
+			Assert::IsTrue(s["Rows"].Get<mat4x4>() == s["Text"].Get<mat4x4>());
+			Assert::IsTrue(s["Strings"] == s["Flat"]);
+
+			//	Streaming builds the same Datums, growing them as it goes
+			Scope streamed;
+			tData.SetRootScope(streamed);
+			parseMaster.ParseStreaming(arrays);
+			Assert::IsTrue(HaveSameEntries(s, streamed));
+
+			//	Native values with components left over, or outside an array, throw
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Short": { "type": "vector", "value": [ 1, 2, 3 ] } })"); });
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Loose": { "type": "vector", "value": 1 } })"); });
+
+			//	Prescribed arrays with external storage are set in place
+			TypeManager::AddType<AttributedFoo>();
+			{
+				AttributedFooFactory fooFactory;
+				Scope fooRoot;
+				tData.SetRootScope(fooRoot);
+				std::string prescribed = R"({ "Foo": { "type": "table", "class": "AttributedFoo", "value": {
+					"VectorArray": { "type": "vector", "value": [ [ 1, 2, 3, 4 ], [ 5, 6, 7, 8 ] ] },
+					"MatrixArray": { "type": "matrix", "value": [ 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 ] } } } })";
+				parseMaster.Parse(prescribed);
+
+				AttributedFoo* foo = fooRoot["Foo"][0].As<AttributedFoo>();
+				Assert::IsNotNull(foo);
+				Assert::IsTrue((*foo)["VectorArray"].Get<vec4>(0) == vec4(1, 2, 3, 4));
+				Assert::IsTrue((*foo)["VectorArray"].Get<vec4>(1) == vec4(5, 6, 7, 8));
+				Assert::IsTrue((*foo)["MatrixArray"].Get<mat4x4>(0) == mat4x4(1.0f));
+				Assert::IsTrue((*foo)["MatrixArray"].Get<mat4x4>(1) == mat4x4(20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f, 20.0f));
+			}
+			TypeManager::Clear();
+		}
+
+		TEST_METHOD(TestDirectWrites)
+		{
+			ScopeFactory scopeFactory;
+			AttributedFooFactory fooFactory;
+			TypeManager::AddType<AttributedFoo>();
+
+			//	In signature order with attributes left out, out of order, and auxiliary attributes in between
+			const std::string json = R"json({ "Foos": { "type": "table", "class": "AttributedFoo", "value": [
+				{ "type": "table", "value": {
+					"Float": { "type": "float", "value": 2.5 },
+					"Vector": { "type": "vector", "value": "vec4(1, 2, 3, 4)" },
+					"Aux": { "type": "integer", "value": 7 },
+					"String": { "type": "string", "value": "First" },
+					"IntegerArray": { "type": "integer", "value": [ 3, 4 ] },
+					"StringArray": { "type": "string", "value": [ "a", "b" ] } } },
+				{ "type": "table", "value": {
+					"String": { "type": "string", "value": "Second" },
+					"Integer": { "type": "integer", "value": 5 },
+					"FloatArray": { "type": "float", "value": [ 0.5 ] } } } ] } })json";
+
+			Scope direct;
+			Scope generic;
+			for (Scope* root : { &direct, &generic })
+			{
+				SharedTableData data(*root);
+				JsonParseCoordinator parser(data);
+				JsonTableParseHelper helper;
+				helper.SetDirectWrites(root == &direct);
+				parser.AddHelper(helper);
+				parser.ParseStreaming(json);
+
+				Assert::AreEqual(2_z, (*root)["Foos"].Size());
+				AttributedFoo* first = (*root)["Foos"][0].As<AttributedFoo>();
+				AttributedFoo* second = (*root)["Foos"][1].As<AttributedFoo>();
+				Assert::IsNotNull(first);
+				Assert::IsNotNull(second);
+
+				Assert::AreEqual(2.5f, (*first)["Float"].Get<float>());
+				Assert::IsTrue((*first)["Vector"].Get<vec4>() == vec4(1, 2, 3, 4));
+				Assert::AreEqual(7, (*first)["Aux"].Get<int>());
+				Assert::IsTrue(first->IsAuxiliaryAttribute("Aux"s));
+				Assert::AreEqual("First"s, (*first)["String"].Get<std::string>());
+				Assert::AreEqual(4, (*first)["IntegerArray"].Get<int>(1));
+				Assert::AreEqual("b"s, (*first)["StringArray"].Get<std::string>(1));
+
+				Assert::AreEqual("Second"s, (*second)["String"].Get<std::string>());
+				Assert::AreEqual(5, (*second)["Integer"].Get<int>());
+				Assert::AreEqual(0.5f, (*second)["FloatArray"].Get<float>(0));
+				Assert::AreEqual(20.0f, (*second)["FloatArray"].Get<float>(1));
+				Assert::AreEqual(first->Size(), second->Size() + 1);
+
+				//	More values than the member holds throw either way, and so does a type the member doesn't have
+				Scope bad;
+				data.SetRootScope(bad);
+				Assert::ExpectException<std::runtime_error>([&parser] { parser.ParseStreaming(R"({ "Foo": { "type": "table", "class": "AttributedFoo", "value": {
+					"IntegerArray": { "type": "integer", "value": [ 1, 2, 3 ] } } } })"); });
+				Assert::ExpectException<std::runtime_error>([&parser] { parser.ParseStreaming(R"({ "Foo": { "type": "table", "class": "AttributedFoo", "value": {
+					"Integer": { "type": "float", "value": 1.5 } } } })"); });
+			}
+
+			TypeManager::Clear();
+		}
+
+		TEST_METHOD(TestBinaryValues)
+		{
+			ScopeFactory scopeFactory;
+			Scope s;
+			SharedTableData tData(s);
+			JsonParseCoordinator parseMaster(tData);
+			JsonTableParseHelper tHelper;
+			parseMaster.AddHelper(tHelper);
+
+			const float floats[] = { 1.5f, -2.0f, 3.25f };
+			const vec4 vectors[] = { vec4(1, 2, 3, 4), vec4(5, 6, 7, 8) };
+			const string fileName = "BinaryValues.bin";
+			{
+				const int integers[] = { 7, -1, 300, 9 };
+				ofstream file(fileName, ios::binary);
+				file.write(reinterpret_cast<const char*>(integers), sizeof(integers));
+			}
+
+			//	Base64 text decodes straight into the Datum, a file is read in place. Ordinary keys named like the fields are left alone.
+			std::string binary = R"({
+				"Floats": { "type": "float", "value": { "base64": ")" + Base64::Encode(floats, sizeof(floats)) + R"(" } },
+				"Vectors": { "type": "vector", "value": { "base64": ")" + Base64::Encode(vectors, sizeof(vectors)) + R"(" } },
+				"All": { "type": "integer", "value": { "file": "BinaryValues.bin" } },
+				"Some": { "type": "integer", "value": { "file": "BinaryValues.bin", "offset": 4, "count": 2 } },
+				"count": { "type": "integer", "value": 3 },
+				"Table": { "type": "table", "value": { "offset": 5, "Inner": { "type": "integer", "value": 1 } } } })";
+			parseMaster.Parse(binary);
+
+			Assert::AreEqual(3_z, s["Floats"].Size());
+			Assert::AreEqual(-2.0f, s["Floats"].Get<float>(1));
+			Assert::AreEqual(3.25f, s["Floats"].Get<float>(2));
+			Assert::AreEqual(2_z, s["Vectors"].Size());
+			Assert::IsTrue(s["Vectors"].Get<vec4>(1) == vec4(5, 6, 7, 8));
+			Assert::AreEqual(4_z, s["All"].Size());
+			Assert::AreEqual(300, s["All"].Get<int>(2));
+			Assert::AreEqual(2_z, s["Some"].Size());
+			Assert::AreEqual(-1, s["Some"].Get<int>(0));
+			Assert::AreEqual(300, s["Some"].Get<int>(1));
+			Assert::AreEqual(3, s["count"].Get<int>());
+			Assert::AreEqual(1_z, s["Table"][0].Size());
+
+			Scope streamed;
+			tData.SetRootScope(streamed);
+			parseMaster.ParseStreaming(binary);
+			Assert::IsTrue(HaveSameEntries(s, streamed));
+
+			//	Strings can't be binary, and the bytes must make whole values the file holds
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Name": { "type": "string", "value": { "base64": "TWFu" } } })"); });
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Odd": { "type": "integer", "value": { "base64": "TWFu" } } })"); });
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Bad": { "type": "integer", "value": { "base64": "TW u" } } })"); });
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Long": { "type": "integer", "value": { "file": "BinaryValues.bin", "count": 5 } } })"); });
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Past": { "type": "integer", "value": { "file": "BinaryValues.bin", "offset": 17 } } })"); });
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Missing": { "type": "integer", "value": { "file": "Missing.bin" } } })"); });
+
+			//	Text that fails to decode leaves the Datum as it was
+			Scope untouched;
+			untouched["Bad"] = 5;
+			tData.SetRootScope(untouched);
+			Assert::ExpectException<std::runtime_error>([&parseMaster] { parseMaster.ParseStreaming(R"({ "Bad": { "type": "integer", "value": { "base64": "AAAAAAAAAAAA!AAA" } } })"); });
+			Assert::AreEqual(1_z, untouched["Bad"].Size());
+			Assert::AreEqual(5, untouched["Bad"].Get<int>());
+
+			//	Files are found relative to the working directory, not to the scene naming them
+			{
+				std::string sceneName = "Content/BinaryValuesScene.json";
+				{
+					ofstream scene(sceneName);
+					scene << R"({ "All": { "type": "integer", "value": { "file": "BinaryValues.bin" } } })";
+				}
+				Scope fromFile;
+				tData.SetRootScope(fromFile);
+				parseMaster.ParseFromFileStreaming(sceneName);
+				Assert::AreEqual(4_z, fromFile["All"].Size());
+				Assert::AreEqual(9, fromFile["All"].Get<int>(3));
+				remove("Content/BinaryValuesScene.json");
+			}
+
+			//	External storage takes as many values as it holds
+			TypeManager::AddType<AttributedFoo>();
+			{
+				AttributedFooFactory fooFactory;
+				Scope fooRoot;
+				tData.SetRootScope(fooRoot);
+				std::string prescribed = R"({ "Foo": { "type": "table", "class": "AttributedFoo", "value": {
+					"IntegerArray": { "type": "integer", "value": { "file": "BinaryValues.bin", "count": 2 } } } } })";
+				parseMaster.Parse(prescribed);
+				AttributedFoo* foo = fooRoot["Foo"][0].As<AttributedFoo>();
+				Assert::AreEqual(7, (*foo)["IntegerArray"].Get<int>(0));
+				Assert::AreEqual(-1, (*foo)["IntegerArray"].Get<int>(1));
+
+				prescribed = R"({ "Foo": { "type": "table", "class": "AttributedFoo", "value": {
+					"IntegerArray": { "type": "integer", "value": { "file": "BinaryValues.bin" } } } } })";
+				Assert::ExpectException<std::runtime_error>([&parseMaster, &prescribed] { parseMaster.Parse(prescribed); });
+			}
+			TypeManager::Clear();
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(TestKeywordDispatch)
+		{
+			Scope s;
+			SharedTableData tData(s);
+			JsonParseCoordinator parseMaster(tData);
+			KeywordHelper keywordHelper;
+			TestHelper wildcardHelper;
+			JsonTableParseHelper tHelper;
+			parseMaster.AddHelper(keywordHelper);
+			parseMaster.AddHelper(wildcardHelper);
+			parseMaster.AddHelper(tHelper);
+
+			//	Declared keys only reach the helper that declared them, with its tokens. The table helper takes the attributes, and only objects.
+			std::string json = R"({ "Audio": { "Volume": 5, "Name": { "type": "string", "value": "Theme" } },
+				"Health": { "type": "integer", "value": 10 }, "Loose": 3 })";
+			parseMaster.Parse(json);
+
+			Assert::AreEqual(2_z, keywordHelper._tokens.Size());
+			Assert::AreEqual(7u, keywordHelper._tokens[0]);
+			Assert::AreEqual(8u, keywordHelper._tokens[1]);
+			Assert::AreEqual(0_z, keywordHelper._undeclaredCount);
+			Assert::IsNull(s.Find("Audio"s));
+			Assert::IsNull(s.Find("Loose"s));
+			Assert::AreEqual("Theme"s, s["Name"].Get<string>());
+			Assert::AreEqual(10, s["Health"].Get<int>());
+
+			//	Streaming dispatches the same way
+			Scope streamed;
+			tData.SetRootScope(streamed);
+			keywordHelper._tokens.Clear();
+			parseMaster.ParseStreaming(json);
+			Assert::AreEqual(2_z, keywordHelper._tokens.Size());
+			Assert::IsTrue(s == streamed);
+
+			//	The table is rebuilt when the helpers change - Audio is an attribute again
+			Scope withoutKeywords;
+			tData.SetRootScope(withoutKeywords);
+			parseMaster.RemoveHelper(keywordHelper);
+			parseMaster.Parse(json);
+			Assert::IsNotNull(withoutKeywords.Find("Audio"s));
+			Assert::AreEqual(10, withoutKeywords["Health"].Get<int>());
+
+			//	Keys that reach StartHandler directly are still recognized as keywords
+			Scope direct;
+			SharedTableData directData(direct);
+			JsonTableParseHelper directHelper;
+			Json::Value object(Json::objectValue);
+			std::string key = "Speed";
+			Assert::IsTrue(directHelper.StartHandler(directData, key, object, false, 0));
+			std::string type = "type";
+			Assert::IsTrue(directHelper.StartHandler(directData, type, Json::Value("float"), false, 0));
+			Assert::IsTrue(directHelper.EndHandler(directData, type));
+			Assert::IsTrue(directHelper.EndHandler(directData, key));
+			Assert::IsTrue(direct["Speed"].Type() == Datum::DatumType::Float);
+		}
+
 		TEST_METHOD(RTTIMacroCoverage)
 		{
 			JsonTableParseHelper helper;
@@ -447,7 +836,202 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::runtime_error>([&intentionallyBrokenString, &parseMaster] { parseMaster.Parse(intentionallyBrokenString); });
 		}
 
+		TEST_METHOD(TestStreamingParsing)
+		{
+			ScopeFactory scopeFactory;
+			PowerFactory powerFactory;
+			JsonTableParseHelper domHelper;
+			JsonTableParseHelper streamHelper;
+
+			Scope domRoot;
+			SharedTableData domData(domRoot);
+			JsonParseCoordinator domParser(domData);
+			domParser.AddHelper(domHelper);
+
+			Scope streamRoot;
+			SharedTableData streamData(streamRoot);
+			JsonParseCoordinator streamParser(streamData);
+			streamParser.AddHelper(streamHelper);
+
+			//	Both paths build the same tree, members only come in document order instead of sorted
+			std::string fileName = "Content/JsonTableInputTest.json";
+			domParser.ParseFromFile(fileName);
+			fileName = "Content/JsonTableInputTest.json";
+			streamParser.ParseFromFileStreaming(fileName);
+			Assert::AreEqual("Content/JsonTableInputTest.json"s, streamParser.GetFileName());
+			Assert::AreEqual(0_z, streamData.Depth());
+			Assert::IsTrue(streamRoot.Size() > 1_z);
+			Assert::IsTrue(HaveSameEntries(domRoot, streamRoot));
+			Assert::AreEqual("Name"s, streamRoot.GetPair(0).first);
+			Assert::IsTrue(streamRoot["Powers"][0].Is(Power::TypeIdClass()));
+
+			//	Scalars, arrays, escapes and comments straight from text
+			Scope textRoot;
+			streamData.SetRootScope(textRoot);
+			streamParser.ParseStreaming(R"({ // Comment
+				"Name": { "type": "string", "value": "Line\nBreak" },
+				"Scores": { "type": "integer", "value": [ 1, -2, 3 ] },
+				"Speed": { "type": "float", "value": 2.5 } })");
+			Assert::AreEqual("Line\nBreak"s, textRoot["Name"].Get<string>());
+			Assert::AreEqual(3_z, textRoot["Scores"].Size());
+			Assert::AreEqual(-2, textRoot["Scores"].Get<int>(1));
+			Assert::AreEqual(2.5f, textRoot["Speed"].Get<float>());
+
+			//	Objects no helper accepts are skipped whole
+			JsonNotValidData notData;
+			JsonParseCoordinator ignoringParser(notData);
+			ignoringParser.AddHelper(streamHelper);
+			ignoringParser.ParseStreaming(R"({ "Skipped": { "type": "integer", "value": [ 1, { "a": [ ] } ] } })");
+			Assert::AreEqual(0_z, notData.Depth());
+
+			//	Missing files are ignored like ParseFromFile does, malformed text throws
+			fileName = "Content/Missing.json";
+			streamParser.ParseFromFileStreaming(fileName);
+			Assert::AreEqual("Content/JsonTableInputTest.json"s, streamParser.GetFileName());
+			Assert::ExpectException<std::runtime_error>([&streamParser] { streamParser.ParseStreaming(R"({ "Name": { "type": "string" )"); });
+			Assert::ExpectException<std::runtime_error>([&streamParser] { streamParser.ParseStreaming(R"([ 1, 2 ])"); });
+			Assert::ExpectException<std::runtime_error>([&streamParser] { streamParser.ParseStreaming(R"({ } { })"); });
+		}
+
+		TEST_METHOD(TestParseBatch)
+		{
+			ScopeFactory scopeFactory;
+			PowerFactory powerFactory;
+			JsonTableParseHelper tHelper;
+			Scope root;
+			SharedTableData tData(root);
+			JsonParseCoordinator parseMaster(tData);
+			parseMaster.AddHelper(tHelper);
+
+			Vector<std::string> fileNames;
+			fileNames.Reserve(6);
+			for (int i = 0; i < 6; ++i)
+			{
+				fileNames.PushBack("ParseBatch"s + to_string(i) + ".json"s);
+				ofstream file(fileNames.Back());
+				file << R"({ "Name": { "type": "string", "value": "File)" << i << R"(" },
+					"Index": { "type": "integer", "value": )" << i << R"( },
+					"Area)" << i << R"(": { "type": "table", "value": { "Powers": { "type": "table", "class": "Power", "value": [
+						{ "type": "table", "value": { "Health": { "type": "integer", "value": 1 } } },
+						{ "type": "table", "value": { "Health": { "type": "integer", "value": 2 } } } ] } } } })";
+			}
+
+			//	Same tree as parsing the files one after the other, whatever the thread count
+			Scope expected;
+			tData.SetRootScope(expected);
+			for (const auto& fileName : fileNames)
+			{
+				std::string name = fileName;
+				parseMaster.ParseFromFile(name);
+			}
+			tData.SetRootScope(root);
+
+			for (size_t threadCount : { 1_z, 2_z, 4_z, 0_z })
+			{
+				parseMaster.ParseBatch(fileNames, threadCount);
+				Assert::IsTrue(root == expected);
+				Assert::AreEqual(fileNames.Back(), parseMaster.GetFileName());
+				Assert::AreEqual(6_z, root["Name"].Size());
+				Assert::AreEqual("File3"s, root["Name"].Get<string>(3));
+				Assert::AreEqual(5, root["Index"].Get<int>(5));
+
+				Scope& area = root["Area2"][0];
+				Assert::IsTrue(area.GetParent() == &root);
+				Assert::IsTrue(area["Powers"][1].Is(Power::TypeIdClass()));
+				Assert::IsTrue(area["Powers"][1].GetParent() == &area);
+				root.Clear();
+			}
+
+			//	Workers parse with the journal suppressed, only the merge is journaled, on this thread
+			ChangeJournal::Enable();
+			parseMaster.ParseBatch(fileNames, 4);
+			Assert::IsTrue(root == expected);
+			size_t adoptCount = 0;
+			for (size_t i = 0; i < ChangeJournal::Size(); ++i)
+			{
+				const ChangeJournal::Entry& entry = ChangeJournal::At(i);
+				//	Besides the merge itself, only the emptying of each batch's Datums, also done by the merge
+				Assert::IsTrue(entry._scope == &root || (entry._type == ChangeJournal::ChangeType::Resize && entry._index == 0));
+				adoptCount += (entry._type == ChangeJournal::ChangeType::Adopt ? 1 : 0);
+			}
+			Assert::AreEqual(fileNames.Size(), adoptCount);
+			ChangeJournal::Disable();
+			root.Clear();
+
+			//	Missing files are skipped, an empty list does nothing
+			fileNames.PushBack("ParseBatchMissing.json"s);
+			parseMaster.ParseBatch(fileNames, 3);
+			Assert::AreEqual(6_z, root["Index"].Size());
+			root.Clear();
+			parseMaster.ParseBatch(Vector<std::string>());
+			Assert::AreEqual(0_z, root.Size());
+
+			//	A type clash with the existing tree throws while merging
+			Datum& clash = root.Append("Index"s);
+			clash.SetType(Datum::DatumType::String);
+			clash.PushBack("Clash"s);
+			Assert::ExpectException<std::runtime_error>([&parseMaster, &fileNames] { parseMaster.ParseBatch(fileNames, 2); });
+			root.Clear();
+
+			//	Shared data that can't merge can't batch
+			JsonNotValidData notData;
+			JsonParseCoordinator notParser(notData);
+			notParser.AddHelper(tHelper);
+			Assert::ExpectException<std::runtime_error>([&notParser, &fileNames] { notParser.ParseBatch(fileNames, 1); });
+
+			//	A malformed file stops the batch and nothing is merged
+			{
+				ofstream file(fileNames.Back());
+				file << R"({ "Name": { "type": "string", "value": )";
+			}
+			Assert::ExpectException<std::exception>([&parseMaster, &fileNames] { parseMaster.ParseBatch(fileNames, 2); });
+			Assert::AreEqual(0_z, root.Size());
+
+			for (const auto& fileName : fileNames)
+			{
+				remove(fileName.c_str());
+			}
+		}
+
 	private:
+		/// <summary>
+		/// Compares two trees by key rather than by insertion order.
+		/// </summary>
+		static bool HaveSameEntries(const Scope& lhs, const Scope& rhs)
+		{
+			if (lhs.Size() != rhs.Size() || lhs.TypeIdInstance() != rhs.TypeIdInstance())
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < lhs.Size(); ++i)
+			{
+				const Scope::PairType& pair = lhs.GetPair(i);
+				const Datum* other = rhs.Find(pair.first);
+				if (other == nullptr || other->Type() != pair.second.Type() || other->Size() != pair.second.Size())
+				{
+					return false;
+				}
+
+				if (pair.second.Type() == Datum::DatumType::Table)
+				{
+					for (size_t j = 0; j < pair.second.Size(); ++j)
+					{
+						if (HaveSameEntries(*pair.second.Get<Scope*>(j), *other->Get<Scope*>(j)) == false)
+						{
+							return false;
+						}
+					}
+				}
+				else if (pair.first != "this"s && pair.second != *other)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 		static _CrtMemState _startMemState;
 	};
 
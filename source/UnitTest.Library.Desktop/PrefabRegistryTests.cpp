@@ -0,0 +1,286 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "Scope.h"
+#include "PrefabRegistry.h"
+#include "TypeManager.h"
+#include "AttributedFoo.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(PrefabRegistryTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			PrefabRegistry::Clear();
+			TypeManager::Clear();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestRegistration)
+		{
+			Assert::AreEqual(0_z, PrefabRegistry::Size());
+			Assert::IsNull(PrefabRegistry::Find("Avatar"));
+			Assert::ExpectException<runtime_error>([] { PrefabRegistry::Instantiate("Avatar"); });
+
+			Scope* avatar = BuildAvatar();
+			Scope& weapon = *avatar->Find("Weapon")->Get<Scope*>();
+			Assert::IsFalse(avatar->IsPrototype());
+
+			const Scope& prototype = PrefabRegistry::Register("Avatar", avatar);
+			Assert::IsTrue(&prototype == avatar);
+			Assert::IsTrue(PrefabRegistry::Find("Avatar") == avatar);
+			Assert::AreEqual(1_z, PrefabRegistry::Size());
+			Assert::IsTrue(avatar->IsPrototype());
+			Assert::IsTrue(weapon.IsPrototype());
+
+			//	Names are unique, and only whole trees can be registered
+			Scope* duplicate = new Scope();
+			Assert::ExpectException<runtime_error>([&duplicate] { PrefabRegistry::Register("Avatar", duplicate); });
+			Assert::ExpectException<runtime_error>([&weapon] { PrefabRegistry::Register("Weapon", &weapon); });
+			Assert::ExpectException<runtime_error>([] { PrefabRegistry::Register("Nothing", nullptr); });
+			delete duplicate;
+
+			PrefabRegistry::Register("Empty", new Scope());
+			Assert::AreEqual(2_z, PrefabRegistry::Size());
+			Assert::IsTrue(PrefabRegistry::Unregister("Empty"));
+			Assert::IsFalse(PrefabRegistry::Unregister("Empty"));
+			Assert::AreEqual(1_z, PrefabRegistry::Size());
+
+			PrefabRegistry::Clear();
+			Assert::AreEqual(0_z, PrefabRegistry::Size());
+		}
+
+		TEST_METHOD(TestCopyOnWrite)
+		{
+			const Scope& prototype = PrefabRegistry::Register("Avatar", BuildAvatar());
+			Scope* first = PrefabRegistry::Instantiate("Avatar");
+			Scope* second = PrefabRegistry::Instantiate("Avatar");
+
+			Assert::IsTrue(*first == prototype);
+			Assert::IsFalse(first->IsPrototype());
+			Assert::IsNull(first->GetParent());
+
+			//	Every non-table Datum reads straight from the prototype
+			const Scope& constFirst = *first;
+			const Datum& name = *constFirst.Find("Name");
+			Assert::IsTrue(name.IsShared());
+			Assert::IsFalse(name.OwnsData());
+			Assert::IsTrue(&name.Get<string>() == &prototype.Find("Name")->Get<string>());
+			Assert::IsTrue(&name.Get<string>() == &as_const(*second).Find("Name")->Get<string>());
+
+			//	Nested scopes are new instances, sharing the nested prototype's data in turn
+			const Scope& weapon = *constFirst.Find("Weapon")->Get<Scope*>();
+			Assert::IsTrue(&weapon != prototype.Find("Weapon")->Get<Scope*>());
+			Assert::IsTrue(weapon.GetParent() == first);
+			Assert::IsFalse(weapon.IsPrototype());
+			Assert::IsTrue(weapon.Find("Damage")->IsShared());
+
+			//	Writing materializes just the written Datum, for just this instance
+			first->Find("Health")->Set(50);
+			Assert::IsFalse(first->Find("Health")->IsShared());
+			Assert::IsTrue(first->Find("Health")->OwnsData());
+			Assert::AreEqual(50, first->Find("Health")->Get<int>());
+			Assert::AreEqual(100, prototype.Find("Health")->Get<int>());
+			Assert::AreEqual(100, as_const(*second).Find("Health")->Get<int>());
+			Assert::IsTrue(name.IsShared());
+
+			(*first)["Tags"].PushBack("Boss"s);
+			Assert::AreEqual(3_z, (*first)["Tags"].Size());
+			Assert::AreEqual("Boss"s, (*first)["Tags"].Get<string>(2));
+			Assert::AreEqual(2_z, prototype.Find("Tags")->Size());
+
+			(*second)["Tags"].RemoveAt(0);
+			Assert::AreEqual(1_z, (*second)["Tags"].Size());
+			Assert::AreEqual("Guard"s, (*second)["Tags"].Get<string>());
+			Assert::AreEqual("Human"s, prototype.Find("Tags")->Get<string>());
+
+			(*second)["Name"] = "Bob"s;
+			Assert::AreEqual("Bob"s, (*second)["Name"].Get<string>());
+			Assert::AreEqual("Avatar"s, prototype.Find("Name")->Get<string>());
+
+			Datum& position = (*second)["Position"];
+			position.Clear();
+			Assert::IsFalse(position.IsShared());
+			Assert::AreEqual(0_z, position.Size());
+			Assert::AreEqual(1_z, prototype.Find("Position")->Size());
+
+			//	Non-const access is treated as a write
+			vec4& velocity = (*second)["Velocity"].Get<vec4>();
+			velocity.x = 10.0f;
+			Assert::AreEqual(0.0f, prototype.Find("Velocity")->Get<vec4>().x);
+
+			//	Copies of an instance share whatever it still shares
+			Scope copy(*first);
+			Assert::IsTrue(as_const(copy).Find("Name")->IsShared());
+			Assert::IsTrue(&as_const(copy).Find("Name")->Get<string>() == &prototype.Find("Name")->Get<string>());
+			Assert::IsFalse(as_const(copy).Find("Health")->IsShared());
+			Assert::AreEqual(50, copy["Health"].Get<int>());
+
+			//	Moves keep sharing
+			Datum moved = std::move(*first->Find("Name"));
+			Assert::IsTrue(moved.IsShared());
+			Datum movedAssigned;
+			movedAssigned = std::move(moved);
+			Assert::IsTrue(movedAssigned.IsShared());
+			Assert::IsFalse(moved.IsShared());
+			Assert::AreEqual("Avatar"s, as_const(movedAssigned).Get<string>());
+
+			delete first;
+			delete second;
+		}
+
+		TEST_METHOD(TestAttributedPrototype)
+		{
+			TypeManager::AddType(AttributedFoo::TypeIdClass(), AttributedFoo::Signatures());
+
+			AttributedFoo* foo = new AttributedFoo();
+			(*foo)["Integer"].Set(42);
+			(*foo)["Auxiliary"] = "Shared"s;
+			const Scope& prototype = PrefabRegistry::Register("Foo", foo);
+
+			Scope* scope = PrefabRegistry::Instantiate("Foo");
+			AttributedFoo* instance = scope->As<AttributedFoo>();
+			Assert::IsNotNull(instance);
+
+			//	Prescribed attributes are bound to the instance's own members
+			const Datum& integer = *as_const(*instance).Find("Integer");
+			Assert::AreEqual(42, integer.Get<int>());
+			Assert::IsFalse(integer.IsShared());
+			Assert::IsTrue(&integer.Get<int>() != &prototype.Find("Integer")->Get<int>());
+			Assert::IsTrue((*instance)["this"].Get<RTTI*>() == instance);
+			Assert::IsTrue(prototype.Find("this")->Get<RTTI*>() == foo);
+
+			(*instance)["Integer"].Set(7);
+			Assert::AreEqual(7, integer.Get<int>());
+			Assert::AreEqual(42, prototype.Find("Integer")->Get<int>());
+
+			//	Auxiliary attributes are shared
+			Assert::IsTrue(as_const(*instance).Find("Auxiliary")->IsShared());
+			(*instance)["Auxiliary"].Set("Written"s);
+			Assert::AreEqual("Written"s, (*instance)["Auxiliary"].Get<string>());
+			Assert::AreEqual("Shared"s, prototype.Find("Auxiliary")->Get<string>());
+
+			delete instance;
+		}
+
+		TEST_METHOD(TestJsonPrefabs)
+		{
+			ScopeFactory scopeFactory;
+			Scope* avatar = BuildAvatar();
+			PrefabRegistry::Register("Avatar", avatar);
+
+			Scope root;
+			SharedTableData tableData(root);
+			JsonTableParseHelper helper;
+			JsonParseCoordinator parseMaster(tableData);
+			parseMaster.AddHelper(helper);
+
+			std::string level =
+				R"({ "Captain": {
+						"type": "table",
+						"prefab": "Avatar",
+						"value": {
+							"Health": { "type": "integer", "value": 250 },
+							"Tags": { "type": "string", "value": [ "Captain" ] }
+						}
+					},
+					"Guard": {
+						"type": "table",
+						"prefab": "Avatar",
+						"value": { }
+					},
+					"Missing": {
+						"type": "table",
+						"prefab": "Nonexistent",
+						"value": { }
+					}
+				})";
+
+			Assert::ExpectException<runtime_error>([&parseMaster, &level] { parseMaster.Parse(level); });
+
+			const Scope& guard = root["Guard"][0];
+			Assert::IsTrue(guard == *avatar);
+			Assert::IsTrue(guard.GetParent() == &root);
+			Assert::IsTrue(guard.Find("Health")->IsShared());
+
+			//	Values given in Json replace the prefab's, everything else stays shared
+			const Scope& captain = root["Captain"][0];
+			Assert::AreEqual(250, captain.Find("Health")->Get<int>());
+			Assert::AreEqual(1_z, captain.Find("Tags")->Size());
+			Assert::AreEqual("Captain"s, captain.Find("Tags")->Get<string>());
+			Assert::IsTrue(captain.Find("Name")->IsShared());
+			Assert::AreEqual(100, avatar->Find("Health")->Get<int>());
+			Assert::AreEqual(2_z, avatar->Find("Tags")->Size());
+
+			//	Streamed keys come in file order. Each element's "prefab" has to come before its own "value", and no "class" is needed.
+			Scope streamed;
+			SharedTableData streamedData(streamed);
+			JsonParseCoordinator streamer(streamedData);
+			JsonTableParseHelper streamedHelper;
+			streamer.AddHelper(streamedHelper);
+			streamer.ParseStreaming(R"({ "Guards": { "type": "table", "value": [
+				{ "type": "table", "prefab": "Avatar", "value": { } },
+				{ "type": "table", "prefab": "Avatar", "value": { "Health": { "type": "integer", "value": 50 } } } ] } })");
+			Assert::AreEqual(2_z, streamed["Guards"].Size());
+			Assert::IsTrue(streamed["Guards"][0] == *avatar);
+			Assert::AreEqual(50, streamed["Guards"][1]["Health"].Get<int>());
+			Assert::IsTrue(streamed["Guards"][1]["Name"].IsShared());
+
+			const string_view late = R"({ "Late": { "type": "table", "value": { }, "prefab": "Avatar" } })";
+			Assert::ExpectException<runtime_error>([&streamer, &late] { streamer.ParseStreaming(late); });
+		}
+
+	private:
+
+		/// <summary>
+		/// BuildAvatar - A small parsed-level style prefab: Name, Health, Tags[2], Position, Velocity and a nested Weapon { Damage }.
+		/// </summary>
+		static gsl::owner<Scope*> BuildAvatar()
+		{
+			Scope* avatar = new Scope();
+			(*avatar)["Name"] = "Avatar"s;
+			(*avatar)["Health"] = 100;
+			(*avatar)["Tags"] = "Human"s;
+			(*avatar)["Tags"].PushBack("Guard"s);
+			(*avatar)["Position"] = vec4(1.0f, 2.0f, 3.0f, 1.0f);
+			(*avatar)["Velocity"] = vec4(0.0f);
+			avatar->AppendScope("Weapon")["Damage"] = 12.5f;
+			return avatar;
+		}
+
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState PrefabRegistryTests::_startMemState;
+}
@@ -0,0 +1,151 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <string>
+#include "RTTI.h"
+#include "Foo.h"
+#include "TypeManager.h"
+#include "GameObject.h"
+#include "Avatar.h"
+#include "ActionListIf.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(RTTITests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestTypeInfoHierarchy)
+		{
+			const TypeInfo& root = RTTI::TypeInfoClass();
+			Assert::AreEqual(0_z, root.Depth());
+			Assert::IsNull(root.Parent());
+			Assert::IsTrue(root.Name() == "RTTI");
+
+			const TypeInfo& actionListIf = ActionListIf::TypeInfoClass();
+			Assert::IsTrue(actionListIf.Name() == "ActionListIf");
+			Assert::AreEqual(5_z, actionListIf.Depth());
+			Assert::IsTrue(actionListIf.Parent() == &ActionList::TypeInfoClass());
+			Assert::IsTrue(ActionList::TypeInfoClass().Parent() == &Action::TypeInfoClass());
+			Assert::IsTrue(Action::TypeInfoClass().Parent() == &Attributed::TypeInfoClass());
+			Assert::IsTrue(Attributed::TypeInfoClass().Parent() == &Scope::TypeInfoClass());
+			Assert::IsTrue(Scope::TypeInfoClass().Parent() == &root);
+
+			//	Ids are stable and lead back to the TypeInfo they came from
+			Assert::AreEqual(ActionListIf::TypeIdClass(), actionListIf.Id());
+			Assert::IsTrue(&TypeInfo::FromId(ActionListIf::TypeIdClass()) == &actionListIf);
+			Assert::AreNotEqual(ActionList::TypeIdClass(), ActionListIf::TypeIdClass());
+
+			Assert::IsTrue(actionListIf.IsA(actionListIf));
+			Assert::IsTrue(actionListIf.IsA(Action::TypeInfoClass()));
+			Assert::IsTrue(actionListIf.IsA(root));
+			Assert::IsFalse(Action::TypeInfoClass().IsA(actionListIf));
+			Assert::IsFalse(actionListIf.IsA(GameObject::TypeInfoClass()));
+			Assert::IsFalse(Avatar::TypeInfoClass().IsA(ActionList::TypeInfoClass()));
+			Assert::IsTrue(Avatar::TypeInfoClass().IsA(GameObject::TypeInfoClass()));
+
+			Assert::IsTrue(actionListIf.IsA("ActionList"sv));
+			Assert::IsTrue(actionListIf.IsA("RTTI"sv));
+			Assert::IsFalse(actionListIf.IsA("GameObject"sv));
+		}
+
+		TEST_METHOD(TestIsAndAs)
+		{
+			TypeManager::AddType<GameObject>();
+			TypeManager::AddType<Avatar>();
+
+			Avatar avatar;
+			RTTI* rtti = &avatar;
+			Assert::IsTrue(&rtti->TypeInfoInstance() == &Avatar::TypeInfoClass());
+			Assert::AreEqual(Avatar::TypeIdClass(), rtti->TypeIdInstance());
+			Assert::AreEqual("Avatar"s, rtti->TypeNameInstance());
+
+			Assert::IsTrue(rtti->Is(Avatar::TypeIdClass()));
+			Assert::IsTrue(rtti->Is(GameObject::TypeIdClass()));
+			Assert::IsTrue(rtti->Is(Scope::TypeIdClass()));
+			Assert::IsTrue(rtti->Is(RTTI::TypeIdClass()));
+			Assert::IsFalse(rtti->Is(Action::TypeIdClass()));
+			Assert::IsFalse(rtti->Is(Bar::TypeIdClass()));
+			Assert::IsFalse(rtti->Is(0));
+
+			//	Ids no type was made from are only compared, never read through
+			Assert::IsFalse(rtti->Is(1));
+			Assert::IsFalse(rtti->Is(reinterpret_cast<RTTI::IdType>(&avatar)));
+			Assert::IsFalse(rtti->Is(~RTTI::IdType(0)));
+			Assert::IsNull(rtti->QueryInterface(1));
+
+			Assert::IsTrue(rtti->Is("Avatar"s));
+			Assert::IsTrue(rtti->Is("Attributed"));
+			Assert::IsFalse(rtti->Is("Action"s));
+			Assert::IsFalse(rtti->Is(""s));
+
+			//	Same characters in a different order hash the same, but must not match
+			Assert::IsFalse(rtti->Is("ratavA"s));
+
+			Assert::IsTrue(rtti->As<GameObject>() == &avatar);
+			Assert::IsNull(rtti->As<Action>());
+			Assert::IsTrue(rtti->QueryInterface(Scope::TypeIdClass()) == rtti);
+			Assert::IsNull(rtti->QueryInterface(Foo::TypeIdClass()));
+
+			const RTTI* constRtti = rtti;
+			Assert::IsTrue(constRtti->As<Avatar>() == &avatar);
+			Assert::IsNull(constRtti->As<Bar>());
+
+			Foo foo;
+			Assert::IsTrue(foo.Is(RTTI::TypeIdClass()));
+			Assert::IsFalse(foo.Is(Scope::TypeIdClass()));
+			Assert::IsTrue(foo.Is("Foo"s));
+			Assert::IsFalse(foo.Is("Bar"s));
+		}
+
+		TEST_METHOD(TestFind)
+		{
+			Assert::IsTrue(TypeInfo::Find("Avatar") == &Avatar::TypeInfoClass());
+			Assert::IsTrue(TypeInfo::Find("ActionListIf"s) == &ActionListIf::TypeInfoClass());
+			Assert::IsTrue(TypeInfo::Find("Foo") == &Foo::TypeInfoClass());
+			Assert::IsTrue(TypeInfo::Find("RTTI") == &RTTI::TypeInfoClass());
+			Assert::IsNull(TypeInfo::Find("Missing"));
+			Assert::IsNull(TypeInfo::Find("ratavA"));
+
+			//	Resolve a name once, then dispatch on the id
+			Foo foo;
+			const TypeInfo* found = TypeInfo::Find("Foo");
+			Assert::IsNotNull(found);
+			Assert::IsTrue(foo.Is(found->Id()));
+			Assert::IsTrue(foo.As<Foo>() == &foo);
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState RTTITests::_startMemState;
+}
@@ -0,0 +1,160 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <exception>
+#include <stdexcept>
+#include <atomic>
+#include <thread>
+#include "Rcu.h"
+#include "Vector.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	/// <summary>
+	/// Counts its own destruction, to see when Rcu reclaims it.
+	/// </summary>
+	struct Tracked final
+	{
+		explicit Tracked(size_t& destroyed, int value = 0) : _destroyed(&destroyed), _value(value) {}
+		~Tracked() { ++(*_destroyed); }
+
+		size_t* _destroyed;
+		int _value;
+	};
+
+	TEST_CLASS(RcuTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestRetireWithoutReaders)
+		{
+			size_t destroyed = 0;
+			Rcu::Retire(new Tracked(destroyed));
+			Assert::AreEqual(1_z, destroyed);
+			Assert::AreEqual(0_z, Rcu::PendingCount());
+
+			Rcu::Retire<Tracked>(nullptr);
+			Assert::AreEqual(0_z, Rcu::PendingCount());
+		}
+
+		TEST_METHOD(TestRetireInsideGuard)
+		{
+			size_t destroyed = 0;
+			{
+				Rcu::ReadGuard outer;
+				{
+					Rcu::ReadGuard inner;
+					Rcu::Retire(new Tracked(destroyed));
+				}
+
+				//	Still inside the outer guard
+				Assert::AreEqual(0_z, destroyed);
+				Assert::AreEqual(1_z, Rcu::PendingCount());
+			}
+
+			//	Leaving the last guard reclaims it
+			Assert::AreEqual(1_z, destroyed);
+			Assert::AreEqual(0_z, Rcu::PendingCount());
+		}
+
+		TEST_METHOD(TestRcuPointer)
+		{
+			size_t destroyed = 0;
+			{
+				RcuPointer<Tracked> pointer;
+				Assert::IsNull(pointer.Load());
+
+				pointer.Store(new Tracked(destroyed, 1));
+				{
+					Rcu::ReadGuard guard;
+					const Tracked* first = pointer.Load();
+					Assert::AreEqual(1, first->_value);
+
+					//	The reader keeps the version it loaded
+					pointer.Store(new Tracked(destroyed, 2));
+					Assert::AreEqual(1, first->_value);
+					Assert::AreEqual(2, pointer.Load()->_value);
+					Assert::AreEqual(0_z, destroyed);
+				}
+				Assert::AreEqual(1_z, destroyed);
+
+				const Tracked* second = pointer.Exchange(nullptr);
+				Assert::AreEqual(2, second->_value);
+				Assert::IsNull(pointer.Load());
+				Rcu::Retire(second);
+				Assert::AreEqual(2_z, destroyed);
+
+				pointer.Store(new Tracked(destroyed, 3));
+			}
+
+			//	The published version goes with the pointer
+			Assert::AreEqual(3_z, destroyed);
+		}
+
+		TEST_METHOD(TestReaderOnAnotherThread)
+		{
+			size_t destroyed = 0;
+			RcuPointer<Tracked> pointer;
+			pointer.Store(new Tracked(destroyed, 1));
+
+			atomic<bool> isReading = false;
+			atomic<bool> isRetired = false;
+			int seen = 0;
+			thread reader([&] {
+				Rcu::ReadGuard guard;
+				const Tracked* loaded = pointer.Load();
+				isReading = true;
+				while (isRetired == false)
+				{
+					this_thread::yield();
+				}
+				seen = loaded->_value;
+			});
+
+			while (isReading == false)
+			{
+				this_thread::yield();
+			}
+			pointer.Store(new Tracked(destroyed, 2));
+			Assert::AreEqual(0_z, destroyed);
+			isRetired = true;
+			reader.join();
+
+			Assert::AreEqual(1, seen);
+			Rcu::Reclaim();
+			Assert::AreEqual(1_z, destroyed);
+			Assert::AreEqual(0_z, Rcu::PendingCount());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState RcuTests::_startMemState;
+}
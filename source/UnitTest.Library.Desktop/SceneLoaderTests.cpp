@@ -0,0 +1,205 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include "ChangeJournal.h"
+#include "JsonTableParseHelper.h"
+#include "SceneLoader.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SceneLoaderTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestLoad)
+		{
+			ScopeFactory scopeFactory;
+			const string fileName = "SceneLoaderTest.json";
+			WriteScene(fileName, 500);
+
+			Scope world;
+			world["Existing"] = 1;
+			SceneLoader loader;
+			shared_ptr<SceneLoad> load = loader.Load(fileName, world, "Level"s);
+			Assert::AreEqual(fileName, load->FileName());
+			Assert::AreEqual(1_z, loader.Size());
+
+			//	Nothing reaches the world before an Update adopts it
+			while (load->GetStatus() == SceneLoad::Status::Loading)
+			{
+				Assert::IsNull(world.Find("Level"s));
+				Assert::IsTrue(load->Progress() >= 0.0f && load->Progress() <= 1.0f);
+				this_thread::yield();
+			}
+			Assert::IsTrue(load->GetStatus() == SceneLoad::Status::Loaded);
+			Assert::IsNull(load->Root());
+			Assert::IsNull(world.Find("Level"s));
+
+			Assert::AreEqual(1_z, loader.Update());
+			Assert::AreEqual(0_z, loader.Size());
+			Assert::IsTrue(load->GetStatus() == SceneLoad::Status::Adopted);
+			Assert::AreEqual(1.0f, load->Progress());
+			Assert::IsTrue(load->Error() == nullptr);
+
+			Scope* root = load->Root();
+			Assert::IsNotNull(root);
+			Assert::IsTrue(&world["Level"][0] == root);
+			Assert::IsTrue(root->GetParent() == &world);
+			Assert::AreEqual(500_z, (*root)["Items"].Size());
+			Assert::AreEqual(499, (*root)["Items"][499]["Index"].Get<int>());
+			Assert::AreEqual("Forest"s, (*root)["Name"].Get<string>());
+
+			//	More loads of the same file land next to it, in the order they were started. The journal only sees them adopted.
+			ChangeJournal::Enable();
+			shared_ptr<SceneLoad> second = loader.Load(fileName, world, "Level"s);
+			shared_ptr<SceneLoad> third = loader.Load(fileName, world, "Level"s);
+			FinishAll(loader);
+			Assert::IsTrue(third->GetStatus() == SceneLoad::Status::Adopted);
+			Assert::AreEqual(3_z, world["Level"].Size());
+			Assert::IsTrue(&world["Level"][1] == second->Root());
+			Assert::IsTrue(&world["Level"][2] == third->Root());
+
+			size_t adoptCount = 0;
+			for (size_t i = 0; i < ChangeJournal::Size(); ++i)
+			{
+				const ChangeJournal::Entry& entry = ChangeJournal::At(i);
+				Assert::IsTrue(entry._scope == &world);
+				adoptCount += (entry._type == ChangeJournal::ChangeType::Adopt ? 1 : 0);
+			}
+			Assert::AreEqual(2_z, adoptCount);
+			ChangeJournal::Disable();
+
+			remove(fileName.c_str());
+		}
+
+		TEST_METHOD(TestFailuresAndCancellation)
+		{
+			ScopeFactory scopeFactory;
+			const string fileName = "SceneLoaderCancel.json";
+			const string badFileName = "SceneLoaderBad.json";
+			WriteScene(fileName, 2000);
+			{
+				ofstream file(badFileName, ios::binary);
+				file << R"({ "Name": { "type": "string", "value": )";
+			}
+
+			Scope world;
+			world["Level"] = 5;
+			shared_ptr<SceneLoad> pending;
+			{
+				SceneLoader loader;
+
+				//	Missing and malformed files fail, and so does adopting under a key that isn't a table
+				shared_ptr<SceneLoad> missing = loader.Load("SceneLoaderMissing.json"s, world, "Missing"s);
+				shared_ptr<SceneLoad> malformed = loader.Load(badFileName, world, "Bad"s);
+				shared_ptr<SceneLoad> clash = loader.Load(fileName, world, "Level"s);
+				Assert::AreEqual(0_z, FinishAll(loader));
+				Assert::IsTrue(missing->GetStatus() == SceneLoad::Status::Failed);
+				Assert::IsTrue(malformed->GetStatus() == SceneLoad::Status::Failed);
+				Assert::IsTrue(clash->GetStatus() == SceneLoad::Status::Failed);
+				Assert::ExpectException<runtime_error>([&clash] { rethrow_exception(clash->Error()); });
+				Assert::IsNull(clash->Root());
+				Assert::AreEqual(1_z, world.Size());
+
+				//	Cancelled loads are never adopted, whether or not their parse was done
+				shared_ptr<SceneLoad> cancelled = loader.Load(fileName, world, "Cancelled"s);
+				cancelled->Cancel();
+				Assert::AreEqual(0_z, FinishAll(loader));
+				Assert::IsTrue(cancelled->GetStatus() == SceneLoad::Status::Cancelled);
+				Assert::IsTrue(cancelled->Error() == nullptr);
+				Assert::IsNull(world.Find("Cancelled"s));
+
+				//	So are the loads a loader still has when it goes away, their handles outlive it
+				pending = loader.Load(fileName, world, "Pending"s);
+			}
+			Assert::IsTrue(pending->GetStatus() == SceneLoad::Status::Cancelled);
+			Assert::IsNull(world.Find("Pending"s));
+
+			remove(fileName.c_str());
+			remove(badFileName.c_str());
+		}
+
+		TEST_METHOD(TestParseProgress)
+		{
+			Scope root;
+			SharedTableData data(root);
+			JsonParseCoordinator parser(data);
+			JsonTableParseHelper helper;
+			parser.AddHelper(helper);
+
+			JsonParseCoordinator::ParseProgress progress;
+			parser.SetProgress(&progress);
+			const string_view json = R"({ "A": { "type": "integer", "value": 1 }, "B": { "type": "integer", "value": 2 } })";
+			parser.ParseStreaming(json);
+			Assert::AreEqual(json.size(), progress._bytesTotal.load());
+			Assert::AreEqual(json.size(), progress._bytesParsed.load());
+
+			//	Cancelled parses stop at their next member
+			progress._isCancelled = true;
+			Assert::ExpectException<runtime_error>([&parser, &json] { parser.ParseStreaming(json); });
+			Assert::AreEqual(2_z, root.Size());
+
+			parser.SetProgress(nullptr);
+			parser.ParseStreaming(json);
+			Assert::AreEqual(2_z, root["A"].Size());
+		}
+
+	private:
+		static void WriteScene(const string& fileName, size_t itemCount)
+		{
+			ofstream file(fileName, ios::binary);
+			file << R"({ "Name": { "type": "string", "value": "Forest" }, "Items": { "type": "table", "value": [ )";
+			for (size_t i = 0; i < itemCount; ++i)
+			{
+				file << (i == 0 ? "" : ", ") << R"({ "type": "table", "value": { "Index": { "type": "integer", "value": )" << i << " } } }";
+			}
+			file << " ] } }";
+		}
+
+		static size_t FinishAll(SceneLoader& loader)
+		{
+			size_t adopted = 0;
+			while (loader.Size() > 0)
+			{
+				adopted += loader.Update();
+				this_thread::yield();
+			}
+			return adopted;
+		}
+
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState SceneLoaderTests::_startMemState;
+}
@@ -0,0 +1,202 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include "AttributedFoo.h"
+#include "IFactory.h"
+#include "SceneReloader.h"
+#include "TypeManager.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	ConcreteFactory(AttributedFoo, Scope)
+
+	TEST_CLASS(SceneReloaderTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+			TypeManager::AddType<AttributedFoo>();
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			TypeManager::Clear();
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestReload)
+		{
+			ScopeFactory scopeFactory;
+			auto scene = [](int health, float weight, const char* tags, const char* items)
+			{
+				return R"json({ "Name": { "type": "string", "value": "Hero" },
+					"Health": { "type": "integer", "value": )json" + to_string(health) + R"json( },
+					"Tags": { "type": "string", "value": [ )json" + tags + R"json( ] },
+					"Items": { "type": "table", "class": "Scope", "value": [
+						{ "type": "table", "value": { "Weight": { "type": "float", "value": )json" + to_string(weight) + R"json( } } } )json" + items + R"json( ] } })json";
+			};
+
+			//	The first Reload writes the whole scene
+			Scope live;
+			SceneReloader reloader(live);
+			Assert::IsTrue(reloader.Reload(scene(100, 1.5f, R"("Brave", "Tall")", "")) > 0);
+			Assert::AreEqual(100, live["Health"].Get<int>());
+			Assert::AreEqual(2_z, live["Tags"].Size());
+			Assert::AreEqual(1.5f, live["Items"][0]["Weight"].Get<float>());
+			Assert::IsTrue(reloader.Source() == live);
+
+			//	Runtime state: a written value, an added attribute and a held pointer
+			live["Name"] = "Renamed"s;
+			live["Score"] = 7;
+			Scope* item = &live["Items"][0];
+			(*item)["Charges"] = 3;
+
+			//	The same text changes nothing, an edit only writes itself
+			Assert::AreEqual(0_z, reloader.Reload(scene(100, 1.5f, R"("Brave", "Tall")", "")));
+			Assert::AreEqual(1_z, reloader.Reload(scene(50, 1.5f, R"("Brave", "Tall")", "")));
+			Assert::AreEqual(50, live["Health"].Get<int>());
+			Assert::AreEqual("Renamed"s, live["Name"].Get<string>());
+			Assert::AreEqual(7, live["Score"].Get<int>());
+
+			//	Children are edited in place
+			Assert::AreEqual(1_z, reloader.Reload(scene(50, 2.5f, R"("Brave", "Tall")", "")));
+			Assert::IsTrue(&live["Items"][0] == item);
+			Assert::AreEqual(2.5f, (*item)["Weight"].Get<float>());
+			Assert::AreEqual(3, (*item)["Charges"].Get<int>());
+
+			//	Values and children the file adds are added, the ones it removes are removed
+			const string added = R"(, { "type": "table", "value": { "Weight": { "type": "float", "value": 9 } } })";
+			Assert::AreEqual(2_z, reloader.Reload(scene(50, 2.5f, R"("Brave", "Tall", "Quick")", added.c_str())));
+			Assert::AreEqual(3_z, live["Tags"].Size());
+			Assert::AreEqual("Quick"s, live["Tags"].Get<string>(2));
+			Assert::AreEqual(2_z, live["Items"].Size());
+			Assert::AreEqual(9.0f, live["Items"][1]["Weight"].Get<float>());
+			Assert::IsTrue(live["Items"][1].GetParent() == &live);
+
+			Assert::AreEqual(3_z, reloader.Reload(scene(50, 2.5f, R"("Brave")", "")));
+			Assert::AreEqual(1_z, live["Tags"].Size());
+			Assert::AreEqual(1_z, live["Items"].Size());
+			Assert::IsTrue(&live["Items"][0] == item);
+
+			//	Values and children added at runtime follow the file's, what the file adds goes in ahead of them
+			live["Tags"].PushBack("Runtime"s);
+			Scope& spawned = live.AppendScope("Items"s);
+			spawned["Weight"] = 4.0f;
+			Assert::AreEqual(2_z, reloader.Reload(scene(50, 2.5f, R"("Brave", "Quick")", added.c_str())));
+			Assert::AreEqual(3_z, live["Tags"].Size());
+			Assert::AreEqual("Quick"s, live["Tags"].Get<string>(1));
+			Assert::AreEqual("Runtime"s, live["Tags"].Get<string>(2));
+			Assert::AreEqual(3_z, live["Items"].Size());
+			Assert::IsTrue(&live["Items"][0] == item);
+			Assert::AreEqual(9.0f, live["Items"][1]["Weight"].Get<float>());
+			Assert::IsTrue(&live["Items"][2] == &spawned);
+			Assert::AreEqual(4.0f, spawned["Weight"].Get<float>());
+
+			Assert::AreEqual(2_z, reloader.Reload(scene(50, 2.5f, R"("Brave")", "")));
+			Assert::AreEqual(2_z, live["Tags"].Size());
+			Assert::AreEqual("Runtime"s, live["Tags"].Get<string>(1));
+			Assert::AreEqual(2_z, live["Items"].Size());
+			Assert::IsTrue(&live["Items"][1] == &spawned);
+
+			//	Keys the file removes lose what it gave them, runtime values and children stay
+			Assert::IsTrue(reloader.Reload(R"({ "Health": { "type": "integer", "value": 50 } })") > 0);
+			Assert::AreEqual(1_z, live["Tags"].Size());
+			Assert::AreEqual("Runtime"s, live["Tags"].Get<string>());
+			Assert::AreEqual(1_z, live["Items"].Size());
+			Assert::IsTrue(&live["Items"][0] == &spawned);
+			Assert::AreEqual(0_z, live["Name"].Size());
+			Assert::AreEqual(7, live["Score"].Get<int>());
+
+			//	A changed type replaces the values, unless tables are involved. Scenes that fail to parse change nothing.
+			Assert::AreEqual(1_z, reloader.Reload(R"({ "Health": { "type": "float", "value": 0.5 } })"));
+			Assert::AreEqual(0.5f, live["Health"].Get<float>());
+			Assert::ExpectException<runtime_error>([&reloader] { reloader.Reload(R"({ "Score": { "type": "table", "value": { } } })"); });
+			Assert::ExpectException<runtime_error>([&reloader] { reloader.Reload(R"({ "Health": { "type": "float" )"); });
+			Assert::AreEqual(0.5f, live["Health"].Get<float>());
+		}
+
+		TEST_METHOD(TestClassesAndAttributed)
+		{
+			ScopeFactory scopeFactory;
+			AttributedFooFactory fooFactory;
+			auto scene = [](const char* className, int integer, const char* vector)
+			{
+				return R"json({ "Foo": { "type": "table", "class": ")json" + string(className) + R"json(", "value": {
+					"Integer": { "type": "integer", "value": )json" + to_string(integer) + R"json( },
+					"VectorArray": { "type": "vector", "value": [ )json" + vector + R"json(, [ 5, 6, 7, 8 ] ] } } },
+					"After": { "type": "table", "value": [ { "type": "table", "value": { } }, { "type": "table", "value": { } } ] } })json";
+			};
+
+			Scope live;
+			SceneReloader reloader(live);
+			reloader.Reload(scene("AttributedFoo", 1, "[ 1, 2, 3, 4 ]"));
+			AttributedFoo* foo = live["Foo"][0].As<AttributedFoo>();
+			Assert::IsNotNull(foo);
+			Assert::AreEqual(1, (*foo)["Integer"].Get<int>());
+			Assert::IsTrue((*foo)["VectorArray"].Get<vec4>(0) == vec4(1, 2, 3, 4));
+
+			//	Prescribed attributes the file doesn't mention keep their runtime values, "this" stays the live object
+			(*foo)["Float"].Set(42.0f);
+			foo->AppendAuxiliaryAttribute("Aux"s) = 3;
+			Assert::AreEqual(2_z, reloader.Reload(scene("AttributedFoo", 2, "[ 0, 0, 0, 0 ]")));
+			Assert::IsTrue(live["Foo"][0].As<AttributedFoo>() == foo);
+			Assert::AreEqual(2, (*foo)["Integer"].Get<int>());
+			Assert::IsTrue((*foo)["VectorArray"].Get<vec4>(0) == vec4(0.0f));
+			Assert::AreEqual(42.0f, (*foo)["Float"].Get<float>());
+			Assert::AreEqual(3, (*foo)["Aux"].Get<int>());
+			Assert::IsTrue((*foo)["this"].Get<RTTI*>() == foo);
+
+			//	A changed class replaces the child in its place
+			Scope* after = &live["After"][1];
+			Assert::AreEqual(1_z, reloader.Reload(scene("Scope", 2, "[ 0, 0, 0, 0 ]")));
+			Assert::IsNull(live["Foo"][0].As<AttributedFoo>());
+			Assert::AreEqual(2, live["Foo"][0]["Integer"].Get<int>());
+			Assert::IsTrue(&live["After"][1] == after);
+
+			Scope* fooScope = &live["Foo"][0];
+			fooScope->AppendScope("Spawned"s);
+			Scope& spawned = live.AppendScope("Foo"s);
+			Assert::AreEqual(1_z, reloader.Reload(scene("AttributedFoo", 2, "[ 0, 0, 0, 0 ]")));
+			Assert::IsNotNull(live["Foo"][0].As<AttributedFoo>());
+			Assert::IsTrue(&live["Foo"][1] == &spawned);
+
+			//	Files
+			const string fileName = "SceneReloaderTest.json";
+			{
+				ofstream file(fileName, ios::binary);
+				file << scene("AttributedFoo", 3, "[ 0, 0, 0, 0 ]");
+			}
+			Assert::AreEqual(1_z, reloader.ReloadFromFile(fileName));
+			Assert::AreEqual(3, live["Foo"][0]["Integer"].Get<int>());
+			remove(fileName.c_str());
+			Assert::ExpectException<runtime_error>([&reloader, &fileName] { reloader.ReloadFromFile(fileName); });
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState SceneReloaderTests::_startMemState;
+}
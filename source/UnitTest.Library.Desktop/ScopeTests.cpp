@@ -549,6 +549,149 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestSmallMapMode)
+		{
+			//	Cross the small map threshold and make sure lookups, order and Datum addresses survive the switch to the index
+			Scope s;
+			Vector<Datum*> addresses;
+			const size_t count = Scope::SmallMapThreshold * 5;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				Datum& d = s.Append("Key" + to_string(i));
+				d = static_cast<int>(i);
+				addresses.PushBack(&d);
+
+				for (size_t j = 0; j <= i; ++j)
+				{
+					Assert::IsTrue(s.Find("Key" + to_string(j)) == addresses[j]);
+				}
+				Assert::IsNull(s.Find("Key" + to_string(i + 1)));
+			}
+
+			Assert::AreEqual(count, s.Size());
+			for (size_t i = 0; i < count; ++i)
+			{
+				Assert::IsTrue(&s[i] == addresses[i]);
+				Assert::AreEqual("Key" + to_string(i), s.GetPair(i).first);
+				Assert::IsTrue(&s.Append("Key" + to_string(i)) == addresses[i]);
+			}
+			Assert::AreEqual(count, s.Size());
+
+			Scope copy = s;
+			Assert::IsTrue(copy == s);
+			for (size_t i = 0; i < count; ++i)
+			{
+				Datum* d = copy.Find("Key" + to_string(i));
+				Assert::IsNotNull(d);
+				Assert::IsTrue(d != addresses[i]);
+				Assert::AreEqual(static_cast<int>(i), d->Get<int>());
+			}
+
+			Scope moved = std::move(copy);
+			Assert::AreEqual(0_z, copy.Size());
+			Assert::IsNull(copy.Find("Key0"));
+			Assert::IsTrue(moved == s);
+			Assert::IsNotNull(moved.Find("Key" + to_string(count - 1)));
+
+			//	Clear drops back to small mode
+			s.Clear();
+			Assert::IsNull(s.Find("Key0"));
+			s["Key0"] = 1;
+			Assert::AreEqual(1, s.Find("Key0")->Get<int>());
+		}
+
+		TEST_METHOD(TestEntries)
+		{
+			Scope s;
+			Assert::IsTrue(s.Entries().IsEmpty());
+			Assert::IsTrue(s.Entries().begin() == s.Entries().end());
+
+			s["A"] = 1;
+			s["B"] = 2;
+			s["C"] = 3;
+
+			auto entries = s.Entries();
+			Assert::AreEqual(3_z, entries.Size());
+
+			size_t count = 0;
+			for (auto [key, datum, index, isPrescribed] : entries)
+			{
+				Assert::AreEqual(count, index);
+				Assert::IsTrue(&key == &s.GetPair(index).first);
+				Assert::IsTrue(&datum == &s[index]);
+				Assert::IsFalse(isPrescribed);
+				datum = static_cast<int>(index * 10);
+				++count;
+			}
+			Assert::AreEqual(3_z, count);
+			Assert::AreEqual(20, s["C"].Get<int>());
+
+			const Scope& constScope = s;
+			auto it = constScope.Entries().begin();
+			Assert::AreEqual("A"s, (*it).key);
+			Assert::AreEqual("B"s, (*++it).key);
+			auto previous = it++;
+			Assert::AreEqual("B"s, (*previous).key);
+			Assert::AreEqual(10, (*previous).datum.Get<int>());
+			Assert::IsTrue(++it == constScope.Entries().end());
+			Assert::ExpectException<runtime_error>([&it] { *it; });
+
+			AttributeView<Datum>::Iterator unassociated;
+			Assert::ExpectException<runtime_error>([&unassociated] { ++unassociated; });
+			Assert::ExpectException<runtime_error>([&unassociated] { *unassociated; });
+		}
+
+		TEST_METHOD(TestMerge)
+		{
+			Scope target;
+			target["Health"] = 1;
+			Scope& existing = target.AppendScope("Children"s);
+
+			int external[2] = { 0, 0 };
+			target.Append("External"s).SetStorage(external, 2);
+
+			Scope source;
+			source["Health"] = 2;
+			source["Name"] = "Merged"s;
+			source.Append("Empty"s);
+			Datum& externalSource = source.Append("External"s);
+			externalSource = 7;
+			externalSource.PushBack(8);
+			Scope& first = source.AppendScope("Children"s);
+			first["Value"] = 10;
+			Scope& second = source.AppendScope("Children"s);
+			second.AppendScope("Grandchild"s);
+
+			//	Values append, children are moved over rather than copied, external storage is written in place
+			target.Merge(source);
+			Assert::AreEqual(0_z, source.Size());
+			Assert::AreEqual(2_z, target["Health"].Size());
+			Assert::AreEqual(2, target["Health"].Get<int>(1));
+			Assert::AreEqual("Merged"s, target["Name"].Get<string>());
+			Assert::AreEqual(Datum::DatumType::Unknown, target["Empty"].Type());
+			Assert::AreEqual(7, external[0]);
+			Assert::AreEqual(8, external[1]);
+
+			Datum& children = target["Children"];
+			Assert::AreEqual(3_z, children.Size());
+			Assert::IsTrue(&children[0] == &existing);
+			Assert::IsTrue(&children[1] == &first);
+			Assert::IsTrue(&children[2] == &second);
+			Assert::IsTrue(first.GetParent() == &target);
+			Assert::IsTrue(second.GetParent() == &target);
+			Assert::AreEqual(10, first["Value"].Get<int>());
+			Assert::IsTrue(second["Grandchild"][0].GetParent() == &second);
+
+			//	Keys new to the target keep their order after its own
+			Assert::AreEqual("Name"s, target.GetPair(3).first);
+			Assert::AreEqual("Empty"s, target.GetPair(4).first);
+
+			//	Mismatched types throw
+			Scope clash;
+			clash["Health"] = "Text"s;
+			Assert::ExpectException<runtime_error>([&target, &clash] { target.Merge(clash); });
+		}
 
 #pragma endregion
 	private:
@@ -0,0 +1,255 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include "Scope.h"
+#include "ScopeTraversal.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ScopeTraversalTests)
+	{
+	public:
+		//	Runs before every Test_Method
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		//	Runs after every Test_Method
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestDepthFirstOrder)
+		{
+			Scope root;
+			Scope* expected[5];
+			size_t expectedDepth[] = { 0, 1, 2, 1, 1 };
+			BuildTree(root, expected);
+
+			//	Pre-order, children in insertion order
+			size_t i = 0;
+			ScopeTraversal traversal(root);
+			for (auto it = traversal.begin(); it != traversal.end(); ++it)
+			{
+				Assert::IsTrue(i < 5);
+				Assert::IsTrue(&(*it) == expected[i]);
+				Assert::AreEqual(expectedDepth[i], it.Depth());
+				++i;
+			}
+			Assert::AreEqual(5_z, i);
+
+			i = 0;
+			for (Scope& s : traversal)
+			{
+				Assert::IsTrue(&s == expected[i++]);
+			}
+			Assert::AreEqual(5_z, i);
+
+			//	Traversals can start below the root, and never climb above their start
+			i = 0;
+			ScopeTraversal::ForEachScope(*expected[1], [&i, &expected](Scope& s, size_t depth)
+			{
+				Assert::IsTrue(&s == expected[1 + i]);
+				Assert::AreEqual(i, depth);
+				++i;
+			});
+			Assert::AreEqual(2_z, i);
+		}
+
+		TEST_METHOD(TestBreadthFirstOrder)
+		{
+			Scope root;
+			Scope* built[5];
+			BuildTree(root, built);
+
+			Scope* expected[] = { built[0], built[1], built[3], built[4], built[2] };
+			size_t expectedDepth[] = { 0, 1, 1, 1, 2 };
+
+			size_t i = 0;
+			ScopeTraversal::ForEachScope(root, [&](Scope& s, size_t depth)
+			{
+				Assert::IsTrue(&s == expected[i]);
+				Assert::AreEqual(expectedDepth[i], depth);
+				++i;
+			}, ScopeTraversal::Order::BreadthFirst);
+			Assert::AreEqual(5_z, i);
+
+			//	Wide enough for the queue to compact itself part way through
+			Scope wide;
+			for (size_t j = 0; j < 1000; ++j)
+			{
+				wide.AppendScope("Children").AppendScope("Children")["Index"] = static_cast<int>(j);
+			}
+
+			int nextIndex = 0;
+			size_t count = 0;
+			ScopeTraversal breadthFirst(wide, ScopeTraversal::Order::BreadthFirst);
+			for (auto it = breadthFirst.begin(); it != breadthFirst.end(); ++it)
+			{
+				++count;
+				if (it.Depth() == 2)
+				{
+					Assert::AreEqual(nextIndex++, (*it)["Index"].Get<int>());
+				}
+			}
+			Assert::AreEqual(2001_z, count);
+		}
+
+		TEST_METHOD(TestSkipChildren)
+		{
+			Scope root;
+			Scope* built[5];
+			BuildTree(root, built);
+
+			size_t count = 0;
+			ScopeTraversal traversal(root);
+			for (auto it = traversal.begin(); it != traversal.end(); it++)
+			{
+				Assert::IsTrue(&(*it) != built[2]);
+				if (&(*it) == built[1])
+				{
+					it.SkipChildren();
+				}
+				++count;
+			}
+			Assert::AreEqual(4_z, count);
+
+			//	Returning false from a visitor prunes as well
+			count = 0;
+			ScopeTraversal::ForEachScope(root, [&count](Scope&, size_t depth)
+			{
+				++count;
+				return depth == 0;
+			}, ScopeTraversal::Order::BreadthFirst);
+			Assert::AreEqual(4_z, count);
+
+			auto end = traversal.end();
+			Assert::ExpectException<runtime_error>([&end] { *end; });
+			Assert::ExpectException<runtime_error>([&end] { end->Size(); });
+			Assert::ExpectException<runtime_error>([&end] { ++end; });
+		}
+
+		TEST_METHOD(TestParallelForEachScope)
+		{
+			Scope root;
+			root["Order"] = 0;
+			for (size_t i = 0; i < 20; ++i)
+			{
+				Scope& child = root.AppendScope("Children");
+				child["Order"] = 0;
+				for (size_t j = 0; j < 10; ++j)
+				{
+					Scope& grandchild = child.AppendScope("Children");
+					grandchild["Order"] = 0;
+					grandchild.AppendScope("Leaves")["Order"] = 0;
+				}
+			}
+			const size_t expectedCount = 1 + 20 + 200 + 200;
+
+			for (size_t threadCount : { 0_z, 1_z, 3_z, 64_z })
+			{
+				atomic<int> sequence{ 0 };
+				atomic<size_t> depthTotal{ 0 };
+
+				ScopeTraversal::ParallelForEachScope(root, [&sequence, &depthTotal](Scope& s, size_t depth)
+				{
+					//	Each visit only writes to its own scope
+					s["Order"].Set(++sequence);
+					depthTotal += depth;
+				}, threadCount);
+
+				Assert::AreEqual(static_cast<int>(expectedCount), sequence.load());
+				Assert::AreEqual(20_z + 400_z + 600_z, depthTotal.load());
+
+				//	Every scope was visited once, after its parent
+				size_t visited = 0;
+				ScopeTraversal::ForEachScope(root, [&visited](Scope& s, size_t)
+				{
+					++visited;
+					int order = s["Order"].Get<int>();
+					Assert::IsTrue(order > 0);
+					if (s.GetParent() != nullptr)
+					{
+						Assert::IsTrue(order > (*s.GetParent())["Order"].Get<int>());
+					}
+				});
+				Assert::AreEqual(expectedCount, visited);
+			}
+
+			//	Pruning
+			atomic<size_t> count{ 0 };
+			ScopeTraversal::ParallelForEachScope(root, [&count](Scope&, size_t depth)
+			{
+				++count;
+				return depth < 2;
+			}, 4);
+			Assert::AreEqual(1_z + 20_z + 200_z, count.load());
+
+			//	A single scope is just visited on the calling thread
+			Scope lonely;
+			count = 0;
+			ScopeTraversal::ParallelForEachScope(lonely, [&count](Scope&, size_t) { ++count; }, 8);
+			Assert::AreEqual(1_z, count.load());
+		}
+
+		TEST_METHOD(TestParallelForEachScopeRethrows)
+		{
+			Scope root;
+			for (size_t i = 0; i < 50; ++i)
+			{
+				root.AppendScope("Children").AppendScope("Children");
+			}
+			root["Children"][17]["Children"][0]["Poison"] = 1;
+
+			Assert::ExpectException<runtime_error>([&root]
+			{
+				ScopeTraversal::ParallelForEachScope(root, [](Scope& s, size_t)
+				{
+					if (s.Find("Poison") != nullptr)
+					{
+						throw runtime_error("Poisoned scope.");
+					}
+				}, 4);
+			});
+		}
+
+	private:
+
+		/// <summary>
+		/// BuildTree - root { A: [a1 { X: [x1] }, a2], B: [b1] }, filling out with root, a1, x1, a2, b1 (pre-order).
+		/// </summary>
+		static void BuildTree(Scope& root, Scope* (&out)[5])
+		{
+			out[0] = &root;
+			out[1] = &root.AppendScope("A");
+			out[2] = &out[1]->AppendScope("X");
+			out[3] = &root.AppendScope("A");
+			root["Health"] = 100;
+			out[4] = &root.AppendScope("B");
+		}
+
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState ScopeTraversalTests::_startMemState;
+}
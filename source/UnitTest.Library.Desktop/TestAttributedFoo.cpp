@@ -3,6 +3,7 @@
 #include <CppUnitTest.h>
 #include <exception>
 #include <stdexcept>
+#include <utility>
 #include "AttributedFoo.h"
 #include "Foo.h"
 #include "TypeManager.h"
@@ -106,6 +107,58 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(afCpyAssign.IsPrescribedAttribute("Integer"s));
 			Assert::IsFalse(afCpyAssign.IsPrescribedAttribute("AuxTestOne"s));
 			Assert::IsTrue(afCpyAssign.IsAttribute("AuxTestOne"s));
+			Assert::IsFalse(afCpyAssign.IsPrescribedAttribute("this"s));
+			Assert::IsTrue(afCpyAssign.IsAuxiliaryAttribute("this"s));
+			Assert::IsFalse(afCpyAssign.IsPrescribedAttribute("Missing"s));
+			Assert::IsFalse(afCpyAssign.IsAuxiliaryAttribute("Missing"s));
+
+			//	Prescribed attributes occupy the indices directly after "this"
+			Assert::AreEqual(AttributedFoo::Signatures().Size(), afCpyAssign.PrescribedAttributeCount());
+			Assert::AreEqual(afCpyAssign.PrescribedAttributeCount(), afMveAssign.PrescribedAttributeCount());
+			Assert::IsFalse(afCpyAssign.IsPrescribedIndex(0));
+			Assert::IsTrue(afCpyAssign.IsPrescribedIndex(1));
+			Assert::IsTrue(afCpyAssign.IsPrescribedIndex(afCpyAssign.PrescribedAttributeCount()));
+			Assert::IsFalse(afCpyAssign.IsPrescribedIndex(afCpyAssign.PrescribedAttributeCount() + 1));
+
+			size_t auxCount = 0;
+			as_const(afCpyAssign).ForEachAuxiliaryAttribute([&auxCount, &testAux](const string& key, const Datum& datum, size_t index)
+			{
+				Assert::AreEqual(testAux[auxCount].name, key);
+				Assert::IsTrue(testAux[auxCount].type == datum.Type());
+				Assert::AreEqual(testAux[auxCount].offset, index);
+				++auxCount;
+			});
+			Assert::AreEqual(testAux.Size(), auxCount);
+
+			//	Views agree with the signature vectors without building them
+			const Vector<Signature> all = afCpyAssign.Attributes();
+			Assert::AreEqual(all.Size(), afCpyAssign.AttributeEntries().Size());
+			for (auto [key, datum, index, isPrescribed] : as_const(afCpyAssign).AttributeEntries())
+			{
+				Assert::AreEqual(all[index].name, key);
+				Assert::IsTrue(all[index].type == datum.Type());
+				Assert::AreEqual(afCpyAssign.IsPrescribedIndex(index), isPrescribed);
+			}
+
+			Assert::AreEqual(testAux.Size(), afCpyAssign.AuxiliaryEntries().Size());
+			auxCount = 0;
+			for (auto [key, datum, index, isPrescribed] : afCpyAssign.AuxiliaryEntries())
+			{
+				Assert::AreEqual(testAux[auxCount++].name, key);
+				Assert::IsFalse(isPrescribed);
+			}
+			Assert::AreEqual(testAux.Size(), auxCount);
+
+			const Vector<Signature>& prescribed = afCpyAssign.PrescribedAttributes();
+			Assert::AreEqual(prescribed.Size(), afCpyAssign.PrescribedEntries().Size());
+			size_t prescribedCount = 0;
+			for (auto [key, datum, index, isPrescribed] : afCpyAssign.PrescribedEntries())
+			{
+				Assert::AreEqual(prescribed[prescribedCount++].name, key);
+				Assert::AreEqual(prescribedCount, index);
+				Assert::IsTrue(isPrescribed);
+			}
+			Assert::AreEqual(prescribed.Size(), prescribedCount);
 
 			const Vector<Signature>& f = afCpyAssign.PrescribedAttributes();
 			const Vector<Signature>& g = afMveAssign.PrescribedAttributes();
@@ -52,6 +52,40 @@ namespace UnitTestLibraryDesktop
 
 	RTTI_DEFINITIONS(TestMeanMonster);
 
+	class TestReflectedMonster : public RTTI
+	{
+		RTTI_DECLARATIONS(TestReflectedMonster, RTTI);
+
+	public:
+		std::string Name;
+		int HitPoints;
+		float Dps;
+		vec4 Waypoints[3];
+
+		static StaticSignatureList StaticSignatures()
+		{
+			static constexpr StaticSignature signatures[] =
+			{
+				REFLECT_FIELD("Name", TestReflectedMonster, Name),
+				REFLECT_FIELD("HitPoints", TestReflectedMonster, HitPoints),
+				REFLECT_FIELD("Dps", TestReflectedMonster, Dps),
+				REFLECT_FIELD("Waypoints", TestReflectedMonster, Waypoints),
+				REFLECT_TABLE("Loot", 2)
+			};
+			static_assert(HasUniqueNames(signatures), "Two attributes of TestReflectedMonster share a name.");
+
+			//	Everything about a signature is known to the compiler
+			static_assert(signatures[1].type == Datum::DatumType::Integer);
+			static_assert(signatures[3].type == Datum::DatumType::Vector && signatures[3].size == 3);
+			static_assert(signatures[4].type == Datum::DatumType::Table && signatures[4].size == 2);
+			static_assert(signatures[0].nameHash == AdditiveHash("Name"));
+
+			return signatures;
+		};
+	};
+
+	RTTI_DEFINITIONS(TestReflectedMonster);
+
 
 	TEST_CLASS(TypeManagerTests)
 	{
@@ -87,13 +121,82 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(TypeManager::Size(), 1_z);
 			Assert::IsTrue(TypeManager::ContainsType(TestMonster::TypeIdClass()));
 
-			auto testMonsterSignatures = TypeManager::GetSignaturesForType(TestMonster::TypeIdClass());
+			const Vector<Signature>& testMonsterSignatures = TypeManager::GetSignaturesForType(TestMonster::TypeIdClass());
+			Assert::IsTrue(&testMonsterSignatures == &TypeManager::GetSignaturesForType(TestMonster::TypeIdClass()));
 			Assert::AreEqual(3_z, testMonsterSignatures.Size());
+
+			//	The layout is "this" followed by the prescribed attributes, typed but without storage
+			const Scope::TableType& layout = TypeManager::GetLayoutForType(TestMonster::TypeIdClass());
+			Assert::AreEqual(4_z, layout.Size());
+			Assert::AreEqual("this"s, layout.At(0).first);
+			Assert::IsTrue(layout.At(0).second.Type() == Datum::DatumType::Pointer);
+			for (size_t i = 0; i < testMonsterSignatures.Size(); ++i)
+			{
+				Assert::AreEqual(testMonsterSignatures[i].name, layout.At(i + 1).first);
+				Assert::IsTrue(testMonsterSignatures[i].type == layout.At(i + 1).second.Type());
+				Assert::AreEqual(0_z, layout.At(i + 1).second.Size());
+			}
 			
 			TypeManager::RemoveType(TestMonster::TypeIdClass());
 			Assert::AreEqual(0_z, TypeManager::Size());
 		}
 
+		TEST_METHOD(TestFreeze)
+		{
+			TypeManager::AddType(TestMonster::TypeIdClass(), TestMonster::Signatures());
+			TypeManager::AddType<TestReflectedMonster>();
+			const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(TestMonster::TypeIdClass());
+
+			TypeManager::Freeze();
+			Assert::IsTrue(TypeManager::IsFrozen());
+			Assert::IsTrue(&signatures == &TypeManager::GetSignaturesForType(TestMonster::TypeIdClass()));
+			Assert::IsTrue(TypeManager::ContainsType(TestReflectedMonster::TypeIdClass()));
+			Assert::IsFalse(TypeManager::ContainsType(RTTI::TypeIdClass()));
+
+			TypeManager::RemoveType(TestReflectedMonster::TypeIdClass());
+			Assert::IsFalse(TypeManager::IsFrozen());
+			Assert::IsFalse(TypeManager::ContainsType(TestReflectedMonster::TypeIdClass()));
+			Assert::IsTrue(TypeManager::ContainsType(TestMonster::TypeIdClass()));
+
+			TypeManager::RemoveType(TestMonster::TypeIdClass());
+			Assert::AreEqual(0_z, TypeManager::Size());
+		}
+
+		TEST_METHOD(TestStaticSignatures)
+		{
+			TypeManager::AddType<TestReflectedMonster>();
+			Assert::IsTrue(TypeManager::ContainsType(TestReflectedMonster::TypeIdClass()));
+
+			const Vector<Signature>& signatures = TypeManager::GetSignaturesForType(TestReflectedMonster::TypeIdClass());
+			Assert::AreEqual(5_z, signatures.Size());
+			Assert::IsTrue(signatures[0] == Signature{ "Name"s, Datum::DatumType::String, 1, 0 });
+			Assert::AreEqual(offsetof(TestReflectedMonster, Name), signatures[0].offset);
+			Assert::IsTrue(signatures[1] == Signature{ "HitPoints"s, Datum::DatumType::Integer, 1, 0 });
+			Assert::AreEqual(offsetof(TestReflectedMonster, HitPoints), signatures[1].offset);
+			Assert::IsTrue(signatures[2] == Signature{ "Dps"s, Datum::DatumType::Float, 1, 0 });
+			Assert::IsTrue(signatures[3] == Signature{ "Waypoints"s, Datum::DatumType::Vector, 3, 0 });
+			Assert::AreEqual(offsetof(TestReflectedMonster, Waypoints), signatures[3].offset);
+			Assert::IsTrue(signatures[4] == Signature{ "Loot"s, Datum::DatumType::Table, 2, 0 });
+
+			const Scope::TableType& layout = TypeManager::GetLayoutForType(TestReflectedMonster::TypeIdClass());
+			Assert::AreEqual(6_z, layout.Size());
+			Assert::AreEqual("Waypoints"s, layout.At(4).first);
+			Assert::IsTrue(layout.At(4).second.Type() == Datum::DatumType::Vector);
+
+			//	Compile time hashes agree with the runtime hash of the same name
+			for (const StaticSignature& signature : TestReflectedMonster::StaticSignatures())
+			{
+				Assert::AreEqual(DefaultHash<string>()(string(signature.name)), signature.nameHash);
+			}
+
+			//	The Vector based registration still describes the same types
+			Assert::AreEqual(TestReflectedMonster::StaticSignatures().Size(), TypeManager::ToSignatures(TestReflectedMonster::StaticSignatures()).Size());
+			Assert::AreEqual(0_z, TypeManager::ToSignatures(StaticSignatureList()).Size());
+
+			TypeManager::RemoveType(TestReflectedMonster::TypeIdClass());
+			Assert::IsFalse(TypeManager::ContainsType(TestReflectedMonster::TypeIdClass()));
+		}
+
 	private:
 		static _CrtMemState _startMemState;
 	};